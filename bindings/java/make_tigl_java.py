@@ -46,7 +46,7 @@ postconstr = '''
 self.version = self.getVersion()
 '''
 
-blacklist = ['tiglLogToFileStreamEnabled']
+blacklist = ['tiglLogToFileStreamEnabled', 'tiglConfigurationSetFuseProgressCallback']
 
 if __name__ == '__main__':
     # parse the file
@@ -55,6 +55,7 @@ if __name__ == '__main__':
     parser.decoration = 'TIGL_COMMON_EXPORT'
     parser.add_alias('TixiDocumentHandle','int')
     parser.add_alias('FILE','void')
+    parser.add_alias('TiglProgressCallback','void')
     
     # set the handle string that the parser can identify the handles
     parser.handle_str = 'TiglCPACSConfigurationHandle'
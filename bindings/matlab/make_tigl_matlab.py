@@ -13,7 +13,7 @@ import bindings_generator.matlab_generator as MG
 import bindings_generator.cheader_parser   as CP
 
 
-blacklist = ['tiglLogToFileStreamEnabled']
+blacklist = ['tiglLogToFileStreamEnabled', 'tiglConfigurationSetFuseProgressCallback', 'tiglExportConfigurationToFiles']
 
 if __name__ == '__main__':
     # parse the file    
@@ -25,6 +25,7 @@ if __name__ == '__main__':
     parser.decoration = 'TIGL_COMMON_EXPORT'
     parser.add_alias('TixiDocumentHandle', 'int')
     parser.add_alias('FILE','void')
+    parser.add_alias('TiglProgressCallback','void')
     parser.parse_header_file(tiglpath + '/src/api/tigl.h')
     
     # create the wrapper
@@ -59,7 +59,7 @@ postconstr = '''
 self.version = self.getVersion()
 '''
 
-blacklist = ['tiglCloseCPACSConfiguration', 'tiglLogToFileStreamEnabled']
+blacklist = ['tiglCloseCPACSConfiguration', 'tiglLogToFileStreamEnabled', 'tiglConfigurationSetFuseProgressCallback']
 
 if __name__ == '__main__':
     # parse the file
@@ -68,6 +68,7 @@ if __name__ == '__main__':
     parser.decoration = 'TIGL_COMMON_EXPORT'
     parser.add_alias('TixiDocumentHandle','int')
     parser.add_alias('FILE','void')
+    parser.add_alias('TiglProgressCallback','void')
     
     # set the handle string that the parser can identify the handles
     parser.handle_str = 'TiglCPACSConfigurationHandle'
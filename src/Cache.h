@@ -16,23 +16,45 @@
 
 #pragma once
 
+#include <atomic>
+
 #include <boost/optional.hpp>
 #include <boost/thread/mutex.hpp>
 #include <boost/thread/lock_guard.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/thread.hpp>
 
 #include "CheckedMutex.h"
+#include "CTiglError.h"
 
 namespace tigl
 {
+    // life cycle of a cache entry
+    enum class CacheState
+    {
+        Empty,
+        Building,
+        Built
+    };
+
     template <typename T>
     class ScopeLockedReference {
     public:
         ScopeLockedReference(T& reference, boost::mutex& mutex)
-            : m_reference(reference), m_mutex(mutex)
+            : m_reference(reference), m_mutex(mutex), m_state(nullptr)
+        {
+        }
+
+        // on destruction, the state is set to Built before the mutex is released
+        ScopeLockedReference(T& reference, boost::mutex& mutex, std::atomic<CacheState>& state)
+            : m_reference(reference), m_mutex(mutex), m_state(&state)
         {
         }
 
         ~ScopeLockedReference() {
+            if (m_state) {
+                m_state->store(CacheState::Built, std::memory_order_release);
+            }
             m_mutex.unlock();
         }
 
@@ -44,8 +66,17 @@ namespace tigl
     private:
         T& m_reference;
         boost::mutex& m_mutex;
+        std::atomic<CacheState>* m_state;
     };
 
+    // Lazily built cache of a CPACS class
+    //
+    // Once the cache is built, value() is wait-free: it only checks an atomic state flag.
+    // The build itself is done exactly once, by the first thread requesting the value. All other
+    // threads requesting the value during the build wait until it is finished instead of building
+    // it again. The build function runs without holding the internal mutex, such that it
+    // may safely access other caches. Accessing the same cache from within its own build
+    // function is detected and reported as an error instead of deadlocking.
     template <typename CacheStruct, typename CpacsClass>
     class Cache
     {
@@ -53,7 +84,7 @@ namespace tigl
         typedef void(CpacsClass::* BuildFunc)(CacheStruct&) const;
 
         Cache(CpacsClass& instance, BuildFunc buildFunc)
-            : m_instance(instance), m_buildFunc(buildFunc)
+            : m_instance(instance), m_buildFunc(buildFunc), m_state(CacheState::Empty)
         {
         }
 
@@ -62,43 +93,95 @@ namespace tigl
         // prefer to rely on the build function for updating the cache
         ScopeLockedReference<CacheStruct> writeAccess() {
             boost::unique_lock<boost::mutex> lock(m_mutex);
+            waitWhileBuilding(lock);
+
+            // readers must not take the fast path while we are writing
+            m_state.store(CacheState::Empty, std::memory_order_release);
             if (!m_cache)
                 m_cache.emplace();
-            return ScopeLockedReference<CacheStruct>(*m_cache, *lock.release());
+            return ScopeLockedReference<CacheStruct>(*m_cache, *lock.release(), m_state);
         }
 
         const CacheStruct& value() const
         {
-            //boost::lock_guard<CheckedMutex> guard(m_mutex);
-            boost::lock_guard<boost::mutex> guard(m_mutex);
-            if (!m_cache) {
-                m_cache.emplace();
-                try {
-                    (m_instance.*m_buildFunc)(*m_cache);
-                }
-                catch (...) {
-                    m_cache = boost::none;
-                    throw;
-                }
+            // fast path, no locking required
+            if (m_state.load(std::memory_order_acquire) == CacheState::Built) {
+                return *m_cache;
             }
-            return m_cache.value();
+            return buildValue();
         }
 
         const CacheStruct& operator*() const { return value(); }
         const CacheStruct* operator->() const { return &value(); }
 
+        // returns true, if the cache is currently built
+        bool isBuilt() const
+        {
+            return m_state.load(std::memory_order_acquire) == CacheState::Built;
+        }
+
         void clear() const
         {
-            //boost::lock_guard<CheckedMutex> guard(m_mutex);
-            boost::lock_guard<boost::mutex> guard(m_mutex);
+            boost::unique_lock<boost::mutex> lock(m_mutex);
+            waitWhileBuilding(lock);
+            m_state.store(CacheState::Empty, std::memory_order_release);
             m_cache = boost::none;
         }
 
     private:
+        const CacheStruct& buildValue() const
+        {
+            boost::unique_lock<boost::mutex> lock(m_mutex);
+            waitWhileBuilding(lock);
+
+            if (m_state.load(std::memory_order_relaxed) == CacheState::Built) {
+                // another thread has built the cache in the meantime
+                return *m_cache;
+            }
+
+            m_cache.emplace();
+            m_builder = boost::this_thread::get_id();
+            m_state.store(CacheState::Building, std::memory_order_relaxed);
+            lock.unlock();
+
+            try {
+                (m_instance.*m_buildFunc)(*m_cache);
+            }
+            catch (...) {
+                lock.lock();
+                m_cache = boost::none;
+                m_builder = boost::thread::id();
+                m_state.store(CacheState::Empty, std::memory_order_release);
+                m_buildFinished.notify_all();
+                throw;
+            }
+
+            lock.lock();
+            m_builder = boost::thread::id();
+            m_state.store(CacheState::Built, std::memory_order_release);
+            m_buildFinished.notify_all();
+            return *m_cache;
+        }
+
+        // blocks until no other thread is building the cache
+        // the lock must be held by the caller
+        void waitWhileBuilding(boost::unique_lock<boost::mutex>& lock) const
+        {
+            if (m_state.load(std::memory_order_relaxed) == CacheState::Building
+                    && m_builder == boost::this_thread::get_id()) {
+                throw CTiglError("Recursive cache access detected during the build of the cache.");
+            }
+            while (m_state.load(std::memory_order_relaxed) == CacheState::Building) {
+                m_buildFinished.wait(lock);
+            }
+        }
+
         CpacsClass& m_instance;
         BuildFunc m_buildFunc;
-        //mutable CheckedMutex m_mutex;
         mutable boost::mutex m_mutex;
+        mutable boost::condition_variable m_buildFinished;
+        mutable boost::thread::id m_builder;
+        mutable std::atomic<CacheState> m_state;
         mutable boost::optional<CacheStruct> m_cache;
     };
 }
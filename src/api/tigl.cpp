@@ -45,7 +45,9 @@
 #include "generated/CPACSLeadingEdgeDevices.h"
 #include "CCPACSTrailingEdgeDevice.h"
 #include "CCPACSLeadingEdgeDevice.h"
+#include "CTiglFusePlane.h"
 #include "CTiglExporterFactory.h"
+#include "CTiglMultiFormatExport.h"
 #include "CTiglLogging.h"
 #include "CCPACSFuselageSection.h"
 #include "CCPACSFuselageSectionElement.h"
@@ -56,6 +58,7 @@
 #include "CCPACSRotorBladeAttachment.h"
 #include "CTiglAttachedRotorBlade.h"
 #include "CGlobalExporterConfigs.h"
+#include "CTiglPersistentShapeCache.h"
 #include "Debugging.h"
 #include "Version.h"
 
@@ -406,6 +409,31 @@ TIGL_COMMON_EXPORT const char* tiglGetVersion()
     return version.c_str();
 }
 
+TIGL_COMMON_EXPORT TiglReturnCode tiglSetGeometryCacheDirectory(const char* directory)
+{
+    if (directory == nullptr) {
+        LOG(ERROR) << "Null pointer for argument directory in tiglSetGeometryCacheDirectory";
+        return TIGL_NULL_POINTER;
+    }
+
+    try {
+        tigl::CTiglPersistentShapeCache::GetInstance().SetDirectory(directory);
+        return TIGL_SUCCESS;
+    }
+    catch (const tigl::CTiglError& ex) {
+        LOG(ERROR) << ex.what();
+        return ex.getCode();
+    }
+    catch (std::exception& ex) {
+        LOG(ERROR) << ex.what();
+        return TIGL_ERROR;
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an exception in tiglSetGeometryCacheDirectory!";
+        return TIGL_ERROR;
+    }
+}
+
 /*** General geometry function ***/
 
 
@@ -771,6 +799,102 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglWingGetLowerPoint(TiglCPACSConfigurationHa
     }
 }
 
+TIGL_COMMON_EXPORT TiglReturnCode tiglWingGetUpperPoints(TiglCPACSConfigurationHandle cpacsHandle,
+                                                         int wingIndex,
+                                                         int segmentIndex,
+                                                         int nPoints,
+                                                         const double* eta,
+                                                         const double* xsi,
+                                                         double* x,
+                                                         double* y,
+                                                         double* z)
+{
+    if (nPoints < 0) {
+        LOG(ERROR) << "Negative number of points in function call to tiglWingGetUpperPoints.";
+        return TIGL_ERROR;
+    }
+    if (nPoints > 0 && (eta == NULL || xsi == NULL || x == NULL || y == NULL || z == NULL)) {
+        LOG(ERROR) << "Null pointer argument for eta, xsi, x, y or z\n"
+                   << "in function call to tiglWingGetUpperPoints.";
+        return TIGL_NULL_POINTER;
+    }
+
+    try {
+        tigl::CCPACSConfigurationManager& manager = tigl::CCPACSConfigurationManager::GetInstance();
+        tigl::CCPACSConfiguration& config = manager.GetConfiguration(cpacsHandle);
+        tigl::CCPACSWing& wing = config.GetWing(wingIndex);
+        std::vector<double> etas(eta, eta + nPoints);
+        std::vector<double> xsis(xsi, xsi + nPoints);
+        std::vector<gp_Pnt> points = wing.GetUpperPoints(segmentIndex, etas, xsis);
+        for (int i = 0; i < nPoints; ++i) {
+            x[i] = points[i].X();
+            y[i] = points[i].Y();
+            z[i] = points[i].Z();
+        }
+        return TIGL_SUCCESS;
+    }
+    catch (const tigl::CTiglError& ex) {
+        LOG(ERROR) << ex.what();
+        return ex.getCode();
+    }
+    catch (std::exception& ex) {
+        LOG(ERROR) << ex.what();
+        return TIGL_ERROR;
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an unknown exception in tiglWingGetUpperPoints";
+        return TIGL_ERROR;
+    }
+}
+
+TIGL_COMMON_EXPORT TiglReturnCode tiglWingGetLowerPoints(TiglCPACSConfigurationHandle cpacsHandle,
+                                                         int wingIndex,
+                                                         int segmentIndex,
+                                                         int nPoints,
+                                                         const double* eta,
+                                                         const double* xsi,
+                                                         double* x,
+                                                         double* y,
+                                                         double* z)
+{
+    if (nPoints < 0) {
+        LOG(ERROR) << "Negative number of points in function call to tiglWingGetLowerPoints.";
+        return TIGL_ERROR;
+    }
+    if (nPoints > 0 && (eta == NULL || xsi == NULL || x == NULL || y == NULL || z == NULL)) {
+        LOG(ERROR) << "Null pointer argument for eta, xsi, x, y or z\n"
+                   << "in function call to tiglWingGetLowerPoints.";
+        return TIGL_NULL_POINTER;
+    }
+
+    try {
+        tigl::CCPACSConfigurationManager& manager = tigl::CCPACSConfigurationManager::GetInstance();
+        tigl::CCPACSConfiguration& config = manager.GetConfiguration(cpacsHandle);
+        tigl::CCPACSWing& wing = config.GetWing(wingIndex);
+        std::vector<double> etas(eta, eta + nPoints);
+        std::vector<double> xsis(xsi, xsi + nPoints);
+        std::vector<gp_Pnt> points = wing.GetLowerPoints(segmentIndex, etas, xsis);
+        for (int i = 0; i < nPoints; ++i) {
+            x[i] = points[i].X();
+            y[i] = points[i].Y();
+            z[i] = points[i].Z();
+        }
+        return TIGL_SUCCESS;
+    }
+    catch (const tigl::CTiglError& ex) {
+        LOG(ERROR) << ex.what();
+        return ex.getCode();
+    }
+    catch (std::exception& ex) {
+        LOG(ERROR) << ex.what();
+        return TIGL_ERROR;
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an unknown exception in tiglWingGetLowerPoints";
+        return TIGL_ERROR;
+    }
+}
+
 TIGL_COMMON_EXPORT TiglReturnCode tiglWingSetGetPointBehavior(TiglCPACSConfigurationHandle cpacsHandle,
                                                               TiglGetPointBehavior behavior)
 {
@@ -3242,6 +3366,55 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglFuselageGetPointAngleTranslated(TiglCPACSC
     }
 }
 
+TIGL_COMMON_EXPORT TiglReturnCode tiglFuselageGetPointsAngle(TiglCPACSConfigurationHandle cpacsHandle,
+                                                             int fuselageIndex,
+                                                             int segmentIndex,
+                                                             double eta,
+                                                             int nAngles,
+                                                             const double* alpha,
+                                                             double* x,
+                                                             double* y,
+                                                             double* z)
+{
+    if (nAngles < 0) {
+        LOG(ERROR) << "Negative number of angles in function call to tiglFuselageGetPointsAngle.";
+        return TIGL_ERROR;
+    }
+    if (nAngles > 0 && (alpha == NULL || x == NULL || y == NULL || z == NULL)) {
+        LOG(ERROR) << "Null pointer argument for alpha, x, y or z\n"
+                   << "in function call to tiglFuselageGetPointsAngle.";
+        return TIGL_NULL_POINTER;
+    }
+
+    try {
+        tigl::CCPACSConfigurationManager& manager = tigl::CCPACSConfigurationManager::GetInstance();
+        tigl::CCPACSConfiguration& config = manager.GetConfiguration(cpacsHandle);
+        tigl::CCPACSFuselage& fuselage = config.GetFuselage(fuselageIndex);
+        tigl::CCPACSFuselageSegment& segment = (tigl::CCPACSFuselageSegment &) fuselage.GetSegment(segmentIndex);
+
+        std::vector<double> alphas(alpha, alpha + nAngles);
+        std::vector<gp_Pnt> points = segment.GetPointsAngle(eta, alphas);
+        for (int i = 0; i < nAngles; ++i) {
+            x[i] = points[i].X();
+            y[i] = points[i].Y();
+            z[i] = points[i].Z();
+        }
+        return TIGL_SUCCESS;
+    }
+    catch (const tigl::CTiglError& ex) {
+        LOG(ERROR) << ex.what();
+        return ex.getCode();
+    }
+    catch (std::exception& ex) {
+        LOG(ERROR) << ex.what();
+        return TIGL_ERROR;
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an exception in tiglFuselageGetPointsAngle!";
+        return TIGL_ERROR;
+    }
+}
+
 
 TIGL_COMMON_EXPORT TiglReturnCode tiglFuselageGetPointOnXPlane(TiglCPACSConfigurationHandle cpacsHandle,
                                                                int fuselageIndex,
@@ -3399,6 +3572,193 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglFuselageGetNumPointsOnYPlane(TiglCPACSConf
     }
 }
 
+namespace
+{
+    enum class FuselageCuttingPlane
+    {
+        X,
+        Y
+    };
+
+    std::vector<std::vector<gp_Pnt>> fuselageGetPointsOnPlanes(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                int fuselageIndex,
+                                                                int segmentIndex,
+                                                                double eta,
+                                                                int nPlanes,
+                                                                const double* pos,
+                                                                FuselageCuttingPlane planeType)
+    {
+        tigl::CCPACSConfigurationManager& manager = tigl::CCPACSConfigurationManager::GetInstance();
+        tigl::CCPACSConfiguration& config = manager.GetConfiguration(cpacsHandle);
+        tigl::CCPACSFuselage& fuselage = config.GetFuselage(fuselageIndex);
+        tigl::CCPACSFuselageSegment& segment = (tigl::CCPACSFuselageSegment &) fuselage.GetSegment(segmentIndex);
+
+        std::vector<double> positions(pos, pos + nPlanes);
+        if (planeType == FuselageCuttingPlane::Y) {
+            return segment.GetPointsOnYPlanes(eta, positions);
+        }
+        else {
+            return segment.GetPointsOnXPlanes(eta, positions);
+        }
+    }
+
+    TiglReturnCode fuselageGetNumPointsOnPlanes(TiglCPACSConfigurationHandle cpacsHandle,
+                                                int fuselageIndex,
+                                                int segmentIndex,
+                                                double eta,
+                                                int nPlanes,
+                                                const double* pos,
+                                                int* numPoints,
+                                                FuselageCuttingPlane planeType,
+                                                const char* functionName)
+    {
+        if (nPlanes < 0) {
+            LOG(ERROR) << "Negative number of planes in function call to " << functionName << ".";
+            return TIGL_ERROR;
+        }
+        if (nPlanes > 0 && (pos == NULL || numPoints == NULL)) {
+            LOG(ERROR) << "Null pointer argument for the plane positions or numPoints\n"
+                       << "in function call to " << functionName << ".";
+            return TIGL_NULL_POINTER;
+        }
+
+        try {
+            std::vector<std::vector<gp_Pnt>> points = fuselageGetPointsOnPlanes(cpacsHandle, fuselageIndex, segmentIndex, eta, nPlanes, pos, planeType);
+            for (int i = 0; i < nPlanes; ++i) {
+                numPoints[i] = static_cast<int>(points[i].size());
+            }
+            return TIGL_SUCCESS;
+        }
+        catch (const tigl::CTiglError& ex) {
+            LOG(ERROR) << ex.what();
+            return ex.getCode();
+        }
+        catch (std::exception& ex) {
+            LOG(ERROR) << ex.what();
+            return TIGL_ERROR;
+        }
+        catch (...) {
+            LOG(ERROR) << "Caught an exception in " << functionName << "!";
+            return TIGL_ERROR;
+        }
+    }
+
+    TiglReturnCode fuselageGetPointsOnPlanes(TiglCPACSConfigurationHandle cpacsHandle,
+                                             int fuselageIndex,
+                                             int segmentIndex,
+                                             double eta,
+                                             int nPlanes,
+                                             const double* pos,
+                                             int nPoints,
+                                             double* x,
+                                             double* y,
+                                             double* z,
+                                             FuselageCuttingPlane planeType,
+                                             const char* functionName)
+    {
+        if (nPlanes < 0 || nPoints < 0) {
+            LOG(ERROR) << "Negative number of planes or points in function call to " << functionName << ".";
+            return TIGL_ERROR;
+        }
+        if ((nPlanes > 0 && pos == NULL) || (nPoints > 0 && (x == NULL || y == NULL || z == NULL))) {
+            LOG(ERROR) << "Null pointer argument for the plane positions, x, y or z\n"
+                       << "in function call to " << functionName << ".";
+            return TIGL_NULL_POINTER;
+        }
+
+        try {
+            std::vector<std::vector<gp_Pnt>> points = fuselageGetPointsOnPlanes(cpacsHandle, fuselageIndex, segmentIndex, eta, nPlanes, pos, planeType);
+
+            size_t nTotal = 0;
+            for (const auto& planePoints : points) {
+                nTotal += planePoints.size();
+            }
+            if (nTotal != static_cast<size_t>(nPoints)) {
+                LOG(ERROR) << "The number of points " << nPoints << " does not match the number of intersection points "
+                           << nTotal << " in function call to " << functionName << ".";
+                return TIGL_ERROR;
+            }
+
+            int index = 0;
+            for (const auto& planePoints : points) {
+                for (const gp_Pnt& p : planePoints) {
+                    x[index] = p.X();
+                    y[index] = p.Y();
+                    z[index] = p.Z();
+                    index++;
+                }
+            }
+            return TIGL_SUCCESS;
+        }
+        catch (const tigl::CTiglError& ex) {
+            LOG(ERROR) << ex.what();
+            return ex.getCode();
+        }
+        catch (std::exception& ex) {
+            LOG(ERROR) << ex.what();
+            return TIGL_ERROR;
+        }
+        catch (...) {
+            LOG(ERROR) << "Caught an exception in " << functionName << "!";
+            return TIGL_ERROR;
+        }
+    }
+} // namespace
+
+TIGL_COMMON_EXPORT TiglReturnCode tiglFuselageGetNumPointsOnXPlanes(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                    int fuselageIndex,
+                                                                    int segmentIndex,
+                                                                    double eta,
+                                                                    int nPlanes,
+                                                                    const double* xpos,
+                                                                    int* numPoints)
+{
+    return fuselageGetNumPointsOnPlanes(cpacsHandle, fuselageIndex, segmentIndex, eta, nPlanes, xpos, numPoints,
+                                        FuselageCuttingPlane::X, "tiglFuselageGetNumPointsOnXPlanes");
+}
+
+TIGL_COMMON_EXPORT TiglReturnCode tiglFuselageGetNumPointsOnYPlanes(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                    int fuselageIndex,
+                                                                    int segmentIndex,
+                                                                    double eta,
+                                                                    int nPlanes,
+                                                                    const double* ypos,
+                                                                    int* numPoints)
+{
+    return fuselageGetNumPointsOnPlanes(cpacsHandle, fuselageIndex, segmentIndex, eta, nPlanes, ypos, numPoints,
+                                        FuselageCuttingPlane::Y, "tiglFuselageGetNumPointsOnYPlanes");
+}
+
+TIGL_COMMON_EXPORT TiglReturnCode tiglFuselageGetPointsOnXPlanes(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                 int fuselageIndex,
+                                                                 int segmentIndex,
+                                                                 double eta,
+                                                                 int nPlanes,
+                                                                 const double* xpos,
+                                                                 int nPoints,
+                                                                 double* x,
+                                                                 double* y,
+                                                                 double* z)
+{
+    return fuselageGetPointsOnPlanes(cpacsHandle, fuselageIndex, segmentIndex, eta, nPlanes, xpos, nPoints, x, y, z,
+                                     FuselageCuttingPlane::X, "tiglFuselageGetPointsOnXPlanes");
+}
+
+TIGL_COMMON_EXPORT TiglReturnCode tiglFuselageGetPointsOnYPlanes(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                 int fuselageIndex,
+                                                                 int segmentIndex,
+                                                                 double eta,
+                                                                 int nPlanes,
+                                                                 const double* ypos,
+                                                                 int nPoints,
+                                                                 double* x,
+                                                                 double* y,
+                                                                 double* z)
+{
+    return fuselageGetPointsOnPlanes(cpacsHandle, fuselageIndex, segmentIndex, eta, nPlanes, ypos, nPoints, x, y, z,
+                                     FuselageCuttingPlane::Y, "tiglFuselageGetPointsOnYPlanes");
+}
+
 
 TIGL_COMMON_EXPORT TiglReturnCode tiglFuselageGetCircumference(TiglCPACSConfigurationHandle cpacsHandle,
                                                                int fuselageIndex,
@@ -5508,6 +5868,91 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglGetCurveParameter (TiglCPACSConfigurationH
     }
 }
 
+TIGL_COMMON_EXPORT TiglReturnCode tiglConfigurationSetFuseOptions(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                  TiglBoolean runParallel,
+                                                                  double fuzzyValue,
+                                                                  TiglFuseGlueMode glueMode)
+{
+    if (fuzzyValue < 0.) {
+        LOG(ERROR) << "Negative fuzzy value in tiglConfigurationSetFuseOptions.";
+        return TIGL_INVALID_VALUE;
+    }
+    if (glueMode != TIGL_GLUE_OFF && glueMode != TIGL_GLUE_SHIFT && glueMode != TIGL_GLUE_FULL) {
+        LOG(ERROR) << "Invalid glue mode in tiglConfigurationSetFuseOptions.";
+        return TIGL_INVALID_VALUE;
+    }
+
+    try {
+        tigl::CCPACSConfigurationManager& manager = tigl::CCPACSConfigurationManager::GetInstance();
+        tigl::CCPACSConfiguration& config = manager.GetConfiguration(cpacsHandle);
+        tigl::PTiglFusePlane fuser = config.AircraftFusingAlgo();
+        fuser->SetRunParallel(runParallel == TIGL_TRUE);
+        fuser->SetFuzzyValue(fuzzyValue);
+        fuser->SetGlueMode(glueMode);
+        return TIGL_SUCCESS;
+    }
+    catch (const tigl::CTiglError& ex) {
+        LOG(ERROR) << ex.what();
+        return ex.getCode();
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an exception in tiglConfigurationSetFuseOptions!";
+        return TIGL_ERROR;
+    }
+}
+
+TIGL_COMMON_EXPORT TiglReturnCode tiglConfigurationSetFuseProgressCallback(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                           TiglProgressCallback callback,
+                                                                           void* userData)
+{
+    try {
+        tigl::CCPACSConfigurationManager& manager = tigl::CCPACSConfigurationManager::GetInstance();
+        tigl::CCPACSConfiguration& config = manager.GetConfiguration(cpacsHandle);
+        tigl::PTiglFusePlane fuser = config.AircraftFusingAlgo();
+        if (callback) {
+            fuser->SetProgressCallback([callback, userData](double progress) {
+                return callback(progress, userData) == TIGL_TRUE;
+            });
+        }
+        else {
+            fuser->SetProgressCallback(tigl::CTiglFusePlane::ProgressCallback());
+        }
+        return TIGL_SUCCESS;
+    }
+    catch (const tigl::CTiglError& ex) {
+        LOG(ERROR) << ex.what();
+        return ex.getCode();
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an exception in tiglConfigurationSetFuseProgressCallback!";
+        return TIGL_ERROR;
+    }
+}
+
+TIGL_COMMON_EXPORT TiglReturnCode tiglIntersectSetCacheMemoryBudget(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                    int budgetInMB)
+{
+    if (budgetInMB < 0) {
+        LOG(ERROR) << "Negative memory budget in tiglIntersectSetCacheMemoryBudget.";
+        return TIGL_INVALID_VALUE;
+    }
+
+    try {
+        tigl::CCPACSConfigurationManager& manager = tigl::CCPACSConfigurationManager::GetInstance();
+        tigl::CCPACSConfiguration& config = manager.GetConfiguration(cpacsHandle);
+        config.GetShapeCache().SetMemoryBudget(static_cast<size_t>(budgetInMB) * 1024 * 1024);
+        return TIGL_SUCCESS;
+    }
+    catch (const tigl::CTiglError& ex) {
+        LOG(ERROR) << ex.what();
+        return ex.getCode();
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an exception in tiglIntersectSetCacheMemoryBudget!";
+        return TIGL_ERROR;
+    }
+}
+
 
 
 /*****************************************************************************************************/
@@ -7422,8 +7867,7 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglCheckPointInside(TiglCPACSConfigurationHan
         // get component
         tigl::CTiglAbstractGeometricComponent& component = static_cast<tigl::CTiglAbstractGeometricComponent&>(config.GetUIDManager().GetGeometricComponent(componentUID));
 
-        const TopoDS_Shape shape = component.GetLoft()->Shape();
-        *isInside = IsPointInsideShape(shape, gp_Pnt(px, py, pz), &component.GetBoundingBox()) ? TIGL_TRUE : TIGL_FALSE;
+        *isInside = component.IsPointInside(gp_Pnt(px, py, pz)) ? TIGL_TRUE : TIGL_FALSE;
 
         return TIGL_SUCCESS;
     }
@@ -7443,6 +7887,62 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglCheckPointInside(TiglCPACSConfigurationHan
     return TIGL_ERROR;
 }
 
+TIGL_COMMON_EXPORT TiglReturnCode tiglCheckPointsInside(TiglCPACSConfigurationHandle cpacsHandle,
+                                                        const char *componentUID, int nPoints,
+                                                        const double *px, const double *py, const double *pz,
+                                                        TiglBoolean *isInside)
+{
+    if (!componentUID) {
+        LOG(ERROR) << "Argument componentUID is NULL in tiglCheckPointsInside!";
+        return TIGL_NULL_POINTER;
+    }
+
+    if (nPoints < 0) {
+        LOG(ERROR) << "Negative number of points in tiglCheckPointsInside!";
+        return TIGL_ERROR;
+    }
+
+    if (nPoints > 0 && (!px || !py || !pz || !isInside)) {
+        LOG(ERROR) << "Argument px, py, pz or isInside is NULL in tiglCheckPointsInside!";
+        return TIGL_NULL_POINTER;
+    }
+
+    try {
+        const tigl::CCPACSConfigurationManager& manager = tigl::CCPACSConfigurationManager::GetInstance();
+        tigl::CCPACSConfiguration& config = manager.GetConfiguration(cpacsHandle);
+
+        // get component
+        tigl::CTiglAbstractGeometricComponent& component = static_cast<tigl::CTiglAbstractGeometricComponent&>(config.GetUIDManager().GetGeometricComponent(componentUID));
+
+        std::vector<gp_Pnt> points;
+        points.reserve(nPoints);
+        for (int i = 0; i < nPoints; ++i) {
+            points.push_back(gp_Pnt(px[i], py[i], pz[i]));
+        }
+
+        std::vector<bool> inside = component.ArePointsInside(points);
+        for (int i = 0; i < nPoints; ++i) {
+            isInside[i] = inside[i] ? TIGL_TRUE : TIGL_FALSE;
+        }
+
+        return TIGL_SUCCESS;
+    }
+    catch (const tigl::CTiglError& ex) {
+        LOG(ERROR) << "In tiglCheckPointsInside: " << ex.what();
+        return ex.getCode();
+    }
+    catch (std::exception& ex) {
+        LOG(ERROR) << "In tiglCheckPointsInside: " << ex.what();
+    }
+    catch (Standard_Failure& err) {
+        LOG(ERROR) << "Cannot compute shape `" << componentUID << "`: " << err.GetMessageString();
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an exception in tiglCheckPointsInside!";
+    }
+    return TIGL_ERROR;
+}
+
 TiglReturnCode tiglSetExportOptions(const char *exporter_name, const char *option_name, const char *option_value)
 {
     if (!exporter_name) {
@@ -7574,6 +8074,48 @@ TiglReturnCode tiglExportConfiguration(TiglCPACSConfigurationHandle cpacsHandle,
     return TIGL_ERROR;
 }
 
+TiglReturnCode tiglExportConfigurationToFiles(TiglCPACSConfigurationHandle cpacsHandle, const char **fileNames, int nFileNames,
+                                              TiglBoolean fuseAllShapes, double deflection)
+{
+    if (!fileNames) {
+        LOG(ERROR) << "Argument fileNames is NULL in tiglExportConfigurationToFiles!";
+        return TIGL_NULL_POINTER;
+    }
+
+    if (nFileNames < 1) {
+        LOG(ERROR) << "Argument nFileNames must be at least 1 in tiglExportConfigurationToFiles!";
+        return TIGL_INDEX_ERROR;
+    }
+
+    std::vector<std::string> files;
+    for (int i = 0; i < nFileNames; ++i) {
+        if (!fileNames[i]) {
+            LOG(ERROR) << "File name " << i << " is NULL in tiglExportConfigurationToFiles!";
+            return TIGL_NULL_POINTER;
+        }
+        files.push_back(fileNames[i]);
+    }
+
+    try {
+        const tigl::CCPACSConfigurationManager& manager = tigl::CCPACSConfigurationManager::GetInstance();
+        tigl::CCPACSConfiguration& config = manager.GetConfiguration(cpacsHandle);
+
+        bool success = tigl::ExportConfigurationToFiles(config, files, fuseAllShapes == TIGL_TRUE, deflection);
+        return success ? TIGL_SUCCESS : TIGL_WRITE_FAILED;
+    }
+    catch (const tigl::CTiglError& ex) {
+        LOG(ERROR) << "In tiglExportConfigurationToFiles: " << ex.what();
+        return ex.getCode();
+    }
+    catch (std::exception& ex) {
+        LOG(ERROR) << "In tiglExportConfigurationToFiles: " << ex.what();
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an exception in tiglExportConfigurationToFiles!";
+    }
+    return TIGL_ERROR;
+}
+
 TiglReturnCode tiglConfigurationGetBoundingBox(TiglCPACSConfigurationHandle cpacsHandle, double *minX, double *minY, double *minZ, double *maxX, double *maxY, double *maxZ)
 {
     if (!minX) {
@@ -397,6 +397,33 @@ enum TiglGetPointBehavior {
 
 typedef enum TiglGetPointBehavior TiglGetPointBehavior;
 
+/**
+* @brief Glue modes of the aircraft fuse, which speed up fusing components that only touch each other.
+*
+*  - TIGL_GLUE_OFF: The components intersect each other in a general way (default).
+*  - TIGL_GLUE_SHIFT: The components touch or overlap, but their faces do not intersect each other.
+*  - TIGL_GLUE_FULL: The components only share coinciding faces, edges or vertices.
+*
+* See also ::tiglConfigurationSetFuseOptions.
+*/
+enum TiglFuseGlueMode {
+    TIGL_GLUE_OFF   = 0,
+    TIGL_GLUE_SHIFT = 1,
+    TIGL_GLUE_FULL  = 2
+};
+
+typedef enum TiglFuseGlueMode TiglFuseGlueMode;
+
+/**
+* @brief Progress callback of long running operations, e.g. the aircraft fuse.
+*
+* The callback receives the progress in the range [0, 1] and the user data pointer
+* passed when registering the callback. Returning TIGL_FALSE cancels the operation.
+*
+* See also ::tiglConfigurationSetFuseProgressCallback.
+*/
+typedef TiglBoolean (*TiglProgressCallback)(double progress, void* userData);
+
 /**
   \defgroup GeneralFunctions General TIGL handling functions
     Function to open, create, and close CPACS-files.
@@ -490,6 +517,30 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglIsCPACSConfigurationHandleValid(TiglCPACSC
 */
 TIGL_COMMON_EXPORT const char* tiglGetVersion();
 
+/**
+* @brief Enables the persistent geometry cache.
+*
+* If a cache directory is set, the lofts of wings and fuselages are stored in this directory
+* in binary BRep format. Any process opening the same CPACS data later on loads the lofts from
+* the cache directory instead of building them again. The cache entries are identified by a hash
+* of the CPACS description of the component and all CPACS elements referenced by the component.
+* Hence, the directory can be shared by several processes and different CPACS files.
+*
+* Note: The hash is computed from the TIXI document of the configuration. If the configuration
+* is modified in memory, it must be written back with ::tiglSaveCPACSConfiguration before
+* lofts are requested, otherwise outdated lofts might be loaded from the cache.
+*
+* @param[in]  directory Path to the cache directory. It is created, if it does not exist.
+*                       Pass an empty string to disable the cache, which is the default.
+*
+* @return
+*   - TIGL_SUCCESS if no error occurred
+*   - TIGL_NULL_POINTER if directory is NULL
+*   - TIGL_OPEN_FAILED if the directory could not be created
+*   - TIGL_ERROR if some other error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglSetGeometryCacheDirectory(const char* directory);
+
 
 /*@}*/
 /*****************************************************************************************************/
@@ -707,6 +758,94 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglWingGetLowerPoint(TiglCPACSConfigurationHa
                                                         double* pointYPtr,
                                                         double* pointZPtr);
 
+/**
+* @brief Returns multiple points on the upper wing surface for a
+* a given wing and segment index.
+*
+* This is the array version of ::tiglWingGetUpperPoint. For each pair eta[i], xsi[i], the
+* point on the upper wing surface is returned in x[i], y[i], z[i] in absolute world coordinates.
+* The segment surface and the transformations are computed only once and the points are
+* evaluated in parallel. Hence, this function is much faster than calling ::tiglWingGetUpperPoint
+* for many points.
+*
+* The behavior of this function can be modified using ::tiglWingSetGetPointBehavior.
+*
+*
+* @param[in]  cpacsHandle  Handle for the CPACS configuration
+* @param[in]  wingIndex    The index of the wing, starting at 1
+* @param[in]  segmentIndex The index of the segment of the wing, starting at 1
+* @param[in]  nPoints      Number of points to evaluate, i.e. the size of the arrays eta, xsi, x, y and z
+* @param[in]  eta          Array of eta values in the range 0.0 <= eta <= 1.0
+* @param[in]  xsi          Array of xsi values in the range 0.0 <= xsi <= 1.0
+* @param[out] x            Array of the x-coordinates of the points in absolute world coordinates
+* @param[out] y            Array of the y-coordinates of the points in absolute world coordinates
+* @param[out] z            Array of the z-coordinates of the points in absolute world coordinates
+*
+* @cond
+* #annotate in: 4A(3), 5A(3) out: 6AM(3), 7AM(3), 8AM(3)#
+* @endcond
+*
+* @return
+*   - TIGL_SUCCESS if all points were computed
+*   - TIGL_NOT_FOUND if the cpacs handle is not valid
+*   - TIGL_INDEX_ERROR if wingIndex or segmentIndex are not valid
+*   - TIGL_NULL_POINTER if eta, xsi, x, y or z are null pointers
+*   - TIGL_ERROR if nPoints is negative, an eta or xsi value is out of range or some other error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglWingGetUpperPoints(TiglCPACSConfigurationHandle cpacsHandle,
+                                                         int wingIndex,
+                                                         int segmentIndex,
+                                                         int nPoints,
+                                                         const double* eta,
+                                                         const double* xsi,
+                                                         double* x,
+                                                         double* y,
+                                                         double* z);
+
+/**
+* @brief Returns multiple points on the lower wing surface for a
+* a given wing and segment index.
+*
+* This is the array version of ::tiglWingGetLowerPoint. For each pair eta[i], xsi[i], the
+* point on the lower wing surface is returned in x[i], y[i], z[i] in absolute world coordinates.
+* The segment surface and the transformations are computed only once and the points are
+* evaluated in parallel. Hence, this function is much faster than calling ::tiglWingGetLowerPoint
+* for many points.
+*
+* The behavior of this function can be modified using ::tiglWingSetGetPointBehavior.
+*
+*
+* @param[in]  cpacsHandle  Handle for the CPACS configuration
+* @param[in]  wingIndex    The index of the wing, starting at 1
+* @param[in]  segmentIndex The index of the segment of the wing, starting at 1
+* @param[in]  nPoints      Number of points to evaluate, i.e. the size of the arrays eta, xsi, x, y and z
+* @param[in]  eta          Array of eta values in the range 0.0 <= eta <= 1.0
+* @param[in]  xsi          Array of xsi values in the range 0.0 <= xsi <= 1.0
+* @param[out] x            Array of the x-coordinates of the points in absolute world coordinates
+* @param[out] y            Array of the y-coordinates of the points in absolute world coordinates
+* @param[out] z            Array of the z-coordinates of the points in absolute world coordinates
+*
+* @cond
+* #annotate in: 4A(3), 5A(3) out: 6AM(3), 7AM(3), 8AM(3)#
+* @endcond
+*
+* @return
+*   - TIGL_SUCCESS if all points were computed
+*   - TIGL_NOT_FOUND if the cpacs handle is not valid
+*   - TIGL_INDEX_ERROR if wingIndex or segmentIndex are not valid
+*   - TIGL_NULL_POINTER if eta, xsi, x, y or z are null pointers
+*   - TIGL_ERROR if nPoints is negative, an eta or xsi value is out of range or some other error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglWingGetLowerPoints(TiglCPACSConfigurationHandle cpacsHandle,
+                                                         int wingIndex,
+                                                         int segmentIndex,
+                                                         int nPoints,
+                                                         const double* eta,
+                                                         const double* xsi,
+                                                         double* x,
+                                                         double* y,
+                                                         double* z);
+
 /**
 @brief Sets the behavior of the ::tiglWingGetUpperPoint and ::tiglWingGetLowerPoint functions.
 *
@@ -2181,6 +2320,47 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglFuselageGetPointAngleTranslated(TiglCPACSC
                                                                       double* pointXPtr,
                                                                       double* pointYPtr,
                                                                       double* pointZPtr);
+
+/**
+* @brief Returns multiple points on a fuselage surface for a given fuselage and segment index,
+* one for each angle alpha (degree) at the same eta.
+*
+* This is the array version of ::tiglFuselageGetPointAngle. For each angle alpha[i], the point
+* is returned in x[i], y[i], z[i] in absolute world coordinates. The cross section at eta
+* is computed only once and cached, hence this function is much faster than calling
+* ::tiglFuselageGetPointAngle for many angles.
+*
+*
+* @param[in]  cpacsHandle   Handle for the CPACS configuration
+* @param[in]  fuselageIndex The index of the fuselage, starting at 1
+* @param[in]  segmentIndex  The index of the segment of the fuselage, starting at 1
+* @param[in]  eta           Eta in the range 0.0 <= eta <= 1.0
+* @param[in]  nAngles       Number of angles, i.e. the size of the arrays alpha, x, y and z
+* @param[in]  alpha         Array of angles in degrees. No range restrictions.
+* @param[out] x             Array of the x-coordinates of the points in absolute world coordinates
+* @param[out] y             Array of the y-coordinates of the points in absolute world coordinates
+* @param[out] z             Array of the z-coordinates of the points in absolute world coordinates
+*
+* @cond
+* #annotate in: 5A(4) out: 6AM(4), 7AM(4), 8AM(4)#
+* @endcond
+*
+* @return
+*   - TIGL_SUCCESS if all points were found
+*   - TIGL_NOT_FOUND if the cpacs handle is not valid
+*   - TIGL_INDEX_ERROR if fuselageIndex or segmentIndex are not valid
+*   - TIGL_NULL_POINTER if alpha, x, y or z are null pointers
+*   - TIGL_ERROR if nAngles is negative, no point was found for one of the angles or some other error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglFuselageGetPointsAngle(TiglCPACSConfigurationHandle cpacsHandle,
+                                                             int fuselageIndex,
+                                                             int segmentIndex,
+                                                             double eta,
+                                                             int nAngles,
+                                                             const double* alpha,
+                                                             double* x,
+                                                             double* y,
+                                                             double* z);
       
 
 
@@ -2318,6 +2498,156 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglFuselageGetNumPointsOnYPlane(TiglCPACSConf
                                                                    double eta,
                                                                    double ypos,
                                                                    int* numPointsPtr);
+
+
+/**
+* @brief Returns the number of intersection points of a fuselage segment cross section with multiple cutting planes.
+*
+* For each position xpos[i], the number of points of the cross section at eta on the cutting plane of
+* ::tiglFuselageGetPointOnXPlane is returned in numPoints[i]. The points itself can be queried with
+* ::tiglFuselageGetPointsOnXPlanes.
+*
+* @param[in]  cpacsHandle   Handle for the CPACS configuration
+* @param[in]  fuselageIndex The index of the fuselage, starting at 1
+* @param[in]  segmentIndex  The index of the segment of the fuselage, starting at 1
+* @param[in]  eta           eta in the range 0.0 <= eta <= 1.0
+* @param[in]  nPlanes       Number of cutting planes, i.e. the size of the arrays xpos and numPoints
+* @param[in]  xpos          Positions of the cutting planes
+* @param[out] numPoints     Number of intersection points for each plane
+*
+* @cond
+* #annotate in: 5A(4) out: 6AM(4)#
+* @endcond
+*
+* @return
+*   - TIGL_SUCCESS if no error occurred
+*   - TIGL_NOT_FOUND if the cpacs handle is not valid
+*   - TIGL_INDEX_ERROR if fuselageIndex or segmentIndex are not valid
+*   - TIGL_NULL_POINTER if xpos or numPoints are null pointers
+*   - TIGL_ERROR if nPlanes is negative or some other error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglFuselageGetNumPointsOnXPlanes(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                    int fuselageIndex,
+                                                                    int segmentIndex,
+                                                                    double eta,
+                                                                    int nPlanes,
+                                                                    const double* xpos,
+                                                                    int* numPoints);
+
+/**
+* @brief Returns the number of intersection points of a fuselage segment cross section with multiple y-planes.
+*
+* For each position ypos[i], the number of points of the cross section at eta on the plane y = ypos[i]
+* is returned in numPoints[i]. The points itself can be queried with ::tiglFuselageGetPointsOnYPlanes.
+*
+* @param[in]  cpacsHandle   Handle for the CPACS configuration
+* @param[in]  fuselageIndex The index of the fuselage, starting at 1
+* @param[in]  segmentIndex  The index of the segment of the fuselage, starting at 1
+* @param[in]  eta           eta in the range 0.0 <= eta <= 1.0
+* @param[in]  nPlanes       Number of cutting planes, i.e. the size of the arrays ypos and numPoints
+* @param[in]  ypos          Y positions of the cutting planes
+* @param[out] numPoints     Number of intersection points for each plane
+*
+* @cond
+* #annotate in: 5A(4) out: 6AM(4)#
+* @endcond
+*
+* @return
+*   - TIGL_SUCCESS if no error occurred
+*   - TIGL_NOT_FOUND if the cpacs handle is not valid
+*   - TIGL_INDEX_ERROR if fuselageIndex or segmentIndex are not valid
+*   - TIGL_NULL_POINTER if ypos or numPoints are null pointers
+*   - TIGL_ERROR if nPlanes is negative or some other error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglFuselageGetNumPointsOnYPlanes(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                    int fuselageIndex,
+                                                                    int segmentIndex,
+                                                                    double eta,
+                                                                    int nPlanes,
+                                                                    const double* ypos,
+                                                                    int* numPoints);
+
+/**
+* @brief Returns all intersection points of a fuselage segment cross section with multiple cutting planes.
+*
+* This is the array version of ::tiglFuselageGetPointOnXPlane. The points of all planes are returned in a
+* single call, ordered by plane: The first numPoints[0] points belong to xpos[0], the next numPoints[1]
+* points to xpos[1] and so on, where numPoints must be queried with ::tiglFuselageGetNumPointsOnXPlanes.
+* The cross section at eta is computed only once and cached.
+*
+* @param[in]  cpacsHandle   Handle for the CPACS configuration
+* @param[in]  fuselageIndex The index of the fuselage, starting at 1
+* @param[in]  segmentIndex  The index of the segment of the fuselage, starting at 1
+* @param[in]  eta           eta in the range 0.0 <= eta <= 1.0
+* @param[in]  nPlanes       Number of cutting planes, i.e. the size of the array xpos
+* @param[in]  xpos          Positions of the cutting planes
+* @param[in]  nPoints       Total number of intersection points, i.e. the size of the arrays x, y and z
+* @param[out] x             Array of the x-coordinates of the points in absolute world coordinates
+* @param[out] y             Array of the y-coordinates of the points in absolute world coordinates
+* @param[out] z             Array of the z-coordinates of the points in absolute world coordinates
+*
+* @cond
+* #annotate in: 5A(4) out: 7AM(6), 8AM(6), 9AM(6)#
+* @endcond
+*
+* @return
+*   - TIGL_SUCCESS if no error occurred
+*   - TIGL_NOT_FOUND if the cpacs handle is not valid
+*   - TIGL_INDEX_ERROR if fuselageIndex or segmentIndex are not valid
+*   - TIGL_NULL_POINTER if xpos, x, y or z are null pointers
+*   - TIGL_ERROR if nPoints does not match the number of intersection points or some other error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglFuselageGetPointsOnXPlanes(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                 int fuselageIndex,
+                                                                 int segmentIndex,
+                                                                 double eta,
+                                                                 int nPlanes,
+                                                                 const double* xpos,
+                                                                 int nPoints,
+                                                                 double* x,
+                                                                 double* y,
+                                                                 double* z);
+
+/**
+* @brief Returns all intersection points of a fuselage segment cross section with multiple y-planes.
+*
+* This is the array version of ::tiglFuselageGetPointOnYPlane. The points of all planes are returned in a
+* single call, ordered by plane: The first numPoints[0] points belong to ypos[0], the next numPoints[1]
+* points to ypos[1] and so on, where numPoints must be queried with ::tiglFuselageGetNumPointsOnYPlanes.
+* The cross section at eta is computed only once and cached.
+*
+* @param[in]  cpacsHandle   Handle for the CPACS configuration
+* @param[in]  fuselageIndex The index of the fuselage, starting at 1
+* @param[in]  segmentIndex  The index of the segment of the fuselage, starting at 1
+* @param[in]  eta           eta in the range 0.0 <= eta <= 1.0
+* @param[in]  nPlanes       Number of cutting planes, i.e. the size of the array ypos
+* @param[in]  ypos          Y positions of the cutting planes
+* @param[in]  nPoints       Total number of intersection points, i.e. the size of the arrays x, y and z
+* @param[out] x             Array of the x-coordinates of the points in absolute world coordinates
+* @param[out] y             Array of the y-coordinates of the points in absolute world coordinates
+* @param[out] z             Array of the z-coordinates of the points in absolute world coordinates
+*
+* @cond
+* #annotate in: 5A(4) out: 7AM(6), 8AM(6), 9AM(6)#
+* @endcond
+*
+* @return
+*   - TIGL_SUCCESS if no error occurred
+*   - TIGL_NOT_FOUND if the cpacs handle is not valid
+*   - TIGL_INDEX_ERROR if fuselageIndex or segmentIndex are not valid
+*   - TIGL_NULL_POINTER if ypos, x, y or z are null pointers
+*   - TIGL_ERROR if nPoints does not match the number of intersection points or some other error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglFuselageGetPointsOnYPlanes(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                 int fuselageIndex,
+                                                                 int segmentIndex,
+                                                                 double eta,
+                                                                 int nPlanes,
+                                                                 const double* ypos,
+                                                                 int nPoints,
+                                                                 double* x,
+                                                                 double* y,
+                                                                 double* z);
         
 
 /**
@@ -3502,6 +3832,12 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglRotorBladeGetLocalTwistAngle(TiglCPACSConf
     
     Currently only wings, wing segments, fuselages, and fuselage segments can be used
     in the intersection routines.
+
+    The intersection results are stored in a cache of the configuration, which is bounded
+    by a memory budget (see ::tiglIntersectSetCacheMemoryBudget). If the budget is exceeded,
+    the least recently used results are evicted and their intersection IDs expire.
+    Functions called with an expired intersection ID return TIGL_NOT_FOUND. In this case,
+    the intersection has to be computed again.
  */
 /*@{*/
 
@@ -3762,6 +4098,70 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglGetCurveParameter (TiglCPACSConfigurationH
                                                          double pointZ,
                                                          double* eta);
 
+/**
+* @brief Configures the boolean fuse of the whole aircraft, which is used e.g. by
+* the fused exports and ::tiglGetCrossSectionArea.
+*
+* Changing the options discards a previously fused aircraft.
+*
+* @param[in] cpacsHandle Handle for the CPACS configuration
+* @param[in] runParallel If TIGL_TRUE, the boolean operation uses multiple threads (default)
+* @param[in] fuzzyValue  Additional tolerance of the boolean operation. Components that are
+*                        closer than this tolerance are treated as touching. Use 0 to disable (default).
+* @param[in] glueMode    Glue mode for components that only touch each other (default: TIGL_GLUE_OFF)
+*
+* @return
+*   - TIGL_SUCCESS if no error occurred
+*   - TIGL_NOT_FOUND if the cpacs handle is not valid
+*   - TIGL_INVALID_VALUE if fuzzyValue is negative or glueMode is invalid
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglConfigurationSetFuseOptions(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                  TiglBoolean runParallel,
+                                                                  double fuzzyValue,
+                                                                  TiglFuseGlueMode glueMode);
+
+/**
+* @brief Registers a callback, which reports the progress of the aircraft fuse.
+*
+* The callback is called with the progress in the range [0, 1]. If the callback returns
+* TIGL_FALSE, the fuse is cancelled and the function that requested the fused aircraft
+* fails with TIGL_ERROR.
+*
+* The callback is only called from the thread that requested the fused aircraft, also
+* if the boolean operation runs in parallel (see ::tiglConfigurationSetFuseOptions).
+* The progress of the worker threads is reported with the next update on this thread.
+*
+* @param[in] cpacsHandle Handle for the CPACS configuration
+* @param[in] callback    The progress callback. Use NULL to remove the callback.
+* @param[in] userData    Pointer passed to each call of the callback, may be NULL
+*
+* @return
+*   - TIGL_SUCCESS if no error occurred
+*   - TIGL_NOT_FOUND if the cpacs handle is not valid
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglConfigurationSetFuseProgressCallback(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                           TiglProgressCallback callback,
+                                                                           void* userData);
+
+/**
+* @brief Sets the memory budget of the intersection cache of the configuration.
+*
+* The results of ::tiglIntersectComponents, ::tiglIntersectWithPlane and
+* ::tiglIntersectWithPlaneSegment are cached. If the approximate memory consumption
+* of the cached results exceeds the budget, the least recently used results are evicted
+* and their intersection IDs become invalid. The default budget is 512 MB.
+*
+* @param[in] cpacsHandle Handle for the CPACS configuration
+* @param[in] budgetInMB  Memory budget in megabytes. A budget of 0 disables the limit.
+*
+* @return
+*   - TIGL_SUCCESS if no error occurred
+*   - TIGL_NOT_FOUND if the cpacs handle is not valid
+*   - TIGL_INVALID_VALUE if budgetInMB is negative
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglIntersectSetCacheMemoryBudget(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                    int budgetInMB);
+
 
 
 /*@}*/
@@ -3848,7 +4248,7 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglGetCurveParameter (TiglCPACSConfigurationH
   tiglSetExportOptions("iges", "ApplySymmetries", "true");
   @endverbatim
 * 
-* @param[in] exporter_name File format of the export. E.g. "vtk", "iges", "step", "collada", "brep" or "stl"
+* @param[in] exporter_name File format of the export. E.g. "vtk", "iges", "step", "collada", "brep", "stl" or "glb"
 * @param[in] option_name   Name of the option to be set
 * @param[in] option_value  Value of the options to be set
 *
@@ -3868,7 +4268,7 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglSetExportOptions(const char* exporter_name
 * 
 * The export can be configured in more detail using ::tiglSetExportOptions.
 * 
-* Supported file formats are: STEP (*.stp), IGES (*.igs), VTK (*.vtp), Collada (*.dae), STL (*.stl) and BREP (*.brep)
+* Supported file formats are: STEP (*.stp), IGES (*.igs), VTK (*.vtp), Collada (*.dae), STL (*.stl), glTF (*.glb) and BREP (*.brep)
 * 
 * Example: Export a wing to IGES format
   @verbatim
@@ -3902,7 +4302,7 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglExportComponent(TiglCPACSConfigurationHand
 * 
 * The export can be configured in more detail using ::tiglSetExportOptions.
 * 
-* Supported file formats are: STEP (*.stp), IGES (*.igs), VTK (*.vtp), Collada (*.dae), STL (*.stl) and BREP (*.brep)
+* Supported file formats are: STEP (*.stp), IGES (*.igs), VTK (*.vtp), Collada (*.dae), STL (*.stl), glTF (*.glb) and BREP (*.brep)
 * 
 * Example: Export the fused configuration to STEP format
   @verbatim
@@ -3927,6 +4327,42 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglExportConfiguration(TiglCPACSConfiguration
                                                           double deflection);
 
 
+/**
+* @brief Exports the whole configuration into several files of different formats at once.
+* 
+* This is equivalent to calling ::tiglExportConfiguration for each file, but the configuration
+* is meshed only once for all meshed formats (e.g. VTK, STL, Collada) with the same deflection.
+* The export format of each file is specified by its extension.
+* 
+* The exports can be configured in more detail using ::tiglSetExportOptions.
+* 
+* Example: Export the configuration to VTK, STL and Collada
+  @verbatim
+  const char* files[] = {"aircraft.vtp", "aircraft.stl", "aircraft.dae"};
+  tiglExportConfigurationToFiles(handle, files, 3, TIGL_FALSE, 0.01);
+  @endverbatim
+*
+* @param[in] cpacsHandle   Handle for the CPACS configuration
+* @param[in] fileNames     Array of the file names of the exported files
+* @param[in] nFileNames    Number of file names
+* @param[in] fuseAllShapes Whether to fuse the geometry of not. Fusing can take a lot of time!
+* @param[in] deflection    Deflection parameter. This is only used for meshed exports (e.g. VTK, STL, Collada).
+*
+* @return 
+*   - TIGL_SUCCESS if no error occurred
+*   - TIGL_NOT_FOUND if no exporter is found for one of the file names
+*   - TIGL_NULL_POINTER if fileNames or one of the file names is a null pointer
+*   - TIGL_INDEX_ERROR if nFileNames is smaller than one
+*   - TIGL_WRITE_FAILED if one of the files could not be written
+*   - TIGL_ERROR if some other error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglExportConfigurationToFiles(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                 const char** fileNames,
+                                                                 int nFileNames,
+                                                                 TiglBoolean fuseAllShapes,
+                                                                 double deflection);
+
+
 /**
 * @brief Exports the geometry of a CPACS configuration to IGES format.
 *
@@ -5063,6 +5499,45 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglCheckPointInside(TiglCPACSConfigurationHan
                                                        const char* componentUID,
                                                        TiglBoolean* isInside);
 
+/**
+ * @brief Checks for multiple points, whether they lie inside the given geometric object.
+ * Note that the symmetry attribute is ignored.
+ *
+ * This is the array version of ::tiglCheckPointInside. The component is triangulated
+ * once and the points are classified in parallel. Only points close to the surface
+ * are classified with the exact (and slow) algorithm. The triangulation is kept
+ * for subsequent calls with the same component. Hence, this function is much faster than calling
+ * ::tiglCheckPointInside for many points.
+ *
+ * This function works only for solid objects!
+ *
+ * @param[in]  cpacsHandle   Handle for the CPACS configuration
+ * @param[in]  componentUID  UID of the component (e.g. a fuselage UID, wing UID, wing segment UID ...)
+ * @param[in]  nPoints       Number of points, i.e. the size of the arrays px, py, pz and isInside
+ * @param[in]  px            Array of the X coordinates of the points
+ * @param[in]  py            Array of the Y coordinates of the points
+ * @param[in]  pz            Array of the Z coordinates of the points
+ * @param[out] isInside      Array, that returns for each point, whether it lies inside the object or not.
+ *
+ * @cond
+ * #annotate in: 3A(2), 4A(2), 5A(2) out: 6AM(2)#
+ * @endcond
+ *
+ * @return
+ *   - TIGL_SUCCESS if no error occurred.
+ *   - TIGL_NOT_FOUND if no configuration was found for the given handle.
+ *   - TIGL_UID_ERROR if the component does not exist or is not a geometric object.
+ *   - TIGL_NULL_POINTER if componentUID, px, py, pz or isInside are null.
+ *   - TIGL_ERROR if some error occurred, e.g. the component is not a solid object or nPoints is negative.
+ */
+TIGL_COMMON_EXPORT TiglReturnCode tiglCheckPointsInside(TiglCPACSConfigurationHandle cpacsHandle,
+                                                        const char* componentUID,
+                                                        int nPoints,
+                                                        const double* px,
+                                                        const double* py,
+                                                        const double* pz,
+                                                        TiglBoolean* isInside);
+
 /**
 * @brief Returns a unique HashCode for a geometric component. 
 * 
@@ -597,6 +597,66 @@ ListPNamedShape GroupFaces(const PNamedShape shape, tigl::ShapeGroupMode groupTy
     return shapeList;
 }
 
+std::string GetComponentUIDOfFace(const PNamedShape shape, unsigned int iFace)
+{
+    const CFaceTraits& traits = shape->GetFaceTraits(iFace);
+    if (!traits.ComponentUID().empty()) {
+        return traits.ComponentUID();
+    }
+    else if (traits.Origin()) {
+        return traits.Origin()->Name();
+    }
+    else {
+        return shape->Name();
+    }
+}
+
+ListPNamedShape GroupFacesByComponent(const PNamedShape shape)
+{
+    ListPNamedShape shapeList;
+    if (!shape) {
+        return shapeList;
+    }
+
+    TopTools_IndexedMapOfShape faceMap;
+    TopExp::MapShapes(shape->Shape(), TopAbs_FACE, faceMap);
+
+    // the components in the order of their first face
+    std::vector<std::string> uids;
+    std::vector<std::vector<int> > faceIndices;
+    for (int iface = 1; iface <= faceMap.Extent(); ++iface) {
+        std::string uid = GetComponentUIDOfFace(shape, iface-1);
+        size_t igroup = std::find(uids.begin(), uids.end(), uid) - uids.begin();
+        if (igroup == uids.size()) {
+            uids.push_back(uid);
+            faceIndices.push_back(std::vector<int>());
+        }
+        faceIndices[igroup].push_back(iface);
+    }
+
+    if (uids.size() <= 1) {
+        // return the shape as is
+        shapeList.push_back(shape);
+        return shapeList;
+    }
+
+    BRep_Builder b;
+    for (size_t igroup = 0; igroup < uids.size(); ++igroup) {
+        TopoDS_Compound c;
+        b.MakeCompound(c);
+        for (int iface : faceIndices[igroup]) {
+            b.Add(c, faceMap(iface));
+        }
+
+        PNamedShape groupShape(new CNamedShape(c, uids[igroup]));
+        for (size_t i = 0; i < faceIndices[igroup].size(); ++i) {
+            groupShape->SetFaceTraits(static_cast<int>(i), shape->GetFaceTraits(faceIndices[igroup][i]-1));
+        }
+        shapeList.push_back(groupShape);
+    }
+    return shapeList;
+}
+
 // projects a point onto the line (lineStart<->lineStop) and returns the projection parameter
 Standard_Real ProjectPointOnLine(gp_Pnt p, gp_Pnt lineStart, gp_Pnt lineStop)
 {
@@ -2046,6 +2106,48 @@ bool IsPointAbovePlane(const gp_Pln& pln, gp_Pnt point)
     return gp_Vec(pln.Location(), point).Dot(gp_Vec(pln.Axis().Direction())) > 0;
 }
 
+bool IsSymmetricToXZPlane(const TopoDS_Shape& shape, double tolerance, int nSamplesPerDirection)
+{
+    if (shape.IsNull() || nSamplesPerDirection < 1) {
+        return false;
+    }
+
+    BRepExtrema_DistShapeShape extrema;
+    extrema.LoadS2(shape);
+
+    for (TopExp_Explorer faceExp(shape, TopAbs_FACE); faceExp.More(); faceExp.Next()) {
+        const TopoDS_Face& face = TopoDS::Face(faceExp.Current());
+        Handle(Geom_Surface) surface = BRep_Tool::Surface(face);
+        if (surface.IsNull()) {
+            continue;
+        }
+
+        double umin, umax, vmin, vmax;
+        BRepTools::UVBounds(face, umin, umax, vmin, vmax);
+
+        for (int iu = 0; iu < nSamplesPerDirection; ++iu) {
+            for (int iv = 0; iv < nSamplesPerDirection; ++iv) {
+                double u = umin + (umax - umin) * (iu + 0.5) / nSamplesPerDirection;
+                double v = vmin + (vmax - vmin) * (iv + 0.5) / nSamplesPerDirection;
+
+                // skip samples in trimmed regions of the face
+                BRepClass_FaceClassifier classifier(face, gp_Pnt2d(u, v), Precision::PConfusion());
+                if (classifier.State() == TopAbs_OUT) {
+                    continue;
+                }
+
+                gp_Pnt p = surface->Value(u, v);
+                extrema.LoadS1(BRepBuilderAPI_MakeVertex(gp_Pnt(p.X(), -p.Y(), p.Z())).Vertex());
+                extrema.Perform();
+                if (!extrema.IsDone() || extrema.Value() > tolerance) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
 std::vector<double> LinspaceWithBreaks(double umin, double umax, size_t n_values, const std::vector<double>& breaks)
 {
     double du = (umax - umin) / static_cast<double>(n_values - 1);
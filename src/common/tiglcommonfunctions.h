@@ -193,6 +193,14 @@ TIGL_EXPORT gp_Pnt GetCentralFacePoint(const class TopoDS_Face& face);
 // Maps all compounds with its name in the map
 TIGL_EXPORT ListPNamedShape GroupFaces(const PNamedShape shape, tigl::ShapeGroupMode groupType);
 
+// returns the uid of the component a face belongs to. If the face traits contain no
+// component uid, the name of the face origin or of the shape is returned
+TIGL_EXPORT std::string GetComponentUIDOfFace(const PNamedShape shape, unsigned int iFace);
+
+// puts all faces with the same component uid into one TopoDS_Compound, named by the uid.
+// In contrast to GroupFaces, the faces are not sewed. A shape of a single component is returned as is.
+TIGL_EXPORT ListPNamedShape GroupFacesByComponent(const PNamedShape shape);
+
 TIGL_EXPORT TopoDS_Shape GetFacesByName(const PNamedShape shape, const std::string& name);
 
 // Returns the coordinates of the bounding box of the shape
@@ -229,6 +237,10 @@ TIGL_EXPORT bool IsPointInsideFace(const TopoDS_Face& face, gp_Pnt point);
 // Checks whether a point lies above or below a plane (determined by direction of normal)
 TIGL_EXPORT bool IsPointAbovePlane(const gp_Pln& pln, gp_Pnt point);
 
+// Checks, whether the shape is mirror symmetric to the x-z plane. Points sampled on
+// each face are mirrored and must not be farther away from the shape than the tolerance.
+TIGL_EXPORT bool IsSymmetricToXZPlane(const TopoDS_Shape& shape, double tolerance, int nSamplesPerDirection = 4);
+
 // Returns the single face contained in the passed shape
 // Throws an exception when number of faces != 1
 TIGL_EXPORT TopoDS_Face GetSingleFace(const TopoDS_Shape& shape);
@@ -0,0 +1,77 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef TIGLPARALLEL_H
+#define TIGLPARALLEL_H
+
+#include <atomic>
+#include <exception>
+#include <mutex>
+
+#include <OSD_Parallel.hxx>
+
+namespace tigl
+{
+
+/**
+ * @brief Calls func(i) for all i in [begin, end) using the OpenCASCADE thread pool.
+ *
+ * In contrast to OSD_Parallel::For, exceptions thrown by func are caught in the
+ * worker threads. The first exception is rethrown in the calling thread after all
+ * iterations are finished. If parallel is false, the loop is executed in
+ * the calling thread.
+ */
+template <typename Func>
+void ParallelFor(int begin, int end, const Func& func, bool parallel = true)
+{
+    if (end - begin < 2 || !parallel) {
+        for (int i = begin; i < end; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    std::exception_ptr firstError;
+    std::mutex errorMutex;
+    std::atomic<bool> failed(false);
+
+    auto guardedFunc = [&](int i) {
+        // skip the remaining iterations after an error
+        if (failed.load(std::memory_order_relaxed)) {
+            return;
+        }
+        try {
+            func(i);
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!firstError) {
+                firstError = std::current_exception();
+            }
+            failed = true;
+        }
+    };
+
+    OSD_Parallel::For(begin, end, guardedFunc);
+
+    if (firstError) {
+        std::rethrow_exception(firstError);
+    }
+}
+
+} // namespace tigl
+
+#endif // TIGLPARALLEL_H
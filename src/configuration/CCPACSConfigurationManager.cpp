@@ -21,6 +21,7 @@
 
 #include "CCPACSConfigurationManager.h"
 #include "CTiglError.h"
+#include "CTiglTessellationCache.h"
 
 namespace tigl
 {
@@ -85,6 +86,9 @@ void CCPACSConfigurationManager::DeleteConfiguration(TiglCPACSConfigurationHandl
     CCPACSConfiguration* config = iter->second;
     delete config;
     configurations.erase(iter);
+
+    // the cached triangulations keep the shapes of the configuration alive
+    CTiglTessellationCache::GetInstance().Clear();
 }
 
 // Returns the configuration for a given handle
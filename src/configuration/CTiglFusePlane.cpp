@@ -27,7 +27,9 @@
 #include "CCutShape.h"
 #include "CMergeShapes.h"
 #include "CTrimShape.h"
+#include "CTiglTransformation.h"
 #include "tiglcommonfunctions.h"
+#include "tiglparallel.h"
 
 #include <BOPAlgo_PaveFiller.hxx>
 #include <BRepAlgoAPI_Fuse.hxx>
@@ -35,25 +37,122 @@
 #include <BRepAlgoAPI_Cut.hxx>
 #include <BRepAlgoAPI_Common.hxx>
 #include <BRepBuilderAPI_MakeSolid.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRep_Builder.hxx>
+#include <Bnd_Box.hxx>
+#include <gp_Pnt.hxx>
+#include <Precision.hxx>
 #include <TopTools_ListOfShape.hxx>
 #include <TopTools_IndexedMapOfShape.hxx>
 #include <TopExp.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Shell.hxx>
+#include <TopoDS_Compound.hxx>
 #include <Standard_Version.hxx>
 #if OCC_VERSION_HEX < VERSION_HEX_CODE(7,3,0)
 #include <BOPCol_ListOfShape.hxx>
+#else
+#include <BOPAlgo_GlueEnum.hxx>
+#endif
+#if OCC_VERSION_HEX >= VERSION_HEX_CODE(7,5,0)
+#include <Message_ProgressIndicator.hxx>
+#include <Message_ProgressScope.hxx>
 #endif
 
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <string>
 #include <cassert>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+#if OCC_VERSION_HEX >= VERSION_HEX_CODE(7,5,0)
+// Forwards the progress of the boolean operation to the progress callback.
+// The callback is only called from the thread that created the indicator. The
+// progress of the worker threads is reported with the next update of this thread.
+class FuseProgressIndicator : public Message_ProgressIndicator
+{
+public:
+    explicit FuseProgressIndicator(const std::function<bool(double)>& callback)
+        : _callback(callback)
+        , _callerThread(std::this_thread::get_id())
+        , _lastPosition(-1.)
+        , _cancelled(false)
+    {
+    }
+
+    Standard_Boolean UserBreak() override
+    {
+        return _cancelled;
+    }
+
+protected:
+    // called by the base class with a locked mutex, also from worker threads
+    void Show(const Message_ProgressScope&, const Standard_Boolean isForce) override
+    {
+        // report in steps of 1 percent only
+        double position = GetPosition();
+        if (_cancelled || std::this_thread::get_id() != _callerThread || (!isForce && position - _lastPosition < 0.01)) {
+            return;
+        }
+        _lastPosition = position;
+        if (!_callback(position)) {
+            _cancelled = true;
+        }
+    }
+
+private:
+    std::function<bool(double)> _callback;
+    std::thread::id _callerThread;
+    double _lastPosition;
+    std::atomic<bool> _cancelled;
+};
+#endif
+
+#if OCC_VERSION_HEX >= VERSION_HEX_CODE(7,3,0)
+BOPAlgo_GlueEnum OcctGlueMode(TiglFuseGlueMode mode)
+{
+    switch (mode) {
+    case TIGL_GLUE_SHIFT:
+        return BOPAlgo_GlueShift;
+    case TIGL_GLUE_FULL:
+        return BOPAlgo_GlueFull;
+    default:
+        return BOPAlgo_GlueOff;
+    }
+}
+#endif
+
+#if OCC_VERSION_HEX >= VERSION_HEX_CODE(7,3,0)
+// boolean operations in non destructive mode can share their arguments between threads
+const bool kConcurrentBops = true;
+#else
+const bool kConcurrentBops = false;
+#endif
+
+void ThrowCancelled()
+{
+    throw tigl::CTiglError("The fuse of the aircraft was cancelled.", TIGL_ERROR);
+}
+
+} // namespace
 
 namespace tigl
 {
 
 CTiglFusePlane::CTiglFusePlane(CCPACSConfiguration& config)
     : _myconfig(config)
+    , _runParallel(true)
+    , _fuzzyValue(0.)
+    , _glueMode(TIGL_GLUE_OFF)
+    , _useSymmetry(true)
 {
     _mymode = HALF_PLANE;
     Invalidate();
@@ -67,6 +166,52 @@ void CTiglFusePlane::SetResultMode(TiglFuseResultMode mode)
     }
 }
 
+void CTiglFusePlane::SetRunParallel(bool parallel)
+{
+    // the result does not depend on the number of threads
+    _runParallel = parallel;
+}
+
+void CTiglFusePlane::SetFuzzyValue(double fuzzyValue)
+{
+    if (fuzzyValue < 0.) {
+        throw CTiglError("The fuzzy value must not be negative.", TIGL_INVALID_VALUE);
+    }
+    if (fuzzyValue != _fuzzyValue) {
+        Invalidate();
+        _fuzzyValue = fuzzyValue;
+    }
+}
+
+void CTiglFusePlane::SetGlueMode(TiglFuseGlueMode mode)
+{
+    if (mode != _glueMode) {
+        Invalidate();
+        _glueMode = mode;
+    }
+}
+
+void CTiglFusePlane::SetUseSymmetry(bool useSymmetry)
+{
+    if (useSymmetry != _useSymmetry) {
+        Invalidate();
+        _useSymmetry = useSymmetry;
+    }
+}
+
+void CTiglFusePlane::SetProgressCallback(const ProgressCallback& callback)
+{
+    _progressCallback = callback;
+}
+
+bool CTiglFusePlane::ReportProgress(double progress) const
+{
+    if (!_progressCallback) {
+        return true;
+    }
+    return _progressCallback(progress);
+}
+
 const PNamedShape CTiglFusePlane::FusedPlane()
 {
     Perform();
@@ -97,9 +242,8 @@ void CTiglFusePlane::Invalidate()
     _farfield.reset();
 }
 
-// Collects the loft (with mirror geometry merged in, if applicable) of every
-// component that makes up the aircraft's outer geometry.
-ListPNamedShape CTiglFusePlane::CollectComponentShapes() const
+// Collects every component that makes up the aircraft's outer geometry.
+std::vector<CTiglRelativelyPositionedComponent*> CTiglFusePlane::CollectComponents() const
 {
     std::vector<CTiglRelativelyPositionedComponent*> allComponents;
     const RelativeComponentContainerType& allRelComps = _myconfig.GetUIDManager().GetRelativeComponents();
@@ -114,6 +258,14 @@ ListPNamedShape CTiglFusePlane::CollectComponentShapes() const
             allComponents.push_back(it->second);
         }
     }
+    return allComponents;
+}
+
+// Collects the loft (with mirror geometry merged in, if applicable) of every
+// component that makes up the aircraft's outer geometry.
+ListPNamedShape CTiglFusePlane::CollectComponentShapes() const
+{
+    std::vector<CTiglRelativelyPositionedComponent*> allComponents = CollectComponents();
 
     ListPNamedShape compShapes;
     for (size_t i = 0; i < allComponents.size(); ++i) {
@@ -136,60 +288,85 @@ ListPNamedShape CTiglFusePlane::CollectComponentShapes() const
     return compShapes;
 }
 
+// Collects the shapes of the half model at y >= 0, if the configuration is symmetric
+// to the x-z plane. Components mirrored at the x-z plane must lie on one side of the
+// plane, all other components must be symmetric themselves, which is verified by
+// mirroring points sampled on their surfaces. The mirrored origins
+// map the shapes of the half model to their mirrored counterparts.
+bool CTiglFusePlane::CollectHalfModelShapes(ListPNamedShape& halfShapes, std::map<PNamedShape, PNamedShape>& mirroredOrigins) const
+{
+    std::vector<CTiglRelativelyPositionedComponent*> allComponents = CollectComponents();
+    for (size_t i = 0; i < allComponents.size(); ++i) {
+        CTiglRelativelyPositionedComponent* comp = allComponents[i];
+
+        PNamedShape loft = comp->GetLoft();
+        if (!loft) {
+            continue;
+        }
+
+        Bnd_Box box;
+        BRepBndLib::Add(loft->Shape(), box);
+        double xmin, ymin, zmin, xmax, ymax, zmax;
+        box.Get(xmin, ymin, zmin, xmax, ymax, zmax);
+        const double tolerance = Precision::Confusion() + 1e-6 * sqrt(box.SquareExtent());
+
+        TiglSymmetryAxis symmetry = comp->GetSymmetryAxis();
+        if (symmetry == TIGL_X_Z_PLANE && ymin >= -tolerance) {
+            PNamedShape mirrored = comp->GetMirroredLoft();
+            halfShapes.push_back(loft);
+            mirroredOrigins[loft] = mirrored;
+            continue;
+        }
+        if (symmetry == TIGL_X_Z_PLANE && ymax <= tolerance) {
+            PNamedShape mirrored = comp->GetMirroredLoft();
+            halfShapes.push_back(mirrored);
+            mirroredOrigins[mirrored] = loft;
+            continue;
+        }
+        // the symmetric bounding box is a cheap precheck, the mirrored
+        // surface samples must lie on the component as well
+        if (symmetry == TIGL_NO_SYMMETRY && fabs(ymin + ymax) <= 2. * tolerance &&
+            IsSymmetricToXZPlane(loft->Shape(), tolerance)) {
+            halfShapes.push_back(loft);
+            continue;
+        }
+
+        LOG(INFO) << "Component " << comp->GetDefaultedUID() << " is not symmetric to the x-z plane. "
+                  << "The full configuration is fused.";
+        return false;
+    }
+    return true;
+}
+
 void CTiglFusePlane::Perform()
 {
     if (_hasPerformed) {
         return;
     }
 
-    ListPNamedShape compShapes = CollectComponentShapes();
-
-    if (compShapes.empty()) {
-        _result.reset();
+    if (!ReportProgress(0.)) {
+        ThrowCancelled();
     }
-    else if (compShapes.size() == 1) {
-        _result = compShapes.front();
+
+    // symmetric configurations are fused as half model and mirrored
+    ListPNamedShape halfShapes;
+    std::map<PNamedShape, PNamedShape> mirroredOrigins;
+    bool isFullPlane = _mymode == FULL_PLANE || _mymode == FULL_PLANE_TRIMMED_FF;
+    if (isFullPlane && _useSymmetry && CollectHalfModelShapes(halfShapes, mirroredOrigins) && !halfShapes.empty()) {
+        _result = FuseMirroredHalfModel(halfShapes, mirroredOrigins);
     }
     else {
-        // Fuse all components in a single n-ary Boolean operation. Doing this
-        // pairwise/incrementally (fusing one component at a time into a running
-        // result) cannot correctly resolve genuine mutual intersections between
-        // three or more components (e.g. a fuselage, HTP and VTP that all meet
-        // in the same region): a single BOPAlgo pass over all arguments at once
-        // is required to consistently resolve such triple intersections.
-        TopTools_ListOfShape arguments, tools;
-        ListPNamedShape::const_iterator it = compShapes.begin();
-        arguments.Append((*it)->Shape());
-        for (++it; it != compShapes.end(); ++it) {
-            tools.Append((*it)->Shape());
-        }
+        ListPNamedShape compShapes = CollectComponentShapes();
 
-        BRepAlgoAPI_Fuse fuse;
-        fuse.SetArguments(arguments);
-        fuse.SetTools(tools);
-        fuse.Build();
-        if (!fuse.IsDone()) {
-            throw CTiglError("Error fusing aircraft components", TIGL_ERROR);
+        if (compShapes.empty()) {
+            _result.reset();
         }
-
-        PNamedShape fusedCompound(new CNamedShape(fuse.Shape(), "BOP_FUSE"));
-        for (ListPNamedShape::const_iterator cit = compShapes.begin(); cit != compShapes.end(); ++cit) {
-            CBooleanOperTools::MapFaceNamesAfterBOP(fuse, *cit, fusedCompound);
+        else if (compShapes.size() == 1) {
+            _result = compShapes.front();
         }
-
-        // BRepAlgoAPI_Fuse returns a TopoDS_COMPOUND wrapping the resulting
-        // shell(s); rebuild a genuine TopoDS_SOLID from them, as expected
-        // by exporters and other API consumers of the fused shape
-        BRepBuilderAPI_MakeSolid solidMaker;
-        TopTools_IndexedMapOfShape shellMap;
-        TopExp::MapShapes(fusedCompound->Shape(), TopAbs_SHELL, shellMap);
-        for (int ishell = 1; ishell <= shellMap.Extent(); ++ishell) {
-            solidMaker.Add(TopoDS::Shell(shellMap(ishell)));
+        else {
+            _result = FuseComponents(compShapes);
         }
-
-        PNamedShape fused(new CNamedShape(solidMaker.Solid(), _myconfig.GetUID().c_str()));
-        CBooleanOperTools::MapFaceNamesAfterBOP(solidMaker, fusedCompound, fused);
-        _result = fused;
     }
 
     CCPACSFarField& farfield = _myconfig.GetFarField();
@@ -197,6 +374,10 @@ void CTiglFusePlane::Perform()
         PNamedShape ff = farfield.GetLoft();
         assert(_result);
 
+        if (!ReportProgress(0.9)) {
+            ThrowCancelled();
+        }
+
 #if OCC_VERSION_HEX >= VERSION_HEX_CODE(7,3,0)
         TopTools_ListOfShape aLS;
 #else
@@ -207,6 +388,10 @@ void CTiglFusePlane::Perform()
 
         BOPAlgo_PaveFiller dsfill;
         dsfill.SetArguments(aLS);
+#if OCC_VERSION_HEX >= VERSION_HEX_CODE(7,3,0)
+        dsfill.SetRunParallel(_runParallel);
+        dsfill.SetFuzzyValue(_fuzzyValue);
+#endif
         dsfill.Perform();
         CTrimShape trim1(_result, ff, dsfill, INCLUDE);
         PNamedShape resulttrimmed = trim1.NamedShape();
@@ -222,6 +407,138 @@ void CTiglFusePlane::Perform()
         _result->SetShortName("AIRCRAFT");
     }
     _hasPerformed = true;
+
+    ReportProgress(1.);
+}
+
+// Fuses all components in a single n-ary Boolean operation. Doing this
+// pairwise/incrementally (fusing one component at a time into a running
+// result) cannot correctly resolve genuine mutual intersections between
+// three or more components (e.g. a fuselage, HTP and VTP that all meet
+// in the same region): a single BOPAlgo pass over all arguments at once
+// is required to consistently resolve such triple intersections.
+PNamedShape CTiglFusePlane::FuseComponents(const ListPNamedShape& compShapes) const
+{
+    TopTools_ListOfShape arguments, tools;
+    ListPNamedShape::const_iterator it = compShapes.begin();
+    arguments.Append((*it)->Shape());
+    for (++it; it != compShapes.end(); ++it) {
+        tools.Append((*it)->Shape());
+    }
+
+    BRepAlgoAPI_Fuse fuse;
+    fuse.SetArguments(arguments);
+    fuse.SetTools(tools);
+#if OCC_VERSION_HEX >= VERSION_HEX_CODE(7,3,0)
+    fuse.SetRunParallel(_runParallel);
+    fuse.SetFuzzyValue(_fuzzyValue);
+    fuse.SetGlue(OcctGlueMode(_glueMode));
+#else
+    if (_fuzzyValue > 0. || _glueMode != TIGL_GLUE_OFF) {
+        LOG(WARNING) << "Fuzzy and glue options of the fuse require OpenCASCADE 7.3 or newer.";
+    }
+#endif
+
+#if OCC_VERSION_HEX >= VERSION_HEX_CODE(7,5,0)
+    if (_progressCallback) {
+        // the boolean operation takes up to 90% of the progress, the rest is the far field trimming
+        Handle(FuseProgressIndicator) progress = new FuseProgressIndicator([this](double position) {
+            return ReportProgress(0.9 * position);
+        });
+        fuse.Build(progress->Start());
+        if (progress->UserBreak()) {
+            ThrowCancelled();
+        }
+    }
+    else {
+        fuse.Build();
+    }
+#else
+    fuse.Build();
+#endif
+    if (!fuse.IsDone()) {
+        throw CTiglError("Error fusing aircraft components", TIGL_ERROR);
+    }
+
+    PNamedShape fusedCompound(new CNamedShape(fuse.Shape(), "BOP_FUSE"));
+    for (ListPNamedShape::const_iterator cit = compShapes.begin(); cit != compShapes.end(); ++cit) {
+        CBooleanOperTools::MapFaceNamesAfterBOP(fuse, *cit, fusedCompound);
+    }
+
+    return MakeSolid(fusedCompound);
+}
+
+// Fuses the half model, trims it at the symmetry plane and glues the mirrored half to it.
+// The faces of the mirrored half refer to the mirrored components as in the full fuse.
+PNamedShape CTiglFusePlane::FuseMirroredHalfModel(const ListPNamedShape& halfShapes, const std::map<PNamedShape, PNamedShape>& mirroredOrigins) const
+{
+    PNamedShape fusedHalf = halfShapes.size() == 1 ? halfShapes.front() : FuseComponents(halfShapes);
+
+    // remove the parts of symmetric components at y < 0
+    Bnd_Box box;
+    BRepBndLib::Add(fusedHalf->Shape(), box);
+    double xmin, ymin, zmin, xmax, ymax, zmax;
+    box.Get(xmin, ymin, zmin, xmax, ymax, zmax);
+    TopoDS_Shape halfSpace = BRepPrimAPI_MakeBox(gp_Pnt(xmin - 1., 0., zmin - 1.), gp_Pnt(xmax + 1., std::max(ymax, 0.) + 1., zmax + 1.)).Shape();
+
+    BRepAlgoAPI_Common trimOp(fusedHalf->Shape(), halfSpace);
+    if (!trimOp.IsDone()) {
+        throw CTiglError("Error trimming the half model at the symmetry plane", TIGL_ERROR);
+    }
+    PNamedShape half(new CNamedShape(trimOp.Shape(), "HALF_MODEL"));
+    CBooleanOperTools::MapFaceNamesAfterBOP(trimOp, fusedHalf, half);
+
+    CTiglTransformation mirroring;
+    mirroring.AddMirroringAtXZPlane();
+    PNamedShape mirroredHalf = mirroring.Transform(half);
+    for (unsigned int iFace = 0; iFace < mirroredHalf->GetFaceCount(); ++iFace) {
+        CFaceTraits& traits = mirroredHalf->FaceTraits(iFace);
+        std::map<PNamedShape, PNamedShape>::const_iterator it = mirroredOrigins.find(traits.Origin());
+        if (it != mirroredOrigins.end()) {
+            traits.SetOrigin(it->second);
+        }
+    }
+
+    // the halves only share the faces in the symmetry plane, which are removed by the fuse
+    TopTools_ListOfShape arguments, tools;
+    arguments.Append(half->Shape());
+    tools.Append(mirroredHalf->Shape());
+
+    BRepAlgoAPI_Fuse glueOp;
+    glueOp.SetArguments(arguments);
+    glueOp.SetTools(tools);
+#if OCC_VERSION_HEX >= VERSION_HEX_CODE(7,3,0)
+    glueOp.SetRunParallel(_runParallel);
+    glueOp.SetFuzzyValue(_fuzzyValue);
+    glueOp.SetGlue(BOPAlgo_GlueShift);
+#endif
+    glueOp.Build();
+    if (!glueOp.IsDone()) {
+        throw CTiglError("Error fusing the mirrored half model", TIGL_ERROR);
+    }
+
+    PNamedShape fusedCompound(new CNamedShape(glueOp.Shape(), "BOP_FUSE"));
+    CBooleanOperTools::MapFaceNamesAfterBOP(glueOp, half, fusedCompound);
+    CBooleanOperTools::MapFaceNamesAfterBOP(glueOp, mirroredHalf, fusedCompound);
+
+    return MakeSolid(fusedCompound);
+}
+
+// BRepAlgoAPI_Fuse returns a TopoDS_COMPOUND wrapping the resulting
+// shell(s); rebuild a genuine TopoDS_SOLID from them, as expected
+// by exporters and other API consumers of the fused shape
+PNamedShape CTiglFusePlane::MakeSolid(const PNamedShape& fusedCompound) const
+{
+    BRepBuilderAPI_MakeSolid solidMaker;
+    TopTools_IndexedMapOfShape shellMap;
+    TopExp::MapShapes(fusedCompound->Shape(), TopAbs_SHELL, shellMap);
+    for (int ishell = 1; ishell <= shellMap.Extent(); ++ishell) {
+        solidMaker.Add(TopoDS::Shell(shellMap(ishell)));
+    }
+
+    PNamedShape fused(new CNamedShape(solidMaker.Solid(), _myconfig.GetUID().c_str()));
+    CBooleanOperTools::MapFaceNamesAfterBOP(solidMaker, fusedCompound, fused);
+    return fused;
 }
 
 // Computes the pairwise intersection curves between all components. This is
@@ -229,6 +546,8 @@ void CTiglFusePlane::Perform()
 // plays no role in the fused solid computed by Perform(); it is therefore
 // computed lazily; on request, since it is considerably more expensive than
 // the fuse itself (O(n^2) section + O(n^3) cut operations in the worst case).
+// Bounding boxes skip the sections and cuts of components that are apart,
+// and the sections of the component pairs are computed concurrently.
 void CTiglFusePlane::PerformIntersections()
 {
     if (_hasComputedIntersections) {
@@ -237,43 +556,95 @@ void CTiglFusePlane::PerformIntersections()
 
     ListPNamedShape compShapes = CollectComponentShapes();
 
+    // the boxes include the shape tolerances, such that only
+    // shapes without any common point are skipped
+    std::vector<Bnd_Box> boxes(compShapes.size());
+    ParallelFor(0, static_cast<int>(compShapes.size()), [&](int i) {
+        BRepBndLib::AddOptimal(compShapes[i]->Shape(), boxes[i], Standard_False, Standard_True);
+        boxes[i].Enlarge(Precision::Confusion());
+    });
+
+    std::vector<std::pair<size_t, size_t> > pairs;
+    for (size_t i = 0; i < compShapes.size(); ++i) {
+        for (size_t j = i + 1; j < compShapes.size(); ++j) {
+            pairs.push_back(std::make_pair(i, j));
+        }
+    }
+
     // Each curve is cut by every other component's shape, so that only the
     // part not buried inside a third component remains (e.g. the HTP-VTP
     // seam is trimmed away wherever it also lies inside the fuselage) --
     // otherwise these would show up as stray untrimmed wires in the export.
-    for (size_t i = 0; i < compShapes.size(); ++i) {
-        for (size_t j = i + 1; j < compShapes.size(); ++j) {
-            const PNamedShape& shape1 = compShapes[i];
-            const PNamedShape& shape2 = compShapes[j];
+    // A null shape marks a failed section.
+    std::vector<TopoDS_Shape> pairIntersections(pairs.size());
+    ParallelFor(0, static_cast<int>(pairs.size()), [&](int iPair) {
+        const size_t i = pairs[iPair].first;
+        const size_t j = pairs[iPair].second;
+
+        if (boxes[i].IsOut(boxes[j])) {
+            // the section of shapes without common points is empty
+            TopoDS_Compound empty;
+            BRep_Builder().MakeCompound(empty);
+            pairIntersections[iPair] = empty;
+            return;
+        }
 
-            BRepAlgoAPI_Section sectionOp(shape1->Shape(), shape2->Shape());
-            if (!sectionOp.IsDone()) {
-                continue;
-            }
+        // the components are shared by the concurrent operations and must not be modified
+        BRepAlgoAPI_Section sectionOp(compShapes[i]->Shape(), compShapes[j]->Shape(), Standard_False);
+#if OCC_VERSION_HEX >= VERSION_HEX_CODE(7,3,0)
+        sectionOp.SetNonDestructive(Standard_True);
+#endif
+        sectionOp.Build();
+        if (!sectionOp.IsDone()) {
+            return;
+        }
+
+        TopoDS_Shape intersection = sectionOp.Shape();
+        if (intersection.IsNull()) {
+            return;
+        }
 
-            TopoDS_Shape intersection = sectionOp.Shape();
-            if (intersection.IsNull()) {
+        // cutting only removes parts of the curves, so the initial box is sufficient
+        Bnd_Box intersectionBox;
+        BRepBndLib::Add(intersection, intersectionBox);
+        intersectionBox.Enlarge(Precision::Confusion());
+
+        for (size_t k = 0; k < compShapes.size() && !intersection.IsNull(); ++k) {
+            if (k == i || k == j || intersectionBox.IsVoid() || intersectionBox.IsOut(boxes[k])) {
                 continue;
             }
 
-            for (size_t k = 0; k < compShapes.size() && !intersection.IsNull(); ++k) {
-                if (k == i || k == j) {
-                    continue;
-                }
-                BRepAlgoAPI_Cut cutOp(intersection, compShapes[k]->Shape());
-                if (cutOp.IsDone()) {
-                    intersection = cutOp.Shape();
-                }
-            }
+            TopTools_ListOfShape arguments, tools;
+            arguments.Append(intersection);
+            tools.Append(compShapes[k]->Shape());
 
-            if (intersection.IsNull()) {
-                continue;
+            BRepAlgoAPI_Cut cutOp;
+            cutOp.SetArguments(arguments);
+            cutOp.SetTools(tools);
+#if OCC_VERSION_HEX >= VERSION_HEX_CODE(7,3,0)
+            cutOp.SetNonDestructive(Standard_True);
+#endif
+            cutOp.Build();
+            if (cutOp.IsDone()) {
+                intersection = cutOp.Shape();
             }
+        }
+
+        pairIntersections[iPair] = intersection;
+    }, kConcurrentBops);
 
-            PNamedShape intersectionShape(new CNamedShape(intersection, std::string("INT" + shape1->Name() + shape2->Name()).c_str()));
-            intersectionShape->SetShortName(std::string("INT" + shape1->ShortName() + shape2->ShortName()).c_str());
-            _intersections.push_back(intersectionShape);
+    // the intersections are added in the order of the pairs
+    for (size_t iPair = 0; iPair < pairs.size(); ++iPair) {
+        const TopoDS_Shape& intersection = pairIntersections[iPair];
+        if (intersection.IsNull()) {
+            continue;
         }
+
+        const PNamedShape& shape1 = compShapes[pairs[iPair].first];
+        const PNamedShape& shape2 = compShapes[pairs[iPair].second];
+        PNamedShape intersectionShape(new CNamedShape(intersection, std::string("INT" + shape1->Name() + shape2->Name()).c_str()));
+        intersectionShape->SetShortName(std::string("INT" + shape1->ShortName() + shape2->ShortName()).c_str());
+        _intersections.push_back(intersectionShape);
     }
 
     CCPACSFarField& farfield = _myconfig.GetFarField();
@@ -19,8 +19,11 @@
 #ifndef CTIGLFUSEPLANE_H
 #define CTIGLFUSEPLANE_H
 
+#include <functional>
+#include <map>
 #include <vector>
 
+#include "tigl.h"
 #include "CNamedShape.h"
 #include "ListPNamedShape.h"
 
@@ -41,11 +44,36 @@ enum TiglFuseResultMode
 class CTiglFusePlane
 {
 public:
+    /// Receives the progress in [0, 1]. Returning false cancels the fuse.
+    typedef std::function<bool(double)> ProgressCallback;
+
     TIGL_EXPORT CTiglFusePlane(CCPACSConfiguration& config);
 
     // sets mode for plane generation, by default a half plane is created
     TIGL_EXPORT void SetResultMode(TiglFuseResultMode mode);
 
+    // enables multithreading of the boolean operations, enabled by default
+    TIGL_EXPORT void SetRunParallel(bool parallel);
+
+    // additional tolerance of the boolean operations, disabled (0) by default
+    TIGL_EXPORT void SetFuzzyValue(double fuzzyValue);
+
+    // faster fuse of components that only touch each other, disabled by default
+    TIGL_EXPORT void SetGlueMode(TiglFuseGlueMode mode);
+
+    // In the full plane modes, only one half of x-z symmetric configurations is fused
+    // and mirrored afterwards. Enabled by default.
+    TIGL_EXPORT void SetUseSymmetry(bool useSymmetry);
+
+    /**
+     * @brief Sets a callback, which reports the progress of the fuse.
+     *
+     * If the callback returns false, the fuse is cancelled and FusedPlane
+     * throws a CTiglError. An empty callback disables the reporting.
+     * The callback is only called from the thread that calls FusedPlane.
+     */
+    TIGL_EXPORT void SetProgressCallback(const ProgressCallback& callback);
+
     TIGL_EXPORT const PNamedShape FusedPlane();
     TIGL_EXPORT const PNamedShape FarField();
     TIGL_EXPORT const ListPNamedShape& Intersections();
@@ -55,13 +83,26 @@ public:
 private:
     void Perform();
     void PerformIntersections();
+    PNamedShape FuseComponents(const ListPNamedShape& compShapes) const;
+    PNamedShape FuseMirroredHalfModel(const ListPNamedShape& halfShapes,
+                                      const std::map<PNamedShape, PNamedShape>& mirroredOrigins) const;
+    PNamedShape MakeSolid(const PNamedShape& fusedCompound) const;
+    bool ReportProgress(double progress) const;
+    std::vector<CTiglRelativelyPositionedComponent*> CollectComponents() const;
     ListPNamedShape CollectComponentShapes() const;
+    bool CollectHalfModelShapes(ListPNamedShape& halfShapes,
+                                std::map<PNamedShape, PNamedShape>& mirroredOrigins) const;
 
     PNamedShape          _result;         /**< contains the result of the fusing operation >**/
     ListPNamedShape      _intersections;  /**< contains the shape shape intersections >**/
     PNamedShape          _farfield;       /**< contains the farfield if available >**/
     CCPACSConfiguration& _myconfig;       /**< Ref to CPACS config >**/
     TiglFuseResultMode    _mymode;
+    bool                 _runParallel;
+    double               _fuzzyValue;
+    TiglFuseGlueMode     _glueMode;
+    bool                 _useSymmetry;
+    ProgressCallback     _progressCallback;
     bool _hasPerformed;
     bool _hasComputedIntersections;
 };
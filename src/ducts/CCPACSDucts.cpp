@@ -73,6 +73,26 @@ PNamedShape CCPACSDucts::LoftWithDuctCutouts(PNamedShape const& cleanLoft, std::
     return loft;
 }
 
+std::vector<std::string> CCPACSDucts::GetCutoutAssemblyUIDs(std::string const& uid) const
+{
+    std::vector<std::string> uids;
+    if (!enabled) {
+        return uids;
+    }
+
+    for (auto const & ductAssembly : m_ductAssemblys)
+    {
+        if (ductAssembly->GetExcludeObjectUIDs()) {
+            auto const & excludeVector = ductAssembly->GetExcludeObjectUIDs()->GetUIDs();
+            if (std::any_of(excludeVector.begin(), excludeVector.end(), [&](const std::string& elem) { return elem == uid; })) {
+                continue;
+            }
+        }
+        uids.push_back(ductAssembly->GetUID());
+    }
+    return uids;
+}
+
 CCPACSDuct const& CCPACSDucts::GetDuct(std::string const& uid) const
 {
     return const_cast<CCPACSDucts&>(*this).GetDuct(uid);
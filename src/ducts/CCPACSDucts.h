@@ -37,6 +37,9 @@ public:
     // Given an input loft, create a new loft where all ducts have been cut away.
     TIGL_EXPORT PNamedShape LoftWithDuctCutouts(PNamedShape const&, std::string const &) const;
 
+    // Returns the uids of all duct assemblies, that are cut out of the loft of the component with the given uid
+    TIGL_EXPORT std::vector<std::string> GetCutoutAssemblyUIDs(std::string const& uid) const;
+
     TIGL_EXPORT CCPACSDuct const& GetDuct(std::string const& uid) const;
     TIGL_EXPORT CCPACSDuct& GetDuct(std::string const& uid);
 
@@ -27,10 +27,14 @@
 #include "CCPACSEnginePositions.h"
 #include "CCPACSEnginePosition.h"
 #include "CCPACSFuselage.h"
+#include "stringtools.h"
+
+#include <boost/algorithm/string/trim.hpp>
 
 #include <string>
 #include <algorithm>
 #include <cassert>
+#include <vector>
 
 
 namespace tigl
@@ -208,6 +212,13 @@ void CTiglCADExporter::AddFusedConfiguration(CCPACSConfiguration &config, const
     }
 }
 
+void CTiglCADExporter::AddShapes(const CTiglCADExporter& other)
+{
+    for (size_t ishape = 0; ishape < other.NShapes(); ++ishape) {
+        AddShape(other._shapes[ishape], other._configs[ishape], other._shapeOptions[ishape]);
+    }
+}
+
 size_t CTiglCADExporter::NShapes() const
 {
     return _shapes.size();
@@ -241,4 +252,38 @@ std::string CTiglCADExporter::SupportedFileType() const
     return SupportedFileTypeImpl();
 }
 
+std::vector<double> CTiglCADExporter::LevelsOfDetail() const
+{
+    std::vector<double> levels;
+    if (!GlobalExportOptions().HasOption("LevelsOfDetail")) {
+        return levels;
+    }
+
+    std::vector<std::string> values = split_string(GlobalExportOptions().Get<std::string>("LevelsOfDetail"), ';');
+    for (std::string value : values) {
+        boost::algorithm::trim(value);
+        if (value.empty()) {
+            continue;
+        }
+        double deflection = 0.;
+        from_string(value, deflection);
+        if (deflection <= 0.) {
+            throw CTiglError("Invalid deflection '" + value + "' in option LevelsOfDetail.", TIGL_INVALID_VALUE);
+        }
+        levels.push_back(deflection);
+    }
+    std::sort(levels.begin(), levels.end());
+    return levels;
+}
+
+std::string CTiglCADExporter::LevelOfDetailFileName(const std::string& filename, size_t level)
+{
+    size_t dot = filename.find_last_of('.');
+    size_t slash = filename.find_last_of("/\\");
+    if (dot == std::string::npos || (slash != std::string::npos && dot < slash)) {
+        dot = filename.size();
+    }
+    return filename.substr(0, dot) + "_lod" + std::to_string(level) + filename.substr(dot);
+}
+
 } // namespace tigl
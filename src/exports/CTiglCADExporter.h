@@ -26,6 +26,9 @@
 #include "COptionList.h"
 #include "CCPACSImportExport.h"
 
+#include <string>
+#include <vector>
+
 namespace tigl
 {
 
@@ -167,6 +170,13 @@ public:
      */
     TIGL_EXPORT void AddFusedConfiguration(CCPACSConfiguration& config, const ShapeExportOptions& options = DefaultShapeExportOptions());
 
+    /**
+     * @brief Adds all shapes of another exporter, including their configurations and shape options.
+     * This allows to export the same shapes to different formats.
+     * @param other
+     */
+    TIGL_EXPORT void AddShapes(const CTiglCADExporter& other);
+
     /**
      * @brief Writes the export file to working directory
      * @param filename
@@ -195,6 +205,18 @@ protected:
     /// Can also be NULL!
     const CCPACSConfiguration* GetConfiguration(size_t iShape) const;
 
+    /**
+     * @brief Returns the deflections of the coarser levels of detail in ascending order.
+     *
+     * The levels are read from the string option "LevelsOfDetail", which contains
+     * semicolon separated deflections, e.g. "0.01;0.1". Returns an empty list, if the
+     * exporter does not support levels of detail.
+     */
+    std::vector<double> LevelsOfDetail() const;
+
+    /// Returns the file name of a level of detail, i.e. <base>_lod<level>.<ext>
+    static std::string LevelOfDetailFileName(const std::string& filename, size_t level);
+
 private:
     /// must be overridden by the concrete implementation
     virtual bool WriteImpl(const std::string& filename) const = 0;
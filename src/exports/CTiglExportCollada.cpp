@@ -26,7 +26,7 @@ TODO:
 #include "CTiglExportCollada.h"
 
 #include "CTiglPolyData.h"
-#include "CTiglTriangularizer.h"
+#include "CTiglTessellationCache.h"
 #include "CCPACSConfiguration.h"
 #include "CTiglExporterFactory.h"
 #include "CTiglTypeRegistry.h"
@@ -35,8 +35,10 @@ TODO:
 
 #include <cstdio>
 #include <ctime>
+#include <memory>
 #include <string>
 #include <cassert>
+#include <vector>
 
 // OpenCASCADE
 #include <TopoDS_Shape.hxx>
@@ -162,16 +164,18 @@ bool writeGeometryMesh(TixiDocumentHandle handle, const CTiglPolyData& polyData,
     for (unsigned int i = 1; i <= polyData.getNObjects(); ++i) {
         const CTiglPolyObject& obj = polyData.getObject(i);
 
+        const CTiglConstSpan<double> points = obj.getPointData();
+        const CTiglConstSpan<double> normals = obj.getNormalData();
         unsigned long nvert = obj.getNVertices();
         for (unsigned long jvert = 0; jvert < nvert; ++jvert) {
-            const CTiglPoint& v = obj.getVertexPoint(jvert);
-            const CTiglPoint& n = obj.getVertexNormal(jvert);
+            const double* v = &points[3*jvert];
+            const double* n = &normals[3*jvert];
 
             // VertexPoint
-            stream_verts <<  v.x << " " << v.y << " " << v.z << " ";
+            stream_verts <<  v[0] << " " << v[1] << " " << v[2] << " ";
 
             // VertexNormals
-            stream_normals <<  n.x << " " << n.y << " " << n.z << " ";
+            stream_normals <<  n[0] << " " << n[1] << " " << n[2] << " ";
             count_norm++;
             count_pos++;
         }
@@ -291,7 +295,9 @@ bool writeSceneNode(TixiDocumentHandle handle, std::string scenePath, std::strin
 }
 
 
-bool CTiglExportCollada::WriteImpl(const std::string& filename) const
+// writes the meshes into a collada file, names[i] is the name of meshes[i]
+bool writeColladaFile(const std::string& filename, const std::vector<std::string>& names,
+                      const std::vector<std::shared_ptr<const CTiglPolyData>>& meshes)
 {
     TixiDocumentHandle handle = -1;  
     if (tixiCreateDocument("COLLADA", &handle) != SUCCESS) {
@@ -305,13 +311,8 @@ bool CTiglExportCollada::WriteImpl(const std::string& filename) const
 
     // write object mesh info
     int geomIndex = 1;
-    for (unsigned int i = 0; i < NShapes(); ++i) {
-        // Do the meshing
-        PNamedShape pshape = GetShape(i);
-        double deflection = GetOptions(i).Get<double>("Deflection");
-        CTiglTriangularizer mesher(pshape, deflection);
-        
-        writeGeometryMesh(handle, mesher.getTriangulation(), std::string(pshape->Name()) + "-geom", geomIndex);
+    for (size_t i = 0; i < meshes.size(); ++i) {
+        writeGeometryMesh(handle, *meshes[i], names[i] + "-geom", geomIndex);
     }
     
     // write the scene and link object to geometry
@@ -321,10 +322,9 @@ bool CTiglExportCollada::WriteImpl(const std::string& filename) const
 
     // add each object to the scene
     int nodeIndex = 1;
-    for (unsigned int i = 0; i < NShapes(); ++i) {
-        PNamedShape pshape = GetShape(i);
+    for (size_t i = 0; i < meshes.size(); ++i) {
         // Todo: insert transformation matrix also
-        writeSceneNode(handle, "/COLLADA/library_visual_scenes/visual_scene", pshape->Name(), std::string(pshape->Name()) + "-geom", nodeIndex);
+        writeSceneNode(handle, "/COLLADA/library_visual_scenes/visual_scene", names[i], names[i] + "-geom", nodeIndex);
     }
 
     // Write Default scene entry
@@ -332,12 +332,43 @@ bool CTiglExportCollada::WriteImpl(const std::string& filename) const
     tixiCreateElement(handle, "/COLLADA/scene", "instance_visual_scene");
     tixiAddTextAttribute(handle, "/COLLADA/scene/instance_visual_scene", "url", "#DefaultScene");
 
+    bool success = true;
     if (tixiSaveDocument(handle, filename.c_str()) != SUCCESS) {
         LOG(ERROR) << "Cannot save collada file " << filename;
-        return false;
+        success = false;
     }
+    tixiCloseDocument(handle);
 
-    return true;
+    return success;
+}
+
+bool CTiglExportCollada::WriteImpl(const std::string& filename) const
+{
+    // the levels of detail are written to <filename>_lod<level>.dae
+    const std::vector<double> levels = LevelsOfDetail();
+
+    std::vector<std::string> names;
+    // meshes[iLevel][iShape]
+    std::vector<std::vector<std::shared_ptr<const CTiglPolyData>>> meshes(levels.size() + 1);
+    for (unsigned int i = 0; i < NShapes(); ++i) {
+        // Do the meshing, or reuse the mesh of a previous export
+        PNamedShape pshape = GetShape(i);
+        double deflection = GetOptions(i).Get<double>("Deflection");
+        std::vector<std::shared_ptr<const CTiglPolyData>> shapeLevels =
+            CTiglTessellationCache::GetInstance().TriangulateLevels(NULL, pshape, deflection, levels);
+
+        names.push_back(pshape->Name());
+        for (size_t iLevel = 0; iLevel < shapeLevels.size(); ++iLevel) {
+            meshes[iLevel].push_back(shapeLevels[iLevel]);
+        }
+    }
+
+    bool success = true;
+    for (size_t iLevel = 0; iLevel < meshes.size(); ++iLevel) {
+        std::string levelFilename = iLevel == 0 ? filename : LevelOfDetailFileName(filename, iLevel);
+        success = writeColladaFile(levelFilename, names, meshes[iLevel]) && success;
+    }
+    return success;
 }
 
 } // namespace tigl
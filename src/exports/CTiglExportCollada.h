@@ -38,6 +38,9 @@ public:
     {
         Set("ApplySymmetries", true);
         Set("IncludeFarfield", false);
+        // semicolon separated deflections of coarser levels of detail, e.g. "0.01;0.1".
+        // Each level is written into <filename>_lod<level>.dae
+        AddOption("LevelsOfDetail", std::string(""));
     }
 };
 
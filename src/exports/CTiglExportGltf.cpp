@@ -0,0 +1,671 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "CTiglExportGltf.h"
+
+#include "CTiglExporterFactory.h"
+#include "CTiglTypeRegistry.h"
+#include "CTiglTessellationCache.h"
+#include "CTiglPolyData.h"
+#include "CCPACSConfiguration.h"
+#include "CTiglUIDManager.h"
+#include "CTiglAbstractGeometricComponent.h"
+#include "CNamedShape.h"
+#include "CTiglError.h"
+#include "CTiglLogging.h"
+#include "tiglcommonfunctions.h"
+#include "tigl_version.h"
+
+#include <gp.hxx>
+#include <gp_Ax2.hxx>
+#include <gp_Trsf.hxx>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <locale>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace tigl
+{
+
+AUTORUN(CTiglExportGltf)
+{
+    static CCADExporterBuilder<CTiglExportGltf> gltfExporterBuilder;
+    CTiglExporterFactory::Instance().RegisterExporter(&gltfExporterBuilder, GltfOptions());
+    return true;
+}
+
+namespace
+{
+    const char* const kMirroredSuffix = ":mirrored";
+
+    const uint32_t GLB_MAGIC      = 0x46546C67; // "glTF"
+    const uint32_t GLB_VERSION    = 2;
+    const uint32_t GLB_CHUNK_JSON = 0x4E4F534A; // "JSON"
+    const uint32_t GLB_CHUNK_BIN  = 0x004E4942; // "BIN"
+
+    const int GL_FLOAT                 = 5126;
+    const int GL_UNSIGNED_INT          = 5125;
+    const int GL_ARRAY_BUFFER          = 34962;
+    const int GL_ELEMENT_ARRAY_BUFFER  = 34963;
+    const int GL_TRIANGLES             = 4;
+
+    struct GltfMesh
+    {
+        std::string name;
+        std::shared_ptr<const CTiglPolyData> polys;
+        std::vector<size_t> levels; // meshes of the coarser levels of detail
+    };
+
+    struct GltfNode
+    {
+        std::string name;
+        std::string componentUID;
+        std::vector<std::string> faceNames;
+        int mesh;       // -1, if the node has no triangles
+        gp_Trsf trafo;  // transformation from the mesh to the component
+    };
+
+    // node of a coarser level of detail
+    struct LevelNode
+    {
+        size_t node;  // node of the finest level
+        size_t mesh;
+        size_t level;
+    };
+
+    // all nodes created for an exported shape
+    struct ShapeNodes
+    {
+        PNamedShape shape;
+        std::vector<size_t> nodes;
+    };
+
+    // Binary data in little endian byte order, as required by glTF
+    class BinaryBuffer
+    {
+    public:
+        void AppendUInt(uint32_t value)
+        {
+            for (int i = 0; i < 4; ++i) {
+                m_data.push_back(static_cast<char>((value >> (8*i)) & 0xFF));
+            }
+        }
+
+        void AppendFloat(float value)
+        {
+            uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            AppendUInt(bits);
+        }
+
+        // pads the buffer to a multiple of four bytes
+        void Align(char fill)
+        {
+            while (m_data.size() % 4 != 0) {
+                m_data.push_back(fill);
+            }
+        }
+
+        size_t Size() const
+        {
+            return m_data.size();
+        }
+
+        const std::vector<char>& Data() const
+        {
+            return m_data;
+        }
+
+    private:
+        std::vector<char> m_data;
+    };
+
+    std::string jsonString(const std::string& str)
+    {
+        std::string result = "\"";
+        for (char c : str) {
+            switch (c) {
+            case '"':
+                result += "\\\"";
+                break;
+            case '\\':
+                result += "\\\\";
+                break;
+            case '\n':
+                result += "\\n";
+                break;
+            case '\t':
+                result += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char buffer[8];
+                    std::snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned int>(c));
+                    result += buffer;
+                }
+                else {
+                    result += c;
+                }
+            }
+        }
+        return result + "\"";
+    }
+
+    // the unique face names of a shape
+    std::vector<std::string> faceNames(const PNamedShape& shape)
+    {
+        std::vector<std::string> names;
+        for (unsigned int iFace = 0; iFace < shape->GetFaceCount(); ++iFace) {
+            std::string name = shape->GetFaceTraits(iFace).Name();
+            if (std::find(names.begin(), names.end(), name) == names.end()) {
+                names.push_back(name);
+            }
+        }
+        return names;
+    }
+
+    gp_Trsf mirroring(TiglSymmetryAxis axis)
+    {
+        gp_Trsf trafo;
+        switch (axis) {
+        case TIGL_X_Z_PLANE:
+            trafo.SetMirror(gp_Ax2(gp::Origin(), gp::DY()));
+            break;
+        case TIGL_X_Y_PLANE:
+            trafo.SetMirror(gp_Ax2(gp::Origin(), gp::DZ()));
+            break;
+        case TIGL_Y_Z_PLANE:
+            trafo.SetMirror(gp_Ax2(gp::Origin(), gp::DX()));
+            break;
+        default:
+            break;
+        }
+        return trafo;
+    }
+
+    bool hasSuffix(const std::string& str, const std::string& suffix)
+    {
+        return str.size() > suffix.size() && str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+    }
+
+    void writeMatrix(std::ostream& json, const gp_Trsf& trafo)
+    {
+        // glTF matrices are stored column by column
+        json << "[";
+        for (int col = 1; col <= 4; ++col) {
+            for (int row = 1; row <= 4; ++row) {
+                double value = 0.;
+                if (row <= 3) {
+                    value = trafo.Value(row, col);
+                }
+                else if (col == 4) {
+                    value = 1.;
+                }
+                json << (col == 1 && row == 1 ? "" : ",") << value;
+            }
+        }
+        json << "]";
+    }
+
+    void writeStringArray(std::ostream& json, const std::vector<std::string>& strings)
+    {
+        json << "[";
+        for (size_t i = 0; i < strings.size(); ++i) {
+            json << (i > 0 ? "," : "") << jsonString(strings[i]);
+        }
+        json << "]";
+    }
+
+    struct BufferView
+    {
+        size_t offset;
+        size_t length;
+        int target;
+    };
+
+    struct Accessor
+    {
+        size_t bufferView;
+        int componentType;
+        size_t count;
+        std::string type;
+        bool hasBounds;
+        float min[3];
+        float max[3];
+    };
+
+    struct Primitive
+    {
+        int position;
+        int normal;   // -1, if no normals are available
+        int indices;
+    };
+
+    size_t addBufferView(std::vector<BufferView>& views, BinaryBuffer& bin, size_t offset, int target)
+    {
+        BufferView view;
+        view.offset = offset;
+        view.length = bin.Size() - offset;
+        view.target = target;
+        views.push_back(view);
+        bin.Align(0);
+        return views.size() - 1;
+    }
+
+    // Writes vertices, normals and triangles of all objects of the mesh into the binary buffer.
+    // Returns false, if the mesh contains no triangles.
+    bool writeMeshBuffers(const CTiglPolyData& polys, BinaryBuffer& bin, std::vector<BufferView>& views,
+                          std::vector<Accessor>& accessors, Primitive& primitive)
+    {
+        unsigned long nVertices = 0;
+        unsigned long nTriangles = 0;
+        bool normals = true;
+        for (unsigned int iObj = 1; iObj <= polys.getNObjects(); ++iObj) {
+            const CTiglPolyObject& obj = polys.getObject(iObj);
+            nVertices += obj.getNVertices();
+            normals = normals && obj.hasNormals();
+            const CTiglConstSpan<unsigned int> offsets = obj.getPolygonOffsets();
+            for (unsigned long iPoly = 0; iPoly < obj.getNPolygons(); ++iPoly) {
+                if (offsets[iPoly + 1] - offsets[iPoly] == 3) {
+                    nTriangles++;
+                }
+            }
+        }
+
+        if (nVertices == 0 || nTriangles == 0) {
+            return false;
+        }
+        if (nVertices > std::numeric_limits<uint32_t>::max()) {
+            throw CTiglError("Too many vertices for a glTF mesh", TIGL_WRITE_FAILED);
+        }
+
+        Accessor position;
+        position.componentType = GL_FLOAT;
+        position.count = nVertices;
+        position.type = "VEC3";
+        position.hasBounds = true;
+        std::fill(position.min, position.min + 3, std::numeric_limits<float>::max());
+        std::fill(position.max, position.max + 3, -std::numeric_limits<float>::max());
+
+        size_t offset = bin.Size();
+        for (unsigned int iObj = 1; iObj <= polys.getNObjects(); ++iObj) {
+            const CTiglConstSpan<double> points = polys.getObject(iObj).getPointData();
+            for (size_t i = 0; i < points.size(); ++i) {
+                float value = static_cast<float>(points[i]);
+                position.min[i % 3] = std::min(position.min[i % 3], value);
+                position.max[i % 3] = std::max(position.max[i % 3], value);
+                bin.AppendFloat(value);
+            }
+        }
+        position.bufferView = addBufferView(views, bin, offset, GL_ARRAY_BUFFER);
+        accessors.push_back(position);
+        primitive.position = static_cast<int>(accessors.size() - 1);
+
+        primitive.normal = -1;
+        if (normals) {
+            offset = bin.Size();
+            for (unsigned int iObj = 1; iObj <= polys.getNObjects(); ++iObj) {
+                const CTiglConstSpan<double> normalData = polys.getObject(iObj).getNormalData();
+                for (size_t i = 0; i < normalData.size(); ++i) {
+                    bin.AppendFloat(static_cast<float>(normalData[i]));
+                }
+            }
+
+            Accessor normal = position;
+            normal.hasBounds = false;
+            normal.bufferView = addBufferView(views, bin, offset, GL_ARRAY_BUFFER);
+            accessors.push_back(normal);
+            primitive.normal = static_cast<int>(accessors.size() - 1);
+        }
+
+        // the vertices of all objects are numbered consecutively
+        offset = bin.Size();
+        uint32_t vertexOffset = 0;
+        for (unsigned int iObj = 1; iObj <= polys.getNObjects(); ++iObj) {
+            const CTiglPolyObject& obj = polys.getObject(iObj);
+            const CTiglConstSpan<unsigned int> connectivity = obj.getConnectivity();
+            const CTiglConstSpan<unsigned int> offsets = obj.getPolygonOffsets();
+            for (unsigned long iPoly = 0; iPoly < obj.getNPolygons(); ++iPoly) {
+                if (offsets[iPoly + 1] - offsets[iPoly] != 3) {
+                    // lines and polygons are not exported
+                    continue;
+                }
+                for (unsigned int k = offsets[iPoly]; k < offsets[iPoly + 1]; ++k) {
+                    bin.AppendUInt(vertexOffset + connectivity[k]);
+                }
+            }
+            vertexOffset += static_cast<uint32_t>(obj.getNVertices());
+        }
+
+        Accessor indices;
+        indices.componentType = GL_UNSIGNED_INT;
+        indices.count = 3 * nTriangles;
+        indices.type = "SCALAR";
+        indices.hasBounds = false;
+        indices.bufferView = addBufferView(views, bin, offset, GL_ELEMENT_ARRAY_BUFFER);
+        accessors.push_back(indices);
+        primitive.indices = static_cast<int>(accessors.size() - 1);
+
+        return true;
+    }
+
+} // namespace
+
+CTiglExportGltf::CTiglExportGltf(const ExporterOptions& opt)
+    : CTiglCADExporter(opt)
+{
+}
+
+ExporterOptions CTiglExportGltf::GetDefaultOptions() const
+{
+    return GltfOptions();
+}
+
+ShapeExportOptions CTiglExportGltf::GetDefaultShapeOptions() const
+{
+    return TriangulatedExportOptions(0.001);
+}
+
+bool CTiglExportGltf::WriteImpl(const std::string& filename) const
+{
+    std::ofstream out(filename.c_str(), std::ios::out | std::ios::binary);
+    if (!out) {
+        LOG(ERROR) << "Cannot open file " << filename << " for writing";
+        return false;
+    }
+
+    return Write(out);
+}
+
+bool CTiglExportGltf::Write(std::ostream& out) const
+{
+    if (NShapes() == 0) {
+        LOG(ERROR) << "No shapes to export to glTF";
+        return false;
+    }
+
+    const bool instancing = GlobalExportOptions().HasOption("Instancing") && GlobalExportOptions().Get<bool>("Instancing");
+    const std::vector<double> levels = LevelsOfDetail();
+
+    std::vector<GltfMesh> meshes;
+    std::vector<GltfNode> nodes;
+    std::vector<ShapeNodes> shapeNodes;
+
+    for (size_t iShape = 0; iShape < NShapes(); ++iShape) {
+        PNamedShape shape = GetShape(iShape);
+        if (!shape) {
+            continue;
+        }
+
+        ShapeNodes current;
+        current.shape = shape;
+
+        // Look for a previous shape, whose meshes can be reused
+        const ShapeNodes* instanceOf = nullptr;
+        gp_Trsf instanceTrafo;
+        if (instancing) {
+            const std::string name = shape->Name();
+            const CCPACSConfiguration* config = GetConfiguration(iShape);
+            if (hasSuffix(name, kMirroredSuffix) && config) {
+                const std::string originalName = name.substr(0, name.size() - std::strlen(kMirroredSuffix));
+                const CTiglUIDManager& uidMgr = config->GetUIDManager();
+                const CTiglAbstractGeometricComponent* component = uidMgr.HasGeometricComponent(originalName)
+                    ? dynamic_cast<const CTiglAbstractGeometricComponent*>(&uidMgr.GetGeometricComponent(originalName))
+                    : nullptr;
+                if (component && component->GetSymmetryAxis() != TIGL_NO_SYMMETRY) {
+                    for (const ShapeNodes& previous : shapeNodes) {
+                        if (previous.shape->Name() == originalName) {
+                            instanceOf = &previous;
+                            instanceTrafo = mirroring(component->GetSymmetryAxis());
+                            break;
+                        }
+                    }
+                }
+            }
+            for (size_t i = 0; !instanceOf && i < shapeNodes.size(); ++i) {
+                // Same geometry at a different location, e.g. repeated blades
+                const TopoDS_Shape& previousShape = shapeNodes[i].shape->Shape();
+                if (previousShape.IsPartner(shape->Shape()) && previousShape.Orientation() == shape->Shape().Orientation()) {
+                    instanceOf = &shapeNodes[i];
+                    instanceTrafo = shape->Shape().Location().Transformation()
+                                  * previousShape.Location().Transformation().Inverted();
+                }
+            }
+        }
+
+        if (instanceOf) {
+            for (size_t iNode : instanceOf->nodes) {
+                GltfNode node = nodes[iNode];
+                node.name = instanceOf->nodes.size() == 1 ? shape->Name() : node.name + " (" + shape->Name() + ")";
+                node.trafo = instanceTrafo * node.trafo;
+                nodes.push_back(node);
+                current.nodes.push_back(nodes.size() - 1);
+            }
+            LOG(INFO) << "Exporting " << shape->Name() << " as an instance of " << instanceOf->shape->Name();
+        }
+        else {
+            double deflection = GetOptions(iShape).Get<double>("Deflection");
+            ListPNamedShape groups = GroupFacesByComponent(shape);
+            for (const PNamedShape& group : groups) {
+                if (group->GetFaceCount() == 0) {
+                    continue;
+                }
+
+                std::vector<std::shared_ptr<const CTiglPolyData>> polys =
+                    CTiglTessellationCache::GetInstance().TriangulateLevels(NULL, group, deflection, levels);
+
+                GltfMesh mesh;
+                mesh.name = GetComponentUIDOfFace(group, 0);
+                mesh.polys = polys[0];
+                meshes.push_back(mesh);
+                const size_t iMesh = meshes.size() - 1;
+
+                for (size_t iLevel = 1; iLevel < polys.size(); ++iLevel) {
+                    GltfMesh levelMesh;
+                    levelMesh.name = mesh.name + " (LOD " + std::to_string(iLevel) + ")";
+                    levelMesh.polys = polys[iLevel];
+                    meshes.push_back(levelMesh);
+                    meshes[iMesh].levels.push_back(meshes.size() - 1);
+                }
+
+                GltfNode node;
+                node.name = group->Name();
+                node.componentUID = mesh.name;
+                node.faceNames = faceNames(group);
+                node.mesh = static_cast<int>(iMesh);
+                nodes.push_back(node);
+                current.nodes.push_back(nodes.size() - 1);
+            }
+        }
+        shapeNodes.push_back(current);
+    }
+
+    // Write the binary buffers of all meshes
+    BinaryBuffer bin;
+    std::vector<BufferView> views;
+    std::vector<Accessor> accessors;
+    std::vector<Primitive> primitives(meshes.size());
+    std::vector<int> meshIndex(meshes.size(), -1);
+    int nWrittenMeshes = 0;
+    for (size_t iMesh = 0; iMesh < meshes.size(); ++iMesh) {
+        if (writeMeshBuffers(*meshes[iMesh].polys, bin, views, accessors, primitives[iMesh])) {
+            meshIndex[iMesh] = nWrittenMeshes++;
+        }
+    }
+
+    // The coarser levels of detail are written as additional nodes outside of the scene,
+    // which are referenced by the node of the finest level (extension MSFT_lod)
+    std::vector<std::vector<size_t>> levelNodeIds(nodes.size());
+    std::vector<LevelNode> levelNodes;
+    for (size_t iNode = 0; iNode < nodes.size(); ++iNode) {
+        const int mesh = nodes[iNode].mesh;
+        if (mesh < 0 || meshIndex[mesh] < 0) {
+            continue;
+        }
+        for (size_t iLevel = 0; iLevel < meshes[mesh].levels.size(); ++iLevel) {
+            LevelNode levelNode;
+            levelNode.node = iNode;
+            levelNode.mesh = meshes[mesh].levels[iLevel];
+            levelNode.level = iLevel + 1;
+            if (meshIndex[levelNode.mesh] >= 0) {
+                // the root node has index 0
+                levelNodeIds[iNode].push_back(nodes.size() + levelNodes.size() + 1);
+                levelNodes.push_back(levelNode);
+            }
+        }
+    }
+
+    std::ostringstream json;
+    json.imbue(std::locale::classic());
+    json.precision(9);
+
+    json << "{\"asset\":{\"version\":\"2.0\",\"generator\":" << jsonString(std::string("TiGL ") + TIGL_VERSION_STRING) << "},";
+    if (!levelNodes.empty()) {
+        json << "\"extensionsUsed\":[\"MSFT_lod\"],";
+    }
+    json << "\"scene\":0,\"scenes\":[{\"nodes\":[0]}],";
+
+    // The root node rotates the z-up CPACS coordinate system into the y-up system of glTF
+    json << "\"nodes\":[{\"name\":\"root\",\"matrix\":[1,0,0,0,0,0,-1,0,0,1,0,0,0,0,0,1]";
+    if (!nodes.empty()) {
+        json << ",\"children\":[";
+        for (size_t iNode = 0; iNode < nodes.size(); ++iNode) {
+            json << (iNode > 0 ? "," : "") << iNode + 1;
+        }
+        json << "]";
+    }
+    json << "}";
+
+    auto writeNode = [&](const GltfNode& node, const std::string& name, int mesh, const std::vector<size_t>& levelIds) {
+        json << ",{\"name\":" << jsonString(name);
+        if (mesh >= 0 && meshIndex[mesh] >= 0) {
+            json << ",\"mesh\":" << meshIndex[mesh];
+        }
+        if (node.trafo.Form() != gp_Identity) {
+            json << ",\"matrix\":";
+            writeMatrix(json, node.trafo);
+        }
+        if (!levelIds.empty()) {
+            json << ",\"extensions\":{\"MSFT_lod\":{\"ids\":[";
+            for (size_t i = 0; i < levelIds.size(); ++i) {
+                json << (i > 0 ? "," : "") << levelIds[i];
+            }
+            json << "]}}";
+        }
+        json << ",\"extras\":{\"componentUID\":" << jsonString(node.componentUID) << ",\"faceNames\":";
+        writeStringArray(json, node.faceNames);
+        json << "}}";
+    };
+
+    for (size_t iNode = 0; iNode < nodes.size(); ++iNode) {
+        writeNode(nodes[iNode], nodes[iNode].name, nodes[iNode].mesh, levelNodeIds[iNode]);
+    }
+    for (const LevelNode& levelNode : levelNodes) {
+        const GltfNode& node = nodes[levelNode.node];
+        writeNode(node, node.name + " (LOD " + std::to_string(levelNode.level) + ")",
+                  static_cast<int>(levelNode.mesh), std::vector<size_t>());
+    }
+    json << "]";
+
+    if (nWrittenMeshes > 0) {
+        json << ",\"meshes\":[";
+        bool first = true;
+        for (size_t iMesh = 0; iMesh < meshes.size(); ++iMesh) {
+            if (meshIndex[iMesh] < 0) {
+                continue;
+            }
+            const Primitive& primitive = primitives[iMesh];
+            json << (first ? "" : ",") << "{\"name\":" << jsonString(meshes[iMesh].name)
+                 << ",\"primitives\":[{\"attributes\":{\"POSITION\":" << primitive.position;
+            if (primitive.normal >= 0) {
+                json << ",\"NORMAL\":" << primitive.normal;
+            }
+            json << "},\"indices\":" << primitive.indices << ",\"mode\":" << GL_TRIANGLES << "}]}";
+            first = false;
+        }
+        json << "]";
+
+        json << ",\"accessors\":[";
+        for (size_t i = 0; i < accessors.size(); ++i) {
+            const Accessor& accessor = accessors[i];
+            json << (i > 0 ? "," : "") << "{\"bufferView\":" << accessor.bufferView
+                 << ",\"componentType\":" << accessor.componentType
+                 << ",\"count\":" << accessor.count
+                 << ",\"type\":\"" << accessor.type << "\"";
+            if (accessor.hasBounds) {
+                json << ",\"min\":[" << accessor.min[0] << "," << accessor.min[1] << "," << accessor.min[2] << "]"
+                     << ",\"max\":[" << accessor.max[0] << "," << accessor.max[1] << "," << accessor.max[2] << "]";
+            }
+            json << "}";
+        }
+        json << "]";
+
+        json << ",\"bufferViews\":[";
+        for (size_t i = 0; i < views.size(); ++i) {
+            json << (i > 0 ? "," : "") << "{\"buffer\":0,\"byteOffset\":" << views[i].offset
+                 << ",\"byteLength\":" << views[i].length << ",\"target\":" << views[i].target << "}";
+        }
+        json << "]";
+
+        json << ",\"buffers\":[{\"byteLength\":" << bin.Size() << "}]";
+    }
+    json << "}";
+
+    const std::string jsonText = json.str();
+    BinaryBuffer header;
+
+    // the json chunk is padded with spaces, the binary chunk with zeros
+    size_t jsonLength = (jsonText.size() + 3) / 4 * 4;
+    size_t totalLength = 12 + 8 + jsonLength + (bin.Size() > 0 ? 8 + bin.Size() : 0);
+    if (totalLength > std::numeric_limits<uint32_t>::max()) {
+        LOG(ERROR) << "The glTF file exceeds the maximum size of 4 GB";
+        return false;
+    }
+
+    header.AppendUInt(GLB_MAGIC);
+    header.AppendUInt(GLB_VERSION);
+    header.AppendUInt(static_cast<uint32_t>(totalLength));
+    header.AppendUInt(static_cast<uint32_t>(jsonLength));
+    header.AppendUInt(GLB_CHUNK_JSON);
+    out.write(header.Data().data(), header.Size());
+    out.write(jsonText.data(), jsonText.size());
+    out.write("   ", jsonLength - jsonText.size());
+
+    if (bin.Size() > 0) {
+        BinaryBuffer binHeader;
+        binHeader.AppendUInt(static_cast<uint32_t>(bin.Size()));
+        binHeader.AppendUInt(GLB_CHUNK_BIN);
+        out.write(binHeader.Data().data(), binHeader.Size());
+        out.write(bin.Data().data(), bin.Size());
+    }
+
+    out.flush();
+    if (!out) {
+        LOG(ERROR) << "Error writing glTF data";
+        return false;
+    }
+    return true;
+}
+
+} // namespace tigl
@@ -0,0 +1,82 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @brief Exports triangulated shapes into a binary glTF 2.0 file (GLB).
+ *
+ * Each component uid is written as a node of the scene. The names of the faces of
+ * a component are stored in the node's extras. The vertex and index buffers
+ * are stored in the binary chunk of the file.
+ *
+ * If instancing is enabled, the mesh of a component is written only once. Mirrored
+ * components and shapes that share their geometry with a previous shape, but are
+ * placed differently, reference the same mesh with an additional node transformation.
+ *
+ * Coarser levels of detail are written as additional meshes. Their nodes are not part
+ * of the scene, but are listed in the MSFT_lod extension of the node of the finest level.
+ */
+
+#ifndef CTIGLEXPORTGLTF_H
+#define CTIGLEXPORTGLTF_H
+
+#include "tigl_internal.h"
+#include "CTiglCADExporter.h"
+
+#include <string>
+#include <ostream>
+
+namespace tigl
+{
+
+class GltfOptions : public ExporterOptions
+{
+public:
+    GltfOptions()
+    {
+        Set("ApplySymmetries", true);
+        Set("IncludeFarfield", false);
+        AddOption("Instancing", true);
+        // semicolon separated deflections of coarser levels of detail, e.g. "0.01;0.1".
+        // The levels are written as additional nodes, referenced with the MSFT_lod extension
+        AddOption("LevelsOfDetail", std::string(""));
+    }
+};
+
+class CTiglExportGltf : public CTiglCADExporter
+{
+public:
+    TIGL_EXPORT CTiglExportGltf(const ExporterOptions& opt = DefaultExporterOption());
+
+    TIGL_EXPORT ExporterOptions GetDefaultOptions() const override;
+    TIGL_EXPORT ShapeExportOptions GetDefaultShapeOptions() const override;
+
+    /// Writes the GLB file into a stream, which must be opened in binary mode
+    TIGL_EXPORT bool Write(std::ostream& out) const;
+
+    using CTiglCADExporter::Write;
+
+private:
+    bool WriteImpl(const std::string& filename) const override;
+
+    std::string SupportedFileTypeImpl() const override
+    {
+        return "glb";
+    }
+};
+
+} // namespace tigl
+
+#endif // CTIGLEXPORTGLTF_H
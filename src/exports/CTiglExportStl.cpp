@@ -27,15 +27,28 @@
 #include "TopoDS_Shape.hxx"
 #include "Standard_CString.hxx"
 #include "ShapeFix_Shape.hxx"
-#include "BRep_Builder.hxx"
 #include "BRepTools.hxx"
-#include "BRepMesh_IncrementalMesh.hxx"
-#include "StlAPI_Writer.hxx"
 #include "Interface_Static.hxx"
-#include "StlAPI.hxx"
 #include "CTiglFusePlane.h"
+#include "CTiglLogging.h"
+#include "CTiglPolyData.h"
+#include "CTiglTessellationCache.h"
+#include "tiglcommonfunctions.h"
+#include "tiglparallel.h"
 
+#include <gp.hxx>
+#include <gp_XYZ.hxx>
+
+#include <algorithm>
 #include <cassert>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <vector>
 
 namespace tigl 
 {
@@ -47,6 +60,254 @@ AUTORUN(CTiglExportStl)
     return true;
 }
 
+namespace
+{
+    // A solid of the STL file, made up of one or more shapes
+    struct StlSolid
+    {
+        explicit StlSolid(const std::string& solidName)
+            : name(solidName)
+        {
+        }
+
+        void AddShape(PNamedShape shape, double deflection)
+        {
+            shapes.push_back(shape);
+            deflections.push_back(deflection);
+        }
+
+        // meshes all shapes, or reuses the triangulations of previous exports.
+        // The coarser levels of detail are derived from these triangulations.
+        void Triangulate(const std::vector<double>& levels)
+        {
+            meshes.clear();
+            coarserMeshes.assign(levels.size(), std::vector<std::shared_ptr<const CTiglPolyData> >());
+            for (size_t i = 0; i < shapes.size(); ++i) {
+                std::vector<std::shared_ptr<const CTiglPolyData> > shapeLevels =
+                    CTiglTessellationCache::GetInstance().TriangulateLevels(NULL, shapes[i], deflections[i], levels);
+                meshes.push_back(shapeLevels[0]);
+                for (size_t iLevel = 1; iLevel < shapeLevels.size(); ++iLevel) {
+                    coarserMeshes[iLevel - 1].push_back(shapeLevels[iLevel]);
+                }
+            }
+        }
+
+        // returns the solid with the meshes of a level of detail, level 0 is the finest level
+        StlSolid Level(size_t iLevel) const
+        {
+            StlSolid solid(*this);
+            if (iLevel > 0) {
+                solid.meshes = coarserMeshes.at(iLevel - 1);
+            }
+            return solid;
+        }
+
+        std::string name;
+        std::vector<PNamedShape> shapes;
+        std::vector<double> deflections;
+        std::vector<std::shared_ptr<const CTiglPolyData> > meshes;
+        std::vector<std::vector<std::shared_ptr<const CTiglPolyData> > > coarserMeshes;
+    };
+
+    // Calls func(p1, p2, p3, normal) for each triangle of the mesh. Lines and polygons are skipped.
+    template <typename Func>
+    void forEachTriangle(const CTiglPolyData& mesh, const Func& func)
+    {
+        for (unsigned int iObject = 1; iObject <= mesh.getNObjects(); ++iObject) {
+            const CTiglPolyObject& object = mesh.getObject(iObject);
+            const CTiglConstSpan<double> points = object.getPointData();
+            const CTiglConstSpan<unsigned int> connectivity = object.getConnectivity();
+            const CTiglConstSpan<unsigned int> offsets = object.getPolygonOffsets();
+
+            for (unsigned long iPoly = 0; iPoly < object.getNPolygons(); ++iPoly) {
+                if (offsets[iPoly + 1] - offsets[iPoly] != 3) {
+                    continue;
+                }
+
+                const double* v1 = &points[3*connectivity[offsets[iPoly]]];
+                const double* v2 = &points[3*connectivity[offsets[iPoly] + 1]];
+                const double* v3 = &points[3*connectivity[offsets[iPoly] + 2]];
+                const gp_XYZ p1(v1[0], v1[1], v1[2]);
+                const gp_XYZ p2(v2[0], v2[1], v2[2]);
+                const gp_XYZ p3(v3[0], v3[1], v3[2]);
+
+                gp_XYZ normal = (p2 - p1).Crossed(p3 - p1);
+                const double length = normal.Modulus();
+                if (length > gp::Resolution()) {
+                    normal /= length;
+                }
+                else {
+                    normal.SetCoord(0., 0., 0.);
+                }
+
+                func(p1, p2, p3, normal);
+            }
+        }
+    }
+
+    size_t countTriangles(const CTiglPolyData& mesh)
+    {
+        size_t count = 0;
+        for (unsigned int iObject = 1; iObject <= mesh.getNObjects(); ++iObject) {
+            const CTiglPolyObject& object = mesh.getObject(iObject);
+            const CTiglConstSpan<unsigned int> offsets = object.getPolygonOffsets();
+            for (unsigned long iPoly = 0; iPoly < object.getNPolygons(); ++iPoly) {
+                if (offsets[iPoly + 1] - offsets[iPoly] == 3) {
+                    count++;
+                }
+            }
+        }
+        return count;
+    }
+
+    // Same layout as the ascii mode of StlAPI_Writer, with one solid per StlSolid
+    void writeAscii(std::ostream& out, const std::vector<StlSolid>& solids)
+    {
+        char buffer[512];
+        for (const StlSolid& solid : solids) {
+            out << "solid " << solid.name << "\n";
+            for (const std::shared_ptr<const CTiglPolyData>& mesh : solid.meshes) {
+                forEachTriangle(*mesh, [&](const gp_XYZ& p1, const gp_XYZ& p2, const gp_XYZ& p3, const gp_XYZ& normal) {
+                    std::snprintf(buffer, sizeof(buffer),
+                                  " facet normal % 12e % 12e % 12e\n"
+                                  "   outer loop\n"
+                                  "     vertex % 12e % 12e % 12e\n"
+                                  "     vertex % 12e % 12e % 12e\n"
+                                  "     vertex % 12e % 12e % 12e\n"
+                                  "   endloop\n"
+                                  " endfacet\n",
+                                  normal.X(), normal.Y(), normal.Z(),
+                                  p1.X(), p1.Y(), p1.Z(),
+                                  p2.X(), p2.Y(), p2.Z(),
+                                  p3.X(), p3.Y(), p3.Z());
+                    out << buffer;
+                });
+            }
+            out << "endsolid " << solid.name << "\n";
+        }
+    }
+
+    // stores the value in little endian byte order, as required by binary STL
+    char* putUInt(char* buffer, uint32_t value, int nBytes = 4)
+    {
+        for (int i = 0; i < nBytes; ++i) {
+            *buffer++ = static_cast<char>((value >> (8*i)) & 0xFF);
+        }
+        return buffer;
+    }
+
+    char* putFloat(char* buffer, double value)
+    {
+        float f = static_cast<float>(value);
+        uint32_t bits;
+        std::memcpy(&bits, &f, sizeof(bits));
+        return putUInt(buffer, bits);
+    }
+
+    char* putXYZ(char* buffer, const gp_XYZ& xyz)
+    {
+        buffer = putFloat(buffer, xyz.X());
+        buffer = putFloat(buffer, xyz.Y());
+        return putFloat(buffer, xyz.Z());
+    }
+
+    // Binary STL has no named solids. If there are several solids, the solid index
+    // is stored in the attribute byte count of the triangles and the names in the header.
+    bool writeBinary(std::ostream& out, const std::vector<StlSolid>& solids)
+    {
+        size_t nTriangles = 0;
+        for (const StlSolid& solid : solids) {
+            for (const std::shared_ptr<const CTiglPolyData>& mesh : solid.meshes) {
+                nTriangles += countTriangles(*mesh);
+            }
+        }
+        if (nTriangles > std::numeric_limits<uint32_t>::max()) {
+            LOG(ERROR) << "Too many triangles for a binary stl file";
+            return false;
+        }
+
+        // the header must not start with "solid", otherwise readers take the file for ascii stl
+        std::string header = "TiGL binary STL";
+        if (solids.size() > 1) {
+            header += ", solids:";
+            for (const StlSolid& solid : solids) {
+                header += " " + solid.name;
+            }
+        }
+        header.resize(80, ' ');
+
+        char count[4];
+        putUInt(count, static_cast<uint32_t>(nTriangles));
+        out.write(header.data(), header.size());
+        out.write(count, sizeof(count));
+
+        // 50 bytes per triangle: normal, 3 vertices, attribute byte count
+        const size_t triangleSize = 50;
+        std::vector<char> buffer(triangleSize * 4096);
+        size_t used = 0;
+        for (size_t isolid = 0; isolid < solids.size(); ++isolid) {
+            const uint32_t attribute = solids.size() > 1 ? static_cast<uint32_t>(isolid) : 0;
+            for (const std::shared_ptr<const CTiglPolyData>& mesh : solids[isolid].meshes) {
+                forEachTriangle(*mesh, [&](const gp_XYZ& p1, const gp_XYZ& p2, const gp_XYZ& p3, const gp_XYZ& normal) {
+                    if (used == buffer.size()) {
+                        out.write(buffer.data(), used);
+                        used = 0;
+                    }
+                    char* pos = buffer.data() + used;
+                    pos = putXYZ(pos, normal);
+                    pos = putXYZ(pos, p1);
+                    pos = putXYZ(pos, p2);
+                    pos = putXYZ(pos, p3);
+                    putUInt(pos, attribute, 2);
+                    used += triangleSize;
+                });
+            }
+        }
+        out.write(buffer.data(), used);
+        return true;
+    }
+
+    bool writeStlFile(const std::string& filename, const std::vector<StlSolid>& solids, bool binary)
+    {
+        std::ofstream out(filename.c_str(), binary ? std::ios::out | std::ios::binary : std::ios::out);
+        if (!out) {
+            LOG(ERROR) << "Cannot open file " << filename << " for writing.";
+            return false;
+        }
+
+        if (binary) {
+            if (!writeBinary(out, solids)) {
+                return false;
+            }
+        }
+        else {
+            writeAscii(out, solids);
+        }
+
+        out.close();
+        if (!out) {
+            LOG(ERROR) << "Error writing the stl file " << filename;
+            return false;
+        }
+        return true;
+    }
+
+    // <filename>_<uid>.stl, characters of the uid that are not allowed in file names are replaced
+    std::string componentFileName(const std::string& filename, const std::string& uid)
+    {
+        std::string extension = FileExtension(filename);
+        std::string base = extension.empty() ? filename : filename.substr(0, filename.size() - extension.size() - 1);
+
+        std::string suffix = uid;
+        for (char& c : suffix) {
+            if (!std::isalnum(static_cast<unsigned char>(c)) && c != '-' && c != '_' && c != '.') {
+                c = '_';
+            }
+        }
+        return base + "_" + suffix + "." + (extension.empty() ? std::string("stl") : extension);
+    }
+}
+
 // Constructor
 CTiglExportStl::CTiglExportStl(const ExporterOptions& opt)
     : CTiglCADExporter(opt)
@@ -65,41 +326,84 @@ ShapeExportOptions CTiglExportStl::GetDefaultShapeOptions() const
 
 bool CTiglExportStl::WriteImpl(const std::string& filename) const
 {
+    if (NShapes() == 0) {
+        return false;
+    }
+
+    const bool binary = GlobalExportOptions().Get<bool>("Binary");
+    const bool filePerComponent = GlobalExportOptions().Get<bool>("FilePerComponent");
+    const bool solidPerComponent = filePerComponent || GlobalExportOptions().Get<bool>("SolidPerComponent");
+
+    // Assign the shapes to the solids. The faces of fused shapes are split by their component uid
+    std::vector<StlSolid> solids;
     for (size_t ishape = 0; ishape < NShapes(); ++ishape) {
         PNamedShape shape = GetShape(ishape);
-        if (shape) {
-            BRepMesh_IncrementalMesh(shape->Shape(), GetOptions(ishape).Get<double>("Deflection"));
+        if (!shape) {
+            continue;
         }
-    }
 
-    if (NShapes() > 1) {
-        TopoDS_Compound c;
-        BRep_Builder b;
-        b.MakeCompound(c);
-        
-        for (size_t ishape = 0; ishape < NShapes(); ++ishape) {
-            PNamedShape shape = GetShape(ishape);
-            if (shape) {
-                b.Add(c, shape->Shape());
+        double deflection = GetOptions(ishape).Get<double>("Deflection");
+        if (!solidPerComponent) {
+            if (solids.empty()) {
+                solids.push_back(StlSolid("shape"));
             }
+            solids[0].AddShape(shape, deflection);
+            continue;
+        }
+
+        ListPNamedShape components = GroupFacesByComponent(shape);
+        for (const PNamedShape& component : components) {
+            std::vector<StlSolid>::iterator it = std::find_if(solids.begin(), solids.end(), [&](const StlSolid& solid) {
+                return solid.name == component->Name();
+            });
+            if (it == solids.end()) {
+                solids.push_back(StlSolid(component->Name()));
+                it = solids.end() - 1;
+            }
+            it->AddShape(component, deflection);
         }
-        
-        // write the file
-        StlAPI_Writer StlWriter;
-        StlWriter.Write(c, const_cast<char*>(filename.c_str()));
-        
-        return true;
     }
-    else if (NShapes() == 1) {
-        PNamedShape shape = GetShape(0);
-        StlAPI_Writer StlWriter;
-        StlWriter.Write(shape->Shape(), const_cast<char*>(filename.c_str()));
-        
-        return true;
+
+    // the levels of detail are written to <filename>_lod<level>.stl
+    const std::vector<double> levels = LevelsOfDetail();
+
+    if (!filePerComponent) {
+        for (StlSolid& solid : solids) {
+            solid.Triangulate(levels);
+        }
+
+        bool success = true;
+        for (size_t iLevel = 0; iLevel <= levels.size(); ++iLevel) {
+            std::vector<StlSolid> levelSolids;
+            for (const StlSolid& solid : solids) {
+                levelSolids.push_back(solid.Level(iLevel));
+            }
+            std::string levelFilename = iLevel == 0 ? filename : LevelOfDetailFileName(filename, iLevel);
+            success = writeStlFile(levelFilename, levelSolids, binary) && success;
+        }
+        return success;
     }
-    else {
-        return false;
+
+    // The components of a fused shape share their intersection edges. Meshing them
+    // concurrently would write the polygons of the same edges from different threads.
+    // Hence, the components are meshed serially and only written in parallel.
+    for (StlSolid& solid : solids) {
+        solid.Triangulate(levels);
     }
+
+    std::vector<char> success(solids.size(), 0);
+    ParallelFor(0, static_cast<int>(solids.size()), [&](int isolid) {
+        const StlSolid& solid = solids[isolid];
+        success[isolid] = 1;
+        for (size_t iLevel = 0; iLevel <= levels.size(); ++iLevel) {
+            std::string levelFilename = iLevel == 0 ? filename : LevelOfDetailFileName(filename, iLevel);
+            if (!writeStlFile(componentFileName(levelFilename, solid.name), std::vector<StlSolid>(1, solid.Level(iLevel)), binary)) {
+                success[isolid] = 0;
+            }
+        }
+    });
+
+    return std::find(success.begin(), success.end(), 0) == success.end();
 }
 
 } // end namespace tigl
@@ -38,6 +38,16 @@ public:
     {
         Set("ApplySymmetries", true);
         Set("IncludeFarfield", false);
+        // Writes binary instead of ascii STL
+        AddOption("Binary", false);
+        // Writes one solid per component uid. In binary files, the component index
+        // is stored in the attribute byte count of each triangle
+        AddOption("SolidPerComponent", false);
+        // Writes each component into its own file <filename>_<uid>.stl
+        AddOption("FilePerComponent", false);
+        // semicolon separated deflections of coarser levels of detail, e.g. "0.01;0.1".
+        // Each level is written into <filename>_lod<level>.stl
+        AddOption("LevelsOfDetail", std::string(""));
     }
 };
 
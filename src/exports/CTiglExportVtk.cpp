@@ -22,6 +22,7 @@
 // standard libraries
 #include <iostream>
 #include <algorithm>
+#include <memory>
 #include <ostream>
 
 #include "CTiglLogging.h"
@@ -34,14 +35,13 @@
 #include "CCPACSConfigurationManager.h"
 #include "CCPACSWingSegment.h"
 #include "CNamedShape.h"
-#include "CGroupShapes.h"
 #include "CTiglExporterFactory.h"
 #include "CTiglTypeRegistry.h"
 
 // algorithms
 #include "CTiglPolyData.h"
 #include "CTiglTriangularizer.h"
-#include "CTiglPolyData.h"
+#include "CTiglTessellationCache.h"
 
 namespace
 {
@@ -106,21 +106,26 @@ CTiglExportVtk::~CTiglExportVtk()
 
 bool CTiglExportVtk::WriteImpl(const std::string &filename) const
 {
-    TixiDocumentHandle handle;
-    tixiCreateDocument("VTKFile", &handle);
-    writeVTKHeader(handle);
-
-    size_t nTotalVertices = 0;
-    size_t nTotalPolys = 0;
-
     bool multiplePieces = GlobalExportOptions().Get<bool>("MultiplePieces");
     bool normalsEnabled = GlobalExportOptions().Get<bool>("WriteNormals");
+    VtkDataFormat format = GlobalExportOptions().Get<VtkDataFormat>("DataFormat");
+    bool compress = GlobalExportOptions().Get<bool>("Compression");
 
     ComponentTraingMode myMode = NO_INFO;
     if (GlobalExportOptions().Get<bool>("WriteMetaData")) {
         myMode = SEGMENT_INFO;
     }
 
+    // the levels of detail are derived from the finest triangulation
+    std::vector<double> levels = LevelsOfDetail();
+    bool levelsAsFiles = GlobalExportOptions().Get<bool>("LevelsOfDetailAsFiles");
+
+    // the triangulations are shared with the other exporters
+    CTiglTessellationCache& cache = CTiglTessellationCache::GetInstance();
+
+    // pieces[iLevel] contains the pieces of this level. The meshes keep the pieces alive.
+    std::vector<std::shared_ptr<const CTiglPolyData>> meshes;
+    std::vector<std::vector<const CTiglPolyObject*>> pieces(levels.size() + 1);
     if (multiplePieces) {
         for (unsigned int i = 0; i < NShapes(); ++i) {
             // Do the meshing
@@ -128,19 +133,17 @@ bool CTiglExportVtk::WriteImpl(const std::string &filename) const
             double deflection = GetOptions(i).Get<double>("Deflection");
 
             const CTiglUIDManager* mgr = GetConfiguration(i) ? &(GetConfiguration(i)->GetUIDManager()) : NULL;
-            CTiglTriangularizer mesher(mgr, pshape, deflection, myMode, normalsEnabled);
-            const CTiglPolyData& polys = mesher.getTriangulation();
-            writeVTKPiece(polys.currentObject(), handle, i + 1);
-
-            nTotalVertices += polys.getTotalVertexCount();
-            nTotalPolys += polys.getTotalPolygonCount();
+            std::vector<std::shared_ptr<const CTiglPolyData>> shapeLevels =
+                cache.TriangulateLevels(mgr, pshape, deflection, levels, myMode, normalsEnabled);
+            for (size_t iLevel = 0; iLevel < shapeLevels.size(); ++iLevel) {
+                meshes.push_back(shapeLevels[iLevel]);
+                pieces[iLevel].push_back(&shapeLevels[iLevel]->currentObject());
+            }
         }
     }
     else {
         double minDeflection = FLT_MAX;
-        ListPNamedShape shapes;
         for (unsigned int i = 0; i < NShapes(); ++i) {
-            shapes.push_back(GetShape(i));
             double deflection = GetOptions(i).Get<double>("Deflection");
             if (deflection < minDeflection) {
                 minDeflection = deflection;
@@ -156,36 +159,89 @@ bool CTiglExportVtk::WriteImpl(const std::string &filename) const
             }
         }
 
-        PNamedShape groupedShape = CGroupShapes(shapes);
-        CTiglTriangularizer mesher(mgr, groupedShape, minDeflection, myMode, normalsEnabled);
-        const CTiglPolyData& polys = mesher.getTriangulation();
-        writeVTKPiece(polys.currentObject(), handle, 1);
+        // The shapes are triangulated one by one and merged into a single piece per level.
+        // Welding the vertices gives the same result as meshing the grouped shapes.
+        std::vector<std::shared_ptr<CTiglPolyData>> mergedPolys;
+        for (size_t iLevel = 0; iLevel < pieces.size(); ++iLevel) {
+            mergedPolys.push_back(std::make_shared<CTiglPolyData>());
+            mergedPolys.back()->currentObject().enableNormals(normalsEnabled);
+            meshes.push_back(mergedPolys.back());
+            pieces[iLevel].push_back(&mergedPolys.back()->currentObject());
+        }
+        for (unsigned int i = 0; i < NShapes(); ++i) {
+            std::vector<std::shared_ptr<const CTiglPolyData>> shapeLevels =
+                cache.TriangulateLevels(mgr, GetShape(i), minDeflection, levels, myMode, normalsEnabled);
+            for (size_t iLevel = 0; iLevel < shapeLevels.size(); ++iLevel) {
+                mergedPolys[iLevel]->currentObject().append(shapeLevels[iLevel]->currentObject());
+            }
+        }
+    }
 
-        nTotalVertices += polys.getTotalVertexCount();
-        nTotalPolys += polys.getTotalPolygonCount();
+    try {
+        if (levelsAsFiles) {
+            for (size_t iLevel = 0; iLevel < pieces.size(); ++iLevel) {
+                std::string levelFilename = iLevel == 0 ? filename : LevelOfDetailFileName(filename, iLevel);
+                writePieces(pieces[iLevel], levelFilename, format, compress, normalsEnabled, myMode == SEGMENT_INFO);
+            }
+        }
+        else {
+            // the pieces are ordered from the finest to the coarsest level
+            std::vector<const CTiglPolyObject*> allPieces;
+            for (const std::vector<const CTiglPolyObject*>& levelPieces : pieces) {
+                allPieces.insert(allPieces.end(), levelPieces.begin(), levelPieces.end());
+            }
+            writePieces(allPieces, filename, format, compress, normalsEnabled, myMode == SEGMENT_INFO);
+        }
     }
-    
-    if (tixiSaveDocument(handle, filename.c_str())!= SUCCESS) {
+    catch (const CTiglError& err) {
+        LOG(ERROR) << err.what();
         return false;
     }
-    LOG(INFO) << "VTK Export succeeded with " << nTotalPolys
-              << " polygons and " << nTotalVertices << " vertices." << std::endl;
     return true;
 }
 
-void CTiglExportVtk::WritePolys(const CTiglPolyData& polys, const char *filename)
+void CTiglExportVtk::WritePolys(const CTiglPolyData& polys, const char *filename, VtkDataFormat format, bool compress)
 {
-    TixiDocumentHandle handle;
-    tixiCreateDocument("VTKFile", &handle);
-    writeVTKHeader(handle);
+    std::vector<const CTiglPolyObject*> pieces;
     for (unsigned int iObj = 1; iObj <= polys.getNObjects(); ++iObj) {
-        writeVTKPiece(polys.getObject(iObj), handle, iObj);
+        pieces.push_back(&polys.getObject(iObj));
+    }
+    writePieces(pieces, filename, format, compress);
+}
+
+void CTiglExportVtk::writePieces(const std::vector<const CTiglPolyObject*>& pieces, const std::string& filename,
+                                 VtkDataFormat format, bool compress, bool writeNormals, bool writeMetaData)
+{
+    if (format == VtkAscii) {
+        TixiDocumentHandle handle;
+        tixiCreateDocument("VTKFile", &handle);
+        writeVTKHeader(handle);
+        unsigned int iPiece = 0;
+        for (const CTiglPolyObject* piece : pieces) {
+            if (piece->getNPolygons() > 0) {
+                writeVTKPiece(*piece, handle, ++iPiece, writeNormals, writeMetaData);
+            }
+        }
+        ReturnCode ret = tixiSaveDocument(handle, filename.c_str());
+        tixiCloseDocument(handle);
+        if (ret != SUCCESS) {
+            throw CTiglError("Error saving vtk file!", TIGL_WRITE_FAILED);
+        }
+    }
+    else {
+        CTiglVtkStreamWriter writer(format, compress);
+        writer.SetWriteNormals(writeNormals);
+        writer.SetWriteMetaData(writeMetaData);
+        writer.Write(pieces, filename);
     }
-    if (tixiSaveDocument(handle, filename)!= SUCCESS) {
-        throw CTiglError("Error saving vtk file!");
+
+    unsigned long nTotalPolys = 0, nTotalVertices = 0;
+    for (const CTiglPolyObject* piece : pieces) {
+        nTotalPolys += piece->getNPolygons();
+        nTotalVertices += piece->getNVertices();
     }
-    LOG(INFO) << "VTK Export succeeded with " << polys.getTotalPolygonCount()
-              << " polygons and " << polys.getTotalVertexCount() << " vertices." << std::endl;
+    LOG(INFO) << "VTK Export succeeded with " << nTotalPolys
+              << " polygons and " << nTotalVertices << " vertices." << std::endl;
 }
 
 void CTiglExportVtk::writeVTKHeader(TixiDocumentHandle& handle)
@@ -204,7 +260,8 @@ void CTiglExportVtk::writeVTKHeader(TixiDocumentHandle& handle)
 }
 
 // writes the polygon data of a surface (in vtk they call it piece)
-void CTiglExportVtk::writeVTKPiece(const CTiglPolyObject& co, TixiDocumentHandle& handle, unsigned int iObject)
+void CTiglExportVtk::writeVTKPiece(const CTiglPolyObject& co, TixiDocumentHandle& handle, unsigned int iObject,
+                                   bool writeNormals, bool writeMetaData)
 {
     using std::endl;
 
@@ -212,11 +269,11 @@ void CTiglExportVtk::writeVTKPiece(const CTiglPolyObject& co, TixiDocumentHandle
         return;
     }
 
+    const CTiglConstSpan<unsigned int> connectivity = co.getConnectivity();
+    const CTiglConstSpan<unsigned int> offsets = co.getPolygonOffsets();
+
     // count number of vertices - this is not necessarily the number of points
-    int nvert = 0;
-    for (unsigned int i = 0; i < co.getNPolygons(); ++i) {
-        nvert += co.getNPointsOfPolygon(i);
-    }
+    int nvert = static_cast<int>(connectivity.size());
 
     if (nvert <= 0) {
         return;
@@ -259,7 +316,7 @@ void CTiglExportVtk::writeVTKPiece(const CTiglPolyObject& co, TixiDocumentHandle
     }
 
     //normals
-    if (co.hasNormals()) {
+    if (writeNormals && co.hasNormals()) {
         tixiCreateElement(handle, piecepath.c_str(), "PointData");
         std::string tmpPath = piecepath + "/PointData";
         tixiAddTextAttribute(handle, tmpPath.c_str(), "Normals", "surf_normals");
@@ -291,8 +348,8 @@ void CTiglExportVtk::writeVTKPiece(const CTiglPolyObject& co, TixiDocumentHandle
         stream2 << std::endl <<   "        ";
         for (unsigned int iPoly = 0; iPoly < co.getNPolygons(); ++iPoly) {
             stream2 <<     "    ";
-            for (unsigned int jPoint = 0; jPoint < co.getNPointsOfPolygon(iPoly); ++jPoint ) {
-                stream2 << co.getVertexIndexOfPolygon(jPoint, iPoly) << " ";
+            for (unsigned int jIndex = offsets[iPoly]; jIndex < offsets[iPoly + 1]; ++jIndex) {
+                stream2 << connectivity[jIndex] << " ";
             }
             stream2  << std::endl <<  "        ";;
         }
@@ -309,14 +366,12 @@ void CTiglExportVtk::writeVTKPiece(const CTiglPolyObject& co, TixiDocumentHandle
 
     //offset
     {
-        unsigned int next = 0;
         std::stringstream stream3;
         for (unsigned int i = 0; i < co.getNPolygons(); i ++) {
             if ((i % 10 == 0) && (i != (co.getNPolygons() - 1))) {
                 stream3 << endl << "            ";
             }
-            next += co.getNPointsOfPolygon(i);
-            stream3 << " " << next;
+            stream3 << " " << offsets[i + 1];
         }
         stream3 << endl << "        ";
         std::string tmpPath = piecepath + "/Polys";
@@ -329,15 +384,15 @@ void CTiglExportVtk::writeVTKPiece(const CTiglPolyObject& co, TixiDocumentHandle
     }
     
     // write cell data
-    if (co.getNumberOfPolyRealData() > 0) {
+    if (writeMetaData && co.getNumberOfPolyRealData() > 0) {
         tixiCreateElement(handle, piecepath.c_str(), "CellData");
         const std::string tmpPath = piecepath + "/CellData";
         
         for (unsigned int iData = 0; iData < co.getNumberOfPolyRealData(); ++iData) {
             const char * dataField = co.getPolyDataFieldName(iData);
             std::stringstream stream;
-            for (unsigned long jPoly = 0; jPoly < co.getNPolygons(); ++jPoly) {
-                stream << co.getPolyDataReal(jPoly, dataField) << " ";
+            for (double value : co.getPolyDataColumn(dataField)) {
+                stream << value << " ";
             }
             tixiAddTextElement(handle, tmpPath.c_str(), "DataArray", stream.str().c_str());
             const std::string path = tmpPath + "/DataArray[" + std_to_string(iData + 1) + "]";
@@ -351,7 +406,7 @@ void CTiglExportVtk::writeVTKPiece(const CTiglPolyObject& co, TixiDocumentHandle
     }
 
     // write metadata
-    if (co.hasMetadata()) {
+    if (writeMetaData && co.hasMetadata()) {
         std::stringstream stream4;
         stream4 << endl  << "        ";
         for (unsigned int i = 0; i < co.getNPolygons(); i ++) {
@@ -25,9 +25,11 @@
 #include "tigl_internal.h"
 #include "CTiglCADExporter.h"
 #include "CTiglTriangularizer.h"
+#include "CTiglVtkStreamWriter.h"
 
 #include <string>
 #include <map>
+#include <vector>
 
 namespace tigl 
 {
@@ -43,6 +45,14 @@ public:
         AddOption("WriteNormals", true);
         AddOption("MultiplePieces", false);
         AddOption("WriteMetaData", true);
+        // ascii: tixi based writer, raw/base64: streamed binary data
+        AddOption("DataFormat", VtkAscii);
+        // zlib compression of the binary data
+        AddOption("Compression", false);
+        // semicolon separated deflections of coarser levels of detail, e.g. "0.01;0.1"
+        AddOption("LevelsOfDetail", std::string(""));
+        // writes each level into <base>_lod<level>.<ext> instead of additional pieces
+        AddOption("LevelsOfDetailAsFiles", false);
 
         Set("ApplySymmetries", true);
         Set("IncludeFarfield", false);
@@ -63,7 +73,8 @@ public:
     TIGL_EXPORT virtual ~CTiglExportVtk();
 
     /// Exports a polygonal data representation directly
-    TIGL_EXPORT static void WritePolys(const CTiglPolyData& polys, const char * filename);
+    TIGL_EXPORT static void WritePolys(const CTiglPolyData& polys, const char * filename,
+                                       VtkDataFormat format = VtkAscii, bool compress = false);
 
 private:
     bool WriteImpl(const std::string& filename) const override;
@@ -73,7 +84,10 @@ private:
         return "vtp;vtk";
     }
 
-    static void writeVTKPiece(const CTiglPolyObject& co, TixiDocumentHandle& handle, unsigned int iObject); 
+    static void writePieces(const std::vector<const CTiglPolyObject*>& pieces, const std::string& filename,
+                            VtkDataFormat format, bool compress, bool writeNormals = true, bool writeMetaData = true);
+    static void writeVTKPiece(const CTiglPolyObject& co, TixiDocumentHandle& handle, unsigned int iObject,
+                              bool writeNormals, bool writeMetaData);
     static void writeVTKHeader(TixiDocumentHandle& handle);
 };
 
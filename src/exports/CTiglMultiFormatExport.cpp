@@ -0,0 +1,104 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "CTiglMultiFormatExport.h"
+
+#include "CCPACSConfiguration.h"
+#include "CTiglError.h"
+#include "CTiglExporterFactory.h"
+#include "CTiglLogging.h"
+#include "tiglcommonfunctions.h"
+
+#include <algorithm>
+
+namespace tigl
+{
+
+namespace
+{
+    struct FileExport
+    {
+        std::string filename;
+        PTiglCADExporter exporter;
+    };
+
+    bool writesMetaData(const CTiglCADExporter& exporter)
+    {
+        const ExporterOptions& options = exporter.GlobalExportOptions();
+        return options.HasOption("WriteMetaData") && options.Get<bool>("WriteMetaData");
+    }
+
+    // exporters with the same options get the same shapes
+    bool sameShapeOptions(const CTiglCADExporter& e1, const CTiglCADExporter& e2)
+    {
+        const ExporterOptions& o1 = e1.GlobalExportOptions();
+        const ExporterOptions& o2 = e2.GlobalExportOptions();
+        return o1.Get<bool>("ApplySymmetries") == o2.Get<bool>("ApplySymmetries")
+            && o1.Get<bool>("IncludeFarfield") == o2.Get<bool>("IncludeFarfield");
+    }
+}
+
+bool ExportConfigurationToFiles(CCPACSConfiguration& config, const std::vector<std::string>& filenames,
+                                bool fuseAllShapes, double deflection)
+{
+    std::vector<FileExport> exports;
+    for (const std::string& filename : filenames) {
+        std::string extension = FileExtension(filename);
+        if (extension.empty()) {
+            throw CTiglError("Cannot export to '" + filename + "'. No file extension given.", TIGL_WRITE_FAILED);
+        }
+
+        FileExport fileExport;
+        fileExport.filename = filename;
+        fileExport.exporter = createExporter(extension);
+        exports.push_back(fileExport);
+    }
+
+    // The meshes with meta data also serve the exporters without meta data, but not vice versa.
+    // Hence, the exporters writing meta data go first.
+    std::stable_sort(exports.begin(), exports.end(), [](const FileExport& e1, const FileExport& e2) {
+        return writesMetaData(*e1.exporter) && !writesMetaData(*e2.exporter);
+    });
+
+    bool success = true;
+    for (size_t i = 0; i < exports.size(); ++i) {
+        CTiglCADExporter& exporter = *exports[i].exporter;
+
+        // reuse the shapes of a previous exporter
+        std::vector<FileExport>::const_iterator previous = std::find_if(exports.begin(), exports.begin() + i, [&](const FileExport& e) {
+            return sameShapeOptions(*e.exporter, exporter);
+        });
+
+        if (previous != exports.begin() + i) {
+            exporter.AddShapes(*previous->exporter);
+        }
+        else if (fuseAllShapes) {
+            exporter.AddFusedConfiguration(config, TriangulatedExportOptions(deflection));
+        }
+        else {
+            success = exporter.AddConfiguration(config, TriangulatedExportOptions(deflection)) && success;
+        }
+
+        if (!exporter.Write(exports[i].filename)) {
+            LOG(ERROR) << "Error writing file " << exports[i].filename;
+            success = false;
+        }
+    }
+
+    return success;
+}
+
+} // namespace tigl
@@ -0,0 +1,51 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @brief Exports a configuration to several files of different formats in one pass.
+ *
+ * The shapes of the configuration are collected only once for all exporters
+ * with the same symmetry and far field options. The triangulated formats share
+ * their meshes via the CTiglTessellationCache, hence each shape is meshed once.
+ */
+
+#ifndef CTIGLMULTIFORMATEXPORT_H
+#define CTIGLMULTIFORMATEXPORT_H
+
+#include "tigl_internal.h"
+
+#include <string>
+#include <vector>
+
+namespace tigl
+{
+
+class CCPACSConfiguration;
+
+/**
+ * @brief Exports the configuration into all files. The format of each file
+ * is given by its extension. The global export options of the formats are used
+ * (see tiglSetExportOptions).
+ *
+ * Throws, if a file has no extension or the format is not supported.
+ * Returns false, if at least one of the files could not be written.
+ */
+TIGL_EXPORT bool ExportConfigurationToFiles(CCPACSConfiguration& config, const std::vector<std::string>& filenames,
+                                            bool fuseAllShapes, double deflection);
+
+} // namespace tigl
+
+#endif // CTIGLMULTIFORMATEXPORT_H
@@ -0,0 +1,218 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "CTiglTessellationCache.h"
+
+#include "CNamedShape.h"
+#include "CTiglError.h"
+#include "CTiglLogging.h"
+
+#include <boost/thread/lock_guard.hpp>
+
+namespace tigl
+{
+
+namespace
+{
+    const size_t kDefaultCapacity = 32;
+
+    // The triangulation of a fused aircraft can take several hundred MB,
+    // hence the number of triangulations alone does not bound the memory
+    const size_t kDefaultMemoryBudget = size_t(512) * 1024 * 1024;
+}
+
+CTiglTessellationCache::CTiglTessellationCache()
+    : m_capacity(kDefaultCapacity)
+    , m_memoryBudget(kDefaultMemoryBudget)
+    , m_memoryUsage(0)
+{
+}
+
+CTiglTessellationCache& CTiglTessellationCache::GetInstance()
+{
+    static CTiglTessellationCache instance;
+    return instance;
+}
+
+std::shared_ptr<const CTiglPolyData> CTiglTessellationCache::Triangulate(const CTiglUIDManager* uidMgr, PNamedShape shape, double deflection,
+                                                                        ComponentTraingMode mode, bool computeNormals)
+{
+    std::shared_ptr<const CTiglTriangularizer> triangularizer = GetTriangularizer(uidMgr, shape, deflection, mode, computeNormals);
+
+    // the polygon data share the ownership of the triangularizer
+    return std::shared_ptr<const CTiglPolyData>(triangularizer, &triangularizer->getTriangulation());
+}
+
+std::vector<std::shared_ptr<const CTiglPolyData> > CTiglTessellationCache::TriangulateLevels(const CTiglUIDManager* uidMgr, PNamedShape shape, double deflection,
+                                                                                            const std::vector<double>& coarserDeflections,
+                                                                                            ComponentTraingMode mode, bool computeNormals)
+{
+    std::shared_ptr<const CTiglTriangularizer> triangularizer = GetTriangularizer(uidMgr, shape, deflection, mode, computeNormals);
+
+    std::vector<std::shared_ptr<const CTiglPolyData> > levels;
+    levels.push_back(std::shared_ptr<const CTiglPolyData>(triangularizer, &triangularizer->getTriangulation()));
+
+    std::vector<std::shared_ptr<CTiglPolyData> > coarserLevels = triangularizer->computeLevelsOfDetail(coarserDeflections);
+    levels.insert(levels.end(), coarserLevels.begin(), coarserLevels.end());
+    return levels;
+}
+
+std::shared_ptr<const CTiglTriangularizer> CTiglTessellationCache::GetTriangularizer(const CTiglUIDManager* uidMgr, PNamedShape shape, double deflection,
+                                                                                    ComponentTraingMode mode, bool computeNormals)
+{
+    if (!shape) {
+        throw CTiglError("Null pointer shape in CTiglTessellationCache::Triangulate", TIGL_NULL_POINTER);
+    }
+
+    {
+        boost::lock_guard<boost::mutex> guard(m_mutex);
+        for (std::list<Entry>::iterator it = m_entries.begin(); it != m_entries.end(); ++it) {
+            if (Serves(*it, uidMgr, shape, deflection, mode, computeNormals)) {
+                // move to the front
+                m_entries.splice(m_entries.begin(), m_entries, it);
+                LOG(INFO) << "Reusing the triangulation of shape " << shape->Name();
+                return m_entries.front().triangularizer;
+            }
+        }
+    }
+
+    // mesh without holding the lock. Concurrent requests for the same
+    // shape might mesh it twice, which does not affect the result
+    Entry entry;
+    entry.shape = shape;
+    entry.deflection = deflection;
+    entry.normals = computeNormals;
+    entry.mode = mode;
+    entry.uidMgr = uidMgr;
+    entry.triangularizer = std::make_shared<CTiglTriangularizer>(uidMgr, shape, deflection, mode, computeNormals);
+    entry.size = EstimateSize(entry.triangularizer->getTriangulation());
+    Insert(entry);
+
+    return entry.triangularizer;
+}
+
+bool CTiglTessellationCache::Serves(const Entry& entry, const CTiglUIDManager* uidMgr, const PNamedShape& shape, double deflection,
+                                    ComponentTraingMode mode, bool computeNormals)
+{
+    if (entry.deflection != deflection || !entry.shape->Shape().IsEqual(shape->Shape())) {
+        return false;
+    }
+    if (computeNormals && !entry.normals) {
+        return false;
+    }
+    if (mode == SEGMENT_INFO) {
+        // the meta data also depend on the face traits of the named shape
+        return entry.mode == SEGMENT_INFO && entry.uidMgr == uidMgr && entry.shape == shape;
+    }
+    return true;
+}
+
+void CTiglTessellationCache::Insert(const Entry& entry)
+{
+    boost::lock_guard<boost::mutex> guard(m_mutex);
+    if (m_capacity == 0) {
+        return;
+    }
+
+    // a new triangulation with more data replaces the old ones of the same shape
+    for (std::list<Entry>::iterator it = m_entries.begin(); it != m_entries.end();) {
+        if (Serves(entry, it->uidMgr, it->shape, it->deflection, it->mode, it->normals)) {
+            m_memoryUsage -= it->size;
+            it = m_entries.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+
+    m_entries.push_front(entry);
+    m_memoryUsage += entry.size;
+    EvictIfNeeded();
+}
+
+void CTiglTessellationCache::EvictIfNeeded()
+{
+    while (m_entries.size() > m_capacity) {
+        m_memoryUsage -= m_entries.back().size;
+        m_entries.pop_back();
+    }
+
+    // keep at least the most recently used triangulation, even if it exceeds the budget
+    while (m_memoryBudget > 0 && m_memoryUsage > m_memoryBudget && m_entries.size() > 1) {
+        m_memoryUsage -= m_entries.back().size;
+        m_entries.pop_back();
+    }
+}
+
+void CTiglTessellationCache::SetCapacity(size_t capacity)
+{
+    boost::lock_guard<boost::mutex> guard(m_mutex);
+    m_capacity = capacity;
+    EvictIfNeeded();
+}
+
+size_t CTiglTessellationCache::GetCapacity() const
+{
+    boost::lock_guard<boost::mutex> guard(m_mutex);
+    return m_capacity;
+}
+
+size_t CTiglTessellationCache::Size() const
+{
+    boost::lock_guard<boost::mutex> guard(m_mutex);
+    return m_entries.size();
+}
+
+void CTiglTessellationCache::SetMemoryBudget(size_t bytes)
+{
+    boost::lock_guard<boost::mutex> guard(m_mutex);
+    m_memoryBudget = bytes;
+    EvictIfNeeded();
+}
+
+size_t CTiglTessellationCache::GetMemoryBudget() const
+{
+    boost::lock_guard<boost::mutex> guard(m_mutex);
+    return m_memoryBudget;
+}
+
+size_t CTiglTessellationCache::GetMemoryUsage() const
+{
+    boost::lock_guard<boost::mutex> guard(m_mutex);
+    return m_memoryUsage;
+}
+
+size_t CTiglTessellationCache::EstimateSize(const CTiglPolyData& polys)
+{
+    size_t size = 0;
+    for (unsigned int iObject = 1; iObject <= polys.getNObjects(); ++iObject) {
+        const CTiglPolyObject& object = polys.getObject(iObject);
+        size += sizeof(double) * (object.getPointData().size() + object.getNormalData().size());
+        size += sizeof(unsigned int) * (object.getConnectivity().size() + object.getPolygonOffsets().size());
+        // the real valued data of the polygons
+        size += sizeof(double) * object.getNumberOfPolyRealData() * object.getNPolygons();
+    }
+    return size;
+}
+
+void CTiglTessellationCache::Clear()
+{
+    boost::lock_guard<boost::mutex> guard(m_mutex);
+    m_entries.clear();
+    m_memoryUsage = 0;
+}
+
+} // namespace tigl
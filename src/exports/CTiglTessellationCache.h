@@ -0,0 +1,139 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @brief The CTiglTessellationCache stores the triangulations of shapes, such that
+ * the triangulated exporters (VTK, STL, Collada, ...) do not mesh the same shape again.
+ *
+ * A triangulation is identified by the shape, the deflection, whether normals
+ * are computed and the meta data mode. A cached triangulation also serves requests
+ * that need less data, i.e. a triangulation with normals is returned for requests
+ * without normals and a triangulation with segment info for requests without meta data.
+ * The callers must therefore ignore normals and meta data they did not ask for.
+ *
+ * The cache holds a limited number of triangulations and is bounded by a memory
+ * budget. The least recently used triangulations are removed first. As the cached
+ * triangulations keep the shapes of a configuration alive, the cache is cleared
+ * when a configuration is closed.
+ */
+
+#ifndef CTIGLTESSELLATIONCACHE_H
+#define CTIGLTESSELLATIONCACHE_H
+
+#include "tigl_internal.h"
+#include "PNamedShape.h"
+#include "CTiglPolyData.h"
+#include "CTiglTriangularizer.h"
+
+#include <boost/thread/mutex.hpp>
+
+#include <list>
+#include <memory>
+#include <vector>
+
+namespace tigl
+{
+
+class CTiglUIDManager;
+
+class CTiglTessellationCache
+{
+public:
+    // Returns a reference to the only instance of this class
+    TIGL_EXPORT static CTiglTessellationCache& GetInstance();
+
+    /**
+     * @brief Returns the triangulation of the shape. The shape is only meshed,
+     * if no matching triangulation is in the cache.
+     *
+     * The uid manager is only used for the meta data in SEGMENT_INFO mode.
+     */
+    TIGL_EXPORT std::shared_ptr<const CTiglPolyData> Triangulate(const CTiglUIDManager* uidMgr, PNamedShape shape, double deflection,
+                                                                 ComponentTraingMode mode = NO_INFO, bool computeNormals = true);
+
+    /**
+     * @brief Returns the triangulation of the shape and coarser levels of detail.
+     *
+     * The shape is meshed only once with the given deflection, or the cached triangulation
+     * is reused. The coarser levels are derived by simplifying this triangulation and are not cached.
+     *
+     * @param coarserDeflections The deflections of the coarser levels in ascending order
+     * @return The triangulation, followed by one triangulation per coarser level
+     */
+    TIGL_EXPORT std::vector<std::shared_ptr<const CTiglPolyData> > TriangulateLevels(const CTiglUIDManager* uidMgr, PNamedShape shape, double deflection,
+                                                                                    const std::vector<double>& coarserDeflections,
+                                                                                    ComponentTraingMode mode = NO_INFO, bool computeNormals = true);
+
+    /// Sets the maximum number of cached triangulations. Zero disables the cache.
+    TIGL_EXPORT void SetCapacity(size_t capacity);
+
+    TIGL_EXPORT size_t GetCapacity() const;
+
+    /// Returns the number of cached triangulations
+    TIGL_EXPORT size_t Size() const;
+
+    /// Sets the memory budget of the cache in bytes. A budget of 0 disables the limit.
+    TIGL_EXPORT void SetMemoryBudget(size_t bytes);
+
+    /// Returns the memory budget of the cache in bytes
+    TIGL_EXPORT size_t GetMemoryBudget() const;
+
+    /// Returns the approximate memory consumption of all cached triangulations in bytes
+    TIGL_EXPORT size_t GetMemoryUsage() const;
+
+    /// Returns the approximate memory consumption of a triangulation in bytes
+    TIGL_EXPORT static size_t EstimateSize(const CTiglPolyData& polys);
+
+    /// Removes all triangulations
+    TIGL_EXPORT void Clear();
+
+private:
+    CTiglTessellationCache();
+    CTiglTessellationCache(const CTiglTessellationCache&) = delete;
+    void operator=(const CTiglTessellationCache&) = delete;
+
+    struct Entry
+    {
+        PNamedShape shape;
+        double deflection;
+        bool normals;
+        ComponentTraingMode mode;
+        const CTiglUIDManager* uidMgr;
+        std::shared_ptr<const CTiglTriangularizer> triangularizer;
+        size_t size;
+    };
+
+    std::shared_ptr<const CTiglTriangularizer> GetTriangularizer(const CTiglUIDManager* uidMgr, PNamedShape shape, double deflection,
+                                                                ComponentTraingMode mode, bool computeNormals);
+
+    static bool Serves(const Entry& entry, const CTiglUIDManager* uidMgr, const PNamedShape& shape, double deflection,
+                       ComponentTraingMode mode, bool computeNormals);
+
+    void Insert(const Entry& entry);
+
+    // removes the least recently used entries until the limits are met
+    void EvictIfNeeded();
+
+    mutable boost::mutex m_mutex;
+    size_t m_capacity;
+    size_t m_memoryBudget;
+    size_t m_memoryUsage;
+    std::list<Entry> m_entries; // most recently used first
+};
+
+} // namespace tigl
+
+#endif // CTIGLTESSELLATIONCACHE_H
@@ -0,0 +1,376 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "tigl_config.h"
+#include "CTiglVtkStreamWriter.h"
+#include "CTiglPolyData.h"
+#include "CTiglLogging.h"
+#include "tigl.h"
+#include "tiglparallel.h"
+
+#ifdef ZLIB_FOUND
+#include <zlib.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+
+namespace tigl
+{
+
+namespace
+{
+    // uncompressed size of the zlib blocks, as used by VTK
+    const size_t kCompressionBlockSize = 32768;
+
+    // number of bytes that are base64 encoded at once, must be a multiple of 3
+    const size_t kBase64Chunk = 3 * 16384;
+
+    const char kBase64Chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    bool isLittleEndian()
+    {
+        const uint16_t one = 1;
+        return *reinterpret_cast<const unsigned char*>(&one) == 1;
+    }
+
+    size_t base64Size(size_t nBytes)
+    {
+        return 4 * ((nBytes + 2) / 3);
+    }
+
+    void writeBase64(std::ostream& out, const unsigned char* data, size_t nBytes)
+    {
+        std::string buffer;
+        buffer.reserve(base64Size(std::min(nBytes, kBase64Chunk)));
+
+        for (size_t chunkStart = 0; chunkStart < nBytes; chunkStart += kBase64Chunk) {
+            const size_t chunkEnd = std::min(nBytes, chunkStart + kBase64Chunk);
+            buffer.clear();
+            for (size_t i = chunkStart; i < chunkEnd; i += 3) {
+                const size_t n = std::min(size_t(3), chunkEnd - i);
+                uint32_t triple = uint32_t(data[i]) << 16;
+                if (n > 1) {
+                    triple |= uint32_t(data[i+1]) << 8;
+                }
+                if (n > 2) {
+                    triple |= uint32_t(data[i+2]);
+                }
+                buffer += kBase64Chars[(triple >> 18) & 0x3F];
+                buffer += kBase64Chars[(triple >> 12) & 0x3F];
+                buffer += n > 1 ? kBase64Chars[(triple >> 6) & 0x3F] : '=';
+                buffer += n > 2 ? kBase64Chars[triple & 0x3F] : '=';
+            }
+            out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        }
+    }
+
+    std::string xmlEscape(const std::string& text)
+    {
+        std::string result;
+        result.reserve(text.size());
+        for (char c : text) {
+            switch (c) {
+            case '&':
+                result += "&amp;";
+                break;
+            case '<':
+                result += "&lt;";
+                break;
+            case '>':
+                result += "&gt;";
+                break;
+            case '"':
+                result += "&quot;";
+                break;
+            default:
+                result += c;
+            }
+        }
+        return result;
+    }
+}
+
+struct CTiglVtkStreamWriter::DataArray
+{
+    DataArray(const char* type, const std::string& name, int nComponents, const void* data, size_t nBytes)
+        : type(type)
+        , name(name)
+        , nComponents(nComponents)
+        , data(static_cast<const unsigned char*>(data))
+        , nBytes(nBytes)
+    {
+    }
+
+    const char* type;
+    std::string name;
+    int nComponents;
+    const unsigned char* data;
+    size_t nBytes;
+
+    // block count, block size, size of the last partial block and the
+    // compressed size of each block, followed by the compressed blocks
+    std::vector<uint64_t> compressionHeader;
+    std::vector<unsigned char> compressedData;
+
+    void Compress()
+    {
+#ifdef ZLIB_FOUND
+        const size_t nBlocks = (nBytes + kCompressionBlockSize - 1) / kCompressionBlockSize;
+        compressionHeader.assign(3 + nBlocks, 0);
+        compressionHeader[0] = nBlocks;
+        compressionHeader[1] = kCompressionBlockSize;
+        compressionHeader[2] = nBytes % kCompressionBlockSize;
+
+        compressedData.clear();
+        std::vector<unsigned char> block(compressBound(kCompressionBlockSize));
+        for (size_t iBlock = 0; iBlock < nBlocks; ++iBlock) {
+            const size_t start = iBlock * kCompressionBlockSize;
+            const size_t blockSize = std::min(kCompressionBlockSize, nBytes - start);
+            uLongf compressedSize = static_cast<uLongf>(block.size());
+            if (compress2(block.data(), &compressedSize, data + start, static_cast<uLong>(blockSize), Z_DEFAULT_COMPRESSION) != Z_OK) {
+                throw CTiglError("Cannot compress data array " + name + " of the vtk file", TIGL_WRITE_FAILED);
+            }
+            compressionHeader[3 + iBlock] = compressedSize;
+            compressedData.insert(compressedData.end(), block.begin(), block.begin() + compressedSize);
+        }
+#endif
+    }
+};
+
+CTiglVtkStreamWriter::CTiglVtkStreamWriter(VtkDataFormat format, bool compress)
+    : m_format(format)
+    , m_compress(compress)
+    , m_writeNormals(true)
+    , m_writeMetaData(true)
+{
+    if (format != VtkAppendedRaw && format != VtkAppendedBase64) {
+        throw CTiglError("CTiglVtkStreamWriter supports appended raw and base64 data only", TIGL_ERROR);
+    }
+    if (m_compress && !IsCompressionAvailable()) {
+        LOG(WARNING) << "TiGL was built without zlib. The vtk file is written uncompressed.";
+        m_compress = false;
+    }
+}
+
+bool CTiglVtkStreamWriter::IsCompressionAvailable()
+{
+#ifdef ZLIB_FOUND
+    return true;
+#else
+    return false;
+#endif
+}
+
+void CTiglVtkStreamWriter::Write(const std::vector<const CTiglPolyObject*>& pieces, const std::string& filename) const
+{
+    std::ofstream out(filename.c_str(), std::ios::out | std::ios::binary);
+    if (!out) {
+        throw CTiglError("Cannot open file " + filename + " for writing", TIGL_OPEN_FAILED);
+    }
+
+    Write(pieces, out);
+
+    out.close();
+    if (!out) {
+        throw CTiglError("Error writing vtk file " + filename, TIGL_WRITE_FAILED);
+    }
+}
+
+void CTiglVtkStreamWriter::Write(const std::vector<const CTiglPolyObject*>& pieces, std::ostream& out) const
+{
+    struct Piece
+    {
+        const CTiglPolyObject* object;
+        std::vector<DataArray> pointData;
+        std::vector<DataArray> cellData;
+        std::vector<DataArray> points;
+        std::vector<DataArray> polys;
+    };
+
+    // the data arrays reference the buffers of the poly objects, nothing is copied
+    std::vector<Piece> vtkPieces;
+    for (const CTiglPolyObject* object : pieces) {
+        if (!object || object->getNPolygons() == 0) {
+            continue;
+        }
+
+        Piece piece;
+        piece.object = object;
+
+        if (m_writeNormals && object->hasNormals()) {
+            CTiglConstSpan<double> normals = object->getNormalData();
+            piece.pointData.push_back(DataArray("Float64", "surf_normals", 3, normals.data(), normals.size() * sizeof(double)));
+        }
+
+        if (m_writeMetaData) {
+            for (unsigned int iField = 0; iField < object->getNumberOfPolyRealData(); ++iField) {
+                const char* name = object->getPolyDataFieldName(iField);
+                CTiglConstSpan<double> column = object->getPolyDataColumn(name);
+                piece.cellData.push_back(DataArray("Float64", name, 1, column.data(), column.size() * sizeof(double)));
+            }
+        }
+
+        CTiglConstSpan<double> points = object->getPointData();
+        piece.points.push_back(DataArray("Float64", "Points", 3, points.data(), points.size() * sizeof(double)));
+
+        // vtk expects the end offset of each polygon
+        CTiglConstSpan<unsigned int> connectivity = object->getConnectivity();
+        CTiglConstSpan<unsigned int> offsets = object->getPolygonOffsets();
+        piece.polys.push_back(DataArray("Int32", "connectivity", 1, connectivity.data(), connectivity.size() * sizeof(unsigned int)));
+        piece.polys.push_back(DataArray("Int32", "offsets", 1, offsets.data() + 1, (offsets.size() - 1) * sizeof(unsigned int)));
+
+        vtkPieces.push_back(std::move(piece));
+    }
+
+    // all arrays in the order of the appended data section
+    std::vector<DataArray*> arrays;
+    for (Piece& piece : vtkPieces) {
+        for (std::vector<DataArray>* group : {&piece.pointData, &piece.cellData, &piece.points, &piece.polys}) {
+            for (DataArray& array : *group) {
+                arrays.push_back(&array);
+            }
+        }
+    }
+
+    if (m_compress) {
+        ParallelFor(0, static_cast<int>(arrays.size()), [&arrays](int i) {
+            arrays[i]->Compress();
+        });
+    }
+
+    out << "<?xml version=\"1.0\"?>\n";
+    out << "<VTKFile type=\"PolyData\" version=\"1.0\" byte_order=\"" << (isLittleEndian() ? "LittleEndian" : "BigEndian")
+        << "\" header_type=\"UInt64\"";
+    if (m_compress) {
+        out << " compressor=\"vtkZLibDataCompressor\"";
+    }
+    out << ">\n";
+    out << "  <MetaData creator=\"tigl " << xmlEscape(tiglGetVersion()) << "\"/>\n";
+    out << "  <PolyData>\n";
+
+    size_t offset = 0;
+    for (const Piece& piece : vtkPieces) {
+        const CTiglPolyObject& object = *piece.object;
+        out << "    <Piece NumberOfPoints=\"" << object.getNVertices() << "\" NumberOfVerts=\"0\" NumberOfLines=\"0\""
+            << " NumberOfStrips=\"0\" NumberOfPolys=\"" << object.getNPolygons() << "\">\n";
+
+        if (!piece.pointData.empty()) {
+            out << "      <PointData Normals=\"surf_normals\">\n";
+            for (const DataArray& array : piece.pointData) {
+                WriteArrayHeader(out, array, offset);
+                offset += AppendedSize(array);
+            }
+            out << "      </PointData>\n";
+        }
+
+        if (!piece.cellData.empty()) {
+            out << "      <CellData>\n";
+            for (const DataArray& array : piece.cellData) {
+                WriteArrayHeader(out, array, offset);
+                offset += AppendedSize(array);
+            }
+            out << "      </CellData>\n";
+        }
+
+        out << "      <Points>\n";
+        for (const DataArray& array : piece.points) {
+            WriteArrayHeader(out, array, offset);
+            offset += AppendedSize(array);
+        }
+        out << "      </Points>\n";
+
+        out << "      <Polys>\n";
+        for (const DataArray& array : piece.polys) {
+            WriteArrayHeader(out, array, offset);
+            offset += AppendedSize(array);
+        }
+        if (m_writeMetaData && object.hasMetadata()) {
+            out << "        <MetaData elements=\"" << xmlEscape(object.getMetadataElements()) << "\">\n";
+            for (unsigned long iPoly = 0; iPoly < object.getNPolygons(); ++iPoly) {
+                out << "            " << xmlEscape(object.getPolyMetadata(iPoly)) << "\n";
+            }
+            out << "        </MetaData>\n";
+        }
+        out << "      </Polys>\n";
+        out << "    </Piece>\n";
+    }
+
+    out << "  </PolyData>\n";
+    out << "  <AppendedData encoding=\"" << (m_format == VtkAppendedBase64 ? "base64" : "raw") << "\">\n";
+    out << "   _";
+    for (const DataArray* array : arrays) {
+        WriteArrayData(out, *array);
+    }
+    out << "\n  </AppendedData>\n";
+    out << "</VTKFile>\n";
+}
+
+void CTiglVtkStreamWriter::SetWriteNormals(bool writeNormals)
+{
+    m_writeNormals = writeNormals;
+}
+
+void CTiglVtkStreamWriter::SetWriteMetaData(bool writeMetaData)
+{
+    m_writeMetaData = writeMetaData;
+}
+
+void CTiglVtkStreamWriter::WriteArrayHeader(std::ostream& out, const DataArray& array, size_t offset) const
+{
+    out << "        <DataArray type=\"" << array.type << "\" Name=\"" << xmlEscape(array.name)
+        << "\" NumberOfComponents=\"" << array.nComponents << "\" format=\"appended\" offset=\"" << offset << "\"/>\n";
+}
+
+size_t CTiglVtkStreamWriter::AppendedSize(const DataArray& array) const
+{
+    const size_t headerSize = m_compress ? array.compressionHeader.size() * sizeof(uint64_t) : sizeof(uint64_t);
+    const size_t dataSize = m_compress ? array.compressedData.size() : array.nBytes;
+
+    if (m_format == VtkAppendedBase64) {
+        // header and data are encoded separately
+        return base64Size(headerSize) + base64Size(dataSize);
+    }
+    return headerSize + dataSize;
+}
+
+void CTiglVtkStreamWriter::WriteArrayData(std::ostream& out, const DataArray& array) const
+{
+    const uint64_t size = array.nBytes;
+    const unsigned char* header = reinterpret_cast<const unsigned char*>(&size);
+    size_t headerSize = sizeof(uint64_t);
+    const unsigned char* data = array.data;
+    size_t dataSize = array.nBytes;
+
+    if (m_compress) {
+        header = reinterpret_cast<const unsigned char*>(array.compressionHeader.data());
+        headerSize = array.compressionHeader.size() * sizeof(uint64_t);
+        data = array.compressedData.data();
+        dataSize = array.compressedData.size();
+    }
+
+    if (m_format == VtkAppendedBase64) {
+        writeBase64(out, header, headerSize);
+        writeBase64(out, data, dataSize);
+    }
+    else {
+        out.write(reinterpret_cast<const char*>(header), static_cast<std::streamsize>(headerSize));
+        out.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(dataSize));
+    }
+}
+
+} // namespace tigl
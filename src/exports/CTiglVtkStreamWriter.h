@@ -0,0 +1,103 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @brief Writes VTK XML PolyData files with binary, appended data arrays.
+ *
+ * In contrast to the tixi based ASCII writer, the file is streamed directly from the
+ * buffers of the CTiglPolyObject. The data arrays are stored either as raw bytes or base64
+ * encoded in the AppendedData section. Optionally, the arrays are compressed with zlib
+ * (vtkZLibDataCompressor). The compressed arrays are kept in memory until they are written,
+ * as their sizes are needed for the offsets in the XML header.
+ */
+
+#ifndef CTIGLVTKSTREAMWRITER_H
+#define CTIGLVTKSTREAMWRITER_H
+
+#include "tigl_internal.h"
+#include "CTiglError.h"
+#include "stringtools.h"
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace tigl
+{
+
+class CTiglPolyObject;
+
+enum VtkDataFormat
+{
+    VtkAscii,           /** ASCII data arrays, written by the tixi based writer */
+    VtkAppendedRaw,     /** raw binary data in the AppendedData section */
+    VtkAppendedBase64   /** base64 encoded binary data in the AppendedData section */
+};
+
+class CTiglVtkStreamWriter
+{
+public:
+    /// format must be one of the appended formats
+    TIGL_EXPORT explicit CTiglVtkStreamWriter(VtkDataFormat format = VtkAppendedRaw, bool compress = false);
+
+    /// Writes each object with at least one polygon as a piece. Throws on failure.
+    TIGL_EXPORT void Write(const std::vector<const CTiglPolyObject*>& pieces, const std::string& filename) const;
+
+    TIGL_EXPORT void Write(const std::vector<const CTiglPolyObject*>& pieces, std::ostream& out) const;
+
+    /// Whether to write the vertex normals of objects that have normals (default: true)
+    TIGL_EXPORT void SetWriteNormals(bool writeNormals);
+
+    /// Whether to write the polygon data fields and meta data (default: true)
+    TIGL_EXPORT void SetWriteMetaData(bool writeMetaData);
+
+    /// Returns true, if TiGL was built with zlib
+    TIGL_EXPORT static bool IsCompressionAvailable();
+
+private:
+    struct DataArray;
+
+    void WriteArrayHeader(std::ostream& out, const DataArray& array, size_t offset) const;
+    void WriteArrayData(std::ostream& out, const DataArray& array) const;
+    size_t AppendedSize(const DataArray& array) const;
+
+    VtkDataFormat m_format;
+    bool m_compress;
+    bool m_writeNormals;
+    bool m_writeMetaData;
+};
+
+template <>
+inline void from_string<VtkDataFormat>(const std::string &s, VtkDataFormat &t)
+{
+    std::string value = tigl::to_upper(s);
+    if (value == "ASCII") {
+        t = VtkAscii;
+    }
+    else if (value == "RAW") {
+        t = VtkAppendedRaw;
+    }
+    else if (value == "BASE64") {
+        t = VtkAppendedBase64;
+    }
+    else {
+        throw CTiglError("Cannot convert string to VtkDataFormat");
+    }
+}
+
+} // namespace tigl
+
+#endif // CTIGLVTKSTREAMWRITER_H
@@ -35,6 +35,7 @@
 #include "CTiglMakeLoft.h"
 #include "CTiglBSplineAlgorithms.h"
 #include "CTiglTopoAlgorithms.h"
+#include "CTiglPersistentShapeCache.h"
 #include "CCPACSDuctAssembly.h"
 #include "CCPACSFuselageSection.h"
 #include "ListFunctions.h"
@@ -285,6 +286,15 @@ PNamedShape CCPACSFuselage::BuildLoft() const
     return GetConfiguration().GetDucts()->LoftWithDuctCutouts(*cleanLoft, GetUID());
 }
 
+std::string CCPACSFuselage::GetPersistentCacheKey() const
+{
+    std::vector<std::string> dependencies;
+    if (GetConfiguration().HasDucts()) {
+        dependencies = GetConfiguration().GetDucts()->GetCutoutAssemblyUIDs(GetUID());
+    }
+    return CTiglPersistentShapeCache::ComputeKey(GetConfiguration().GetTixiDocumentHandle(), GetUID(), "CCPACSFuselage", dependencies);
+}
+
 void CCPACSFuselage::BuildCleanLoft(PNamedShape& cache) const
 {
     TiglContinuity cont = m_segments.GetSegment(1).GetContinuity();
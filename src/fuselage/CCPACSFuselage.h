@@ -277,6 +277,8 @@ protected:
     // Adds all segments of this fuselage to one shape
     PNamedShape BuildLoft() const override;
 
+    std::string GetPersistentCacheKey() const override;
+
     void SetFaceTraits(PNamedShape loft) const;
 
     void SetFuselageHelper(CTiglFuselageHelper& cache) const ;
@@ -67,6 +67,7 @@
 #include "BRep_Builder.hxx"
 #include "Poly_Array1OfTriangle.hxx"
 #include "gp_Trsf.hxx"
+#include "gp_Pln.hxx"
 #include "BRepBuilderAPI_MakeEdge.hxx"
 #include "BRepBuilderAPI_MakeWire.hxx"
 #include "BRepBuilderAPI_MakeFace.hxx"
@@ -92,6 +93,7 @@
 #include "TopTools_IndexedMapOfShape.hxx"
 #include "BRepBuilderAPI_MakeVertex.hxx"
 #include "CTiglTopoAlgorithms.h"
+#include "tiglparallel.h"
 
 namespace
 {
@@ -153,6 +155,7 @@ CCPACSFuselageSegment::CCPACSFuselageSegment(CCPACSFuselageSegments* parent, CTi
     , CTiglAbstractSegment<CCPACSFuselageSegment>(parent->GetSegments(), parent->GetParentComponent())
     , surfacePropertiesCache(*this, &CCPACSFuselageSegment::UpdateSurfaceProperties)
     , surfaceCache(*this, &CCPACSFuselageSegment::BuildSurfaces)
+    , crossSectionCache(*this, &CCPACSFuselageSegment::BuildCrossSectionCache)
     , m_guideCurveBuilder(std::make_unique<CTiglFuselageSegmentGuidecurveBuilder>(*this))
 {
     Cleanup();
@@ -169,6 +172,7 @@ void CCPACSFuselageSegment::Cleanup()
 {
     m_name = "";
     surfacePropertiesCache.clear();
+    crossSectionCache.clear();
     _continuity    = C2;
     CTiglAbstractGeometricComponent::Reset();
 }
@@ -176,6 +180,7 @@ void CCPACSFuselageSegment::Cleanup()
 void CCPACSFuselageSegment::InvalidateImpl(const boost::optional<std::string>& /*source*/) const
 {
     CTiglAbstractSegment<CCPACSFuselageSegment>::Reset();
+    crossSectionCache.clear();
     // forward invalidation to parent fuselage
     const auto* parent = GetNextUIDParent();
     if (parent) {
@@ -792,6 +797,36 @@ gp_Pnt CCPACSFuselageSegment::GetPointOnXPlane(double eta, double xpos, int poin
 }
 
 
+std::vector<std::vector<gp_Pnt>> CCPACSFuselageSegment::GetPointsOnYPlanes(double eta, const std::vector<double>& ypos)
+{
+    std::vector<gp_Pln> planes;
+    for (double y : ypos) {
+        planes.push_back(gp_Pln(gp_Pnt(0., y, 0.), gp_Dir(0., 1., 0.)));
+    }
+    return GetPointsOnPlanes(eta, planes);
+}
+
+std::vector<std::vector<gp_Pnt>> CCPACSFuselageSegment::GetPointsOnXPlanes(double eta, const std::vector<double>& xpos)
+{
+    // same cutting plane as in GetPointOnXPlane
+    std::vector<gp_Pln> planes;
+    for (double x : xpos) {
+        planes.push_back(gp_Pln(gp_Pnt(0., 0., x), gp_Dir(0., 0., 1.)));
+    }
+    return GetPointsOnPlanes(eta, planes);
+}
+
+std::vector<std::vector<gp_Pnt>> CCPACSFuselageSegment::GetPointsOnPlanes(double eta, const std::vector<gp_Pln>& planes)
+{
+    std::shared_ptr<const CTiglFuselageCrossSection> crossSection = GetCrossSection(eta);
+
+    std::vector<std::vector<gp_Pnt>> points(planes.size());
+    ParallelFor(0, static_cast<int>(planes.size()), [&](int i) {
+        points[i] = crossSection->IntersectPlane(planes[i]);
+    });
+    return points;
+}
+
 // Gets the wire on the loft at a given eta
 TopoDS_Shape CCPACSFuselageSegment::getWireOnLoft(double eta)
 {
@@ -890,43 +925,71 @@ gp_Pnt CCPACSFuselageSegment::GetPointAngle(double eta, double alpha, double y_c
     //CAUTION: This functions assumes the fuselage to be aligned along the x-axis
     // and xsi=0 to be at the top of the fuselage (in z-direction)
 
-    // get outer wire
-    TopoDS_Shape intersectionWire = getWireOnLoft(eta);
+    std::vector<gp_Pnt> points = GetPointsAngle(eta, std::vector<double>(1, alpha), y_cs, z_cs, absolute);
+    return points[0];
+}
+
+std::vector<gp_Pnt> CCPACSFuselageSegment::GetPointsAngle(double eta, const std::vector<double>& alphas, double y_cs, double z_cs, bool absolute)
+{
+    std::shared_ptr<const CTiglFuselageCrossSection> crossSection = GetCrossSection(eta);
 
     if ( !absolute ) {
         // get cross section center
-        gp_Pnt csc = GetCenterOfMass(intersectionWire);
+        const gp_Pnt& csc = crossSection->GetCenter();
         y_cs += csc.Y();
         z_cs += csc.Z();
     }
 
-    // compute approximate cross section of fuselage wire
-    Bnd_Box boundingBox;
-    BRepBndLib::Add(intersectionWire, boundingBox);
-    Standard_Real xmin, xmax, ymin, ymax, zmin, zmax;
-    boundingBox.Get(xmin, ymin, zmin, xmax, ymax, zmax);
-    double yw = ymax - ymin;
-    double zw = zmax - zmin;
-    double length = 2*std::max(yw, zw);
-
-    //create a rectangular face
-    double angle = alpha/180. * M_PI;
-    gp_Pnt p1(xmin, y_cs, z_cs);
-    gp_Pnt p2(xmax, y_cs, z_cs);
-    gp_Pnt p3(xmax, y_cs - length*sin(angle), z_cs + length*cos(angle) );
-    gp_Pnt p4(xmin, y_cs - length*sin(angle), z_cs + length*cos(angle) );
-    TopoDS_Edge edge1 = BRepBuilderAPI_MakeEdge(p1, p2);
-    TopoDS_Edge edge2 = BRepBuilderAPI_MakeEdge(p2, p3);
-    TopoDS_Edge edge3 = BRepBuilderAPI_MakeEdge(p3, p4);
-    TopoDS_Edge edge4 = BRepBuilderAPI_MakeEdge(p4, p1);
-    TopoDS_Wire rectangleWire = BRepBuilderAPI_MakeWire(edge1, edge2, edge3, edge4);
-    BRepBuilderAPI_MakeFace FaceMaker(rectangleWire);
-
-    gp_Pnt result;
-    if (!GetIntersectionPoint( FaceMaker.Face(), TopoDS::Wire(intersectionWire), result)) {
-        throw CTiglError("Cannot compute fuselage point at angle");
-    }
-    return result;
+    std::vector<gp_Pnt> points(alphas.size());
+    ParallelFor(0, static_cast<int>(alphas.size()), [&](int i) {
+        if (!crossSection->IntersectRay(alphas[i], y_cs, z_cs, points[i])) {
+            throw CTiglError("Cannot compute fuselage point at angle");
+        }
+    });
+    return points;
+}
+
+void CCPACSFuselageSegment::BuildCrossSectionCache(CrossSectionCache&) const
+{
+    // the cross sections are added on demand by GetCrossSection
+}
+
+std::shared_ptr<const CTiglFuselageCrossSection> CCPACSFuselageSegment::GetCrossSection(double eta)
+{
+    // maximum number of cached cross sections per segment
+    const size_t maxCrossSections = 64;
+
+    {
+        auto cache = crossSectionCache.writeAccess();
+        auto it = cache->sections.find(eta);
+        if (it != cache->sections.end()) {
+            // mark as most recently used
+            cache->usage.splice(cache->usage.begin(), cache->usage, it->second.usage);
+            return it->second.section;
+        }
+    }
+
+    // build the cross section without holding the lock, as this builds the loft
+    auto crossSection = std::make_shared<const CTiglFuselageCrossSection>(TopoDS::Wire(getWireOnLoft(eta)));
+
+    auto cache = crossSectionCache.writeAccess();
+    auto it = cache->sections.find(eta);
+    if (it != cache->sections.end()) {
+        // built concurrently by another thread
+        cache->usage.splice(cache->usage.begin(), cache->usage, it->second.usage);
+        return it->second.section;
+    }
+
+    // evict the least recently used cross section
+    if (cache->sections.size() >= maxCrossSections) {
+        cache->sections.erase(cache->usage.back());
+        cache->usage.pop_back();
+    }
+    cache->usage.push_front(eta);
+    CrossSectionCache::Entry& entry = cache->sections[eta];
+    entry.section = crossSection;
+    entry.usage = cache->usage.begin();
+    return crossSection;
 }
 
 
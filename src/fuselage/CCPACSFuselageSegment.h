@@ -33,10 +33,17 @@
 #include "CCPACSGuideCurves.h"
 #include "CCPACSTransformation.h"
 #include "CTiglCompoundSurface.h"
+#include "CTiglFuselageCrossSection.h"
+#include "Cache.h"
 
 #include "TopoDS_Shape.hxx"
 #include "TopTools_SequenceOfShape.hxx"
 
+#include <list>
+#include <map>
+#include <memory>
+#include <vector>
+
 namespace tigl
 {
 class CCPACSFuselage;
@@ -132,12 +139,22 @@ public:
     TIGL_EXPORT int GetNumPointsOnXPlane(double eta, double xpos);
     TIGL_EXPORT gp_Pnt GetPointOnXPlane(double eta, double xpos, int pointIndex);
 
+    // Returns the intersection points of the cross section at eta with the cutting planes
+    // of GetPointOnYPlane for each ypos, resp. GetPointOnXPlane for each xpos.
+    // The cross section is computed only once and intersected analytically with all planes.
+    TIGL_EXPORT std::vector<std::vector<gp_Pnt>> GetPointsOnYPlanes(double eta, const std::vector<double>& ypos);
+    TIGL_EXPORT std::vector<std::vector<gp_Pnt>> GetPointsOnXPlanes(double eta, const std::vector<double>& xpos);
+
     // Gets a point on the fuselage segment in dependence of an angle alpha (degree).
     // The origin of the angle could be set via the parameters y_cs and z_cs.
     // y_cs and z_cs are assumed to be offsets from the cross section center. Set absolute = true
     // if the values should be interpreted as absolute coordinates
     TIGL_EXPORT gp_Pnt GetPointAngle(double eta, double alpha, double y_cs = 0.0, double z_cs=0.0, bool absolute = false);
 
+    // Same as GetPointAngle for many angles at the same eta. The cross section is
+    // computed only once and the points are evaluated in parallel.
+    TIGL_EXPORT std::vector<gp_Pnt> GetPointsAngle(double eta, const std::vector<double>& alphas, double y_cs = 0.0, double z_cs = 0.0, bool absolute = false);
+
     // Gets the volume of this segment
     TIGL_EXPORT double GetVolume();
 
@@ -172,6 +189,20 @@ private:
     struct SurfaceCache {
         CTiglCompoundSurface surface;
     };
+    struct CrossSectionCache {
+        typedef std::list<double> UsageList;
+
+        struct Entry
+        {
+            std::shared_ptr<const CTiglFuselageCrossSection> section;
+            UsageList::iterator usage;
+        };
+
+        // cross sections of the loft, accessed by eta
+        std::map<double, Entry> sections;
+        // etas of the cross sections, most recently used first
+        UsageList usage;
+    };
 
     // Invalidates internal state
     void InvalidateImpl(const boost::optional<std::string>& source) const override;
@@ -186,6 +217,13 @@ private:
 
     void UpdateSurfaceProperties(SurfacePropertiesCache& cache) const;
     void BuildSurfaces(SurfaceCache& cache) const;
+    void BuildCrossSectionCache(CrossSectionCache& cache) const;
+
+    // Returns the cross section of the loft at eta (and builds it if required)
+    std::shared_ptr<const CTiglFuselageCrossSection> GetCrossSection(double eta);
+
+    // Intersects the cross section at eta with all planes
+    std::vector<std::vector<gp_Pnt>> GetPointsOnPlanes(double eta, const std::vector<gp_Pln>& planes);
 
 private:
     // get short name for loft
@@ -195,6 +233,7 @@ private:
     CTiglFuselageConnection endConnection;        /**< End segment connection                  */
     Cache<SurfacePropertiesCache, CCPACSFuselageSegment> surfacePropertiesCache;
     Cache<SurfaceCache, CCPACSFuselageSegment> surfaceCache;
+    Cache<CrossSectionCache, CCPACSFuselageSegment> crossSectionCache;
     bool                    loftLinearly = false; /**< Set to true to speed up lofting of the
                                                     * segment. This removes the dependency on
                                                     * the fuselage loft at the price of a
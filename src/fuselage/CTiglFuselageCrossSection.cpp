@@ -0,0 +1,209 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "CTiglFuselageCrossSection.h"
+#include "CTiglError.h"
+#include "tiglcommonfunctions.h"
+
+#include <BRepBndLib.hxx>
+#include <BRepTools_WireExplorer.hxx>
+#include <BRep_Tool.hxx>
+#include <Bnd_Box.hxx>
+#include <TopLoc_Location.hxx>
+#include <TopoDS_Edge.hxx>
+
+#include <algorithm>
+#include <cmath>
+
+namespace tigl
+{
+
+namespace
+{
+    // number of samples per curve used to bracket the intersections
+    const int kSamplesPerCurve = 64;
+    const int kMaxRootIterations = 100;
+}
+
+CTiglFuselageCrossSection::CTiglFuselageCrossSection(const TopoDS_Wire& wire)
+    : m_extent(0.)
+{
+    m_center = GetCenterOfMass(wire);
+
+    // the length of the rays, same as the cutting faces used before
+    Bnd_Box boundingBox;
+    BRepBndLib::Add(wire, boundingBox);
+    Standard_Real xmin, xmax, ymin, ymax, zmin, zmax;
+    boundingBox.Get(xmin, ymin, zmin, xmax, ymax, zmax);
+    m_extent = 2. * std::max(ymax - ymin, zmax - zmin);
+
+    for (BRepTools_WireExplorer wireExp(wire); wireExp.More(); wireExp.Next()) {
+        const TopoDS_Edge& edge = wireExp.Current();
+
+        TopLoc_Location location;
+        double umin = 0., umax = 0.;
+        Handle(Geom_Curve) curve = BRep_Tool::Curve(edge, location, umin, umax);
+        if (curve.IsNull()) {
+            // degenerated edge
+            continue;
+        }
+        if (!location.IsIdentity()) {
+            curve = Handle(Geom_Curve)::DownCast(curve->Transformed(location.Transformation()));
+        }
+
+        SampledCurve sampled;
+        sampled.curve = curve;
+        for (int i = 0; i <= kSamplesPerCurve; ++i) {
+            double t = umin + (umax - umin) * static_cast<double>(i) / static_cast<double>(kSamplesPerCurve);
+            sampled.params.push_back(t);
+            sampled.points.push_back(curve->Value(t));
+        }
+        m_curves.push_back(sampled);
+    }
+
+    if (m_curves.empty()) {
+        throw CTiglError("The fuselage cross section does not contain any curve", TIGL_ERROR);
+    }
+}
+
+const gp_Pnt& CTiglFuselageCrossSection::GetCenter() const
+{
+    return m_center;
+}
+
+template <typename Func>
+double CTiglFuselageCrossSection::FindRoot(const SampledCurve& curve, Func f, double t1, double f1, double t2, double f2)
+{
+    // regula falsi with the illinois modification, always keeps the root bracketed
+    const double tol = 1e-14 * std::max(1., std::fabs(t2 - t1));
+    int side = 0;
+    double t = t1;
+    for (int iter = 0; iter < kMaxRootIterations; ++iter) {
+        if (f1 == f2) {
+            t = 0.5 * (t1 + t2);
+        }
+        else {
+            t = (t1*f2 - t2*f1) / (f2 - f1);
+        }
+        double ft = f(curve.curve->Value(t));
+        if (ft == 0. || std::fabs(t2 - t1) < tol) {
+            return t;
+        }
+
+        if ((ft > 0.) == (f2 > 0.)) {
+            t2 = t;
+            f2 = ft;
+            if (side == -1) {
+                f1 *= 0.5;
+            }
+            side = -1;
+        }
+        else {
+            t1 = t;
+            f1 = ft;
+            if (side == 1) {
+                f2 *= 0.5;
+            }
+            side = 1;
+        }
+    }
+    return t;
+}
+
+bool CTiglFuselageCrossSection::IntersectRay(double alpha, double y, double z, gp_Pnt& result) const
+{
+    const double angle = alpha/180. * M_PI;
+    const double dy = -sin(angle);
+    const double dz =  cos(angle);
+
+    // signed distance of a point to the line through the ray
+    auto lineDist = [&](const gp_Pnt& p) {
+        return dy * (p.Z() - z) - dz * (p.Y() - y);
+    };
+    // position of a point along the ray
+    auto rayParam = [&](const gp_Pnt& p) {
+        return dy * (p.Y() - y) + dz * (p.Z() - z);
+    };
+
+    const double tolerance = 1e-7 * std::max(1., m_extent);
+    for (const SampledCurve& curve : m_curves) {
+        double fprev = lineDist(curve.points[0]);
+        for (size_t i = 1; i < curve.points.size(); ++i) {
+            double fcur = lineDist(curve.points[i]);
+            if ((fprev <= 0. && fcur >= 0.) || (fprev >= 0. && fcur <= 0.)) {
+                gp_Pnt p = curve.points[i];
+                if (fprev != 0. || fcur != 0.) {
+                    double t = FindRoot(curve, lineDist, curve.params[i-1], fprev, curve.params[i], fcur);
+                    p = curve.curve->Value(t);
+                }
+
+                double s = rayParam(p);
+                if (s >= -tolerance && s <= m_extent) {
+                    result = p;
+                    return true;
+                }
+            }
+            fprev = fcur;
+        }
+    }
+
+    return false;
+}
+
+std::vector<gp_Pnt> CTiglFuselageCrossSection::IntersectPlane(const gp_Pln& plane) const
+{
+    const gp_XYZ normal = plane.Axis().Direction().XYZ();
+    const gp_XYZ location = plane.Location().XYZ();
+
+    // signed distance of a point to the plane
+    auto planeDist = [&](const gp_Pnt& p) {
+        return normal.Dot(p.XYZ() - location);
+    };
+
+    const double tolerance = 1e-7 * std::max(1., m_extent);
+    std::vector<gp_Pnt> result;
+    auto addPoint = [&](const gp_Pnt& p) {
+        // the end point of a curve is the start point of the next one
+        for (const gp_Pnt& other : result) {
+            if (other.Distance(p) < tolerance) {
+                return;
+            }
+        }
+        result.push_back(p);
+    };
+
+    for (const SampledCurve& curve : m_curves) {
+        double fprev = planeDist(curve.points[0]);
+        if (fprev == 0.) {
+            addPoint(curve.points[0]);
+        }
+        for (size_t i = 1; i < curve.points.size(); ++i) {
+            double fcur = planeDist(curve.points[i]);
+            if (fcur == 0.) {
+                addPoint(curve.points[i]);
+            }
+            else if ((fprev < 0. && fcur > 0.) || (fprev > 0. && fcur < 0.)) {
+                double t = FindRoot(curve, planeDist, curve.params[i-1], fprev, curve.params[i], fcur);
+                addPoint(curve.curve->Value(t));
+            }
+            fprev = fcur;
+        }
+    }
+
+    return result;
+}
+
+} // namespace tigl
@@ -0,0 +1,81 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @brief Curve representation of a fuselage cross section wire.
+ *
+ * The curves of the wire are sampled once. Queries on the cross section,
+ * e.g. the intersection with a ray in the y-z plane, first search the
+ * sampled polylines for sign changes and then refine the intersection on the
+ * exact curve. This avoids building and intersecting auxiliary
+ * faces with BRep algorithms on each query.
+ *
+ * All queries are thread-safe.
+ */
+
+#ifndef CTIGLFUSELAGECROSSSECTION_H
+#define CTIGLFUSELAGECROSSSECTION_H
+
+#include "tigl_internal.h"
+
+#include <Geom_Curve.hxx>
+#include <TopoDS_Wire.hxx>
+#include <gp_Pln.hxx>
+#include <gp_Pnt.hxx>
+
+#include <vector>
+
+namespace tigl
+{
+
+class CTiglFuselageCrossSection
+{
+public:
+    TIGL_EXPORT explicit CTiglFuselageCrossSection(const TopoDS_Wire& wire);
+
+    /// Returns the center of mass of the cross section wire
+    TIGL_EXPORT const gp_Pnt& GetCenter() const;
+
+    /// Intersects the cross section with a ray in the y-z plane, starting at (y, z).
+    /// The angle alpha (degree) is measured from the positive z axis, rotating in the
+    /// mathematical negative direction around the x-axis.
+    /// Returns false, if the ray does not intersect the cross section
+    TIGL_EXPORT bool IntersectRay(double alpha, double y, double z, gp_Pnt& result) const;
+
+    /// Returns all intersection points of the cross section with the plane,
+    /// ordered along the wire. Returns an empty list, if the plane does not cut the cross section.
+    TIGL_EXPORT std::vector<gp_Pnt> IntersectPlane(const gp_Pln& plane) const;
+
+private:
+    struct SampledCurve
+    {
+        Handle(Geom_Curve) curve;
+        std::vector<double> params;
+        std::vector<gp_Pnt> points;
+    };
+
+    // Finds the curve parameter in [t1, t2] with f(t) = 0, where f(t1) and f(t2) have different signs
+    template <typename Func>
+    static double FindRoot(const SampledCurve& curve, Func f, double t1, double f1, double t2, double f2);
+
+    std::vector<SampledCurve> m_curves;
+    gp_Pnt m_center;
+    double m_extent;
+};
+
+} // namespace tigl
+
+#endif // CTIGLFUSELAGECROSSSECTION_H
@@ -25,9 +25,74 @@
 #include "GeomAPI_PointsToBSpline.hxx"
 
 #include <cassert>
+#include <map>
+#include <mutex>
+#include <tuple>
 
 namespace
 {
+    /// The coefficients and settings, that define the B-spline of a CST curve
+    struct CSTCurveKey
+    {
+        int algorithm;
+        int degree;
+        double tolerance;
+        double n1, n2, t;
+        std::vector<double> b;
+
+        bool operator<(const CSTCurveKey& other) const
+        {
+            return std::tie(algorithm, degree, tolerance, n1, n2, t, b) <
+                   std::tie(other.algorithm, other.degree, other.tolerance, other.n1, other.n2, other.t, other.b);
+        }
+    };
+
+    /// Process-wide cache of the CST B-splines. Many profiles share the same
+    /// coefficients, e.g. when loading many variants of a configuration.
+    class CSTCurveCache
+    {
+    public:
+        static CSTCurveCache& Instance()
+        {
+            static CSTCurveCache cache;
+            return cache;
+        }
+
+        Handle(Geom_BSplineCurve) Find(const CSTCurveKey& key)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_curves.find(key);
+            return it != m_curves.end() ? it->second : Handle(Geom_BSplineCurve)();
+        }
+
+        void Insert(const CSTCurveKey& key, const Handle(Geom_BSplineCurve)& curve)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            // limit the memory for long running processes
+            if (m_curves.size() >= maxSize) {
+                m_curves.clear();
+            }
+            m_curves[key] = curve;
+        }
+
+        void Clear()
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_curves.clear();
+        }
+
+        size_t Size()
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_curves.size();
+        }
+
+    private:
+        static const size_t maxSize = 10000;
+
+        std::mutex m_mutex;
+        std::map<CSTCurveKey, Handle(Geom_BSplineCurve)> m_curves;
+    };
 
     class CSTFunction : public tigl::MathFunc3d
     {
@@ -78,6 +143,17 @@ namespace
             return 0;
         }
 
+        void values(const std::vector<double>& t, std::vector<double>& x, std::vector<double>& y, std::vector<double>& z) override
+        {
+            x.resize(t.size());
+            for (size_t i = 0; i < t.size(); ++i) {
+                x[i] = valueX(t[i]);
+            }
+            // the Bernstein polynomials are evaluated for all points at once
+            y = tigl::cstcurve(builder->N1(), builder->N2(), builder->B(), builder->T(), x);
+            z.assign(t.size(), 0.);
+        }
+
     private:
         tigl::CCSTCurveBuilder* builder;
     };
@@ -118,6 +194,30 @@ std::vector<double> CCSTCurveBuilder::B() const
 }
 
 Handle(Geom_BSplineCurve) CCSTCurveBuilder::Curve()
+{
+    CSTCurveKey key{static_cast<int>(_algo), _degree, _tol, _n1, _n2, _t, _b};
+    Handle(Geom_BSplineCurve) curve = CSTCurveCache::Instance().Find(key);
+    if (curve.IsNull()) {
+        // computed outside of the lock, concurrent builds of the same curve yield the same result
+        curve = BuildCurve();
+        CSTCurveCache::Instance().Insert(key, curve);
+    }
+
+    // the caller may modify the curve
+    return Handle(Geom_BSplineCurve)::DownCast(curve->Copy());
+}
+
+void CCSTCurveBuilder::ClearCache()
+{
+    CSTCurveCache::Instance().Clear();
+}
+
+size_t CCSTCurveBuilder::CacheSize()
+{
+    return CSTCurveCache::Instance().Size();
+}
+
+Handle(Geom_BSplineCurve) CCSTCurveBuilder::BuildCurve()
 {
     CSTFunction function(this);
     if (_algo == Algorithm::Piecewise_Chebychev_Approximation)
@@ -22,6 +22,7 @@
 #include "tigl_internal.h"
 
 
+#include <cstddef>
 #include <vector>
 
 #include <Geom_BSplineCurve.hxx>
@@ -59,9 +60,24 @@ public:
     TIGL_EXPORT std::vector<double> B() const;
     TIGL_EXPORT double T() const;
 
+    /**
+     * @brief Returns the B-spline of the CST curve
+     *
+     * The B-splines are cached process-wide by their exact coefficients, such that
+     * profiles with the same coefficients are approximated only once. The returned
+     * curve is a copy and may be modified by the caller.
+     */
     TIGL_EXPORT Handle(Geom_BSplineCurve) Curve();
 
+    /// Removes all cached B-splines
+    TIGL_EXPORT static void ClearCache();
+
+    /// Returns the number of cached B-splines
+    TIGL_EXPORT static size_t CacheSize();
+
 private:
+    Handle(Geom_BSplineCurve) BuildCurve();
+
     double _n1, _n2, _t;
     std::vector<double> _b;
     int _degree;
@@ -118,7 +118,8 @@ public:
                            int degree,
                            double tolerance,
                            int maxDepth)
-        : _xfunc(func, FuncAdaptor::X),
+        : _func(func),
+          _xfunc(func, FuncAdaptor::X),
           _yfunc(func, FuncAdaptor::Y),
           _zfunc(func, FuncAdaptor::Z)
     {
@@ -144,6 +145,7 @@ public:
     void relaxNegligibleKinks(Handle(Geom_BSplineCurve)& curve);
 
     /// members
+    MathFunc3d& _func;
     FuncAdaptor _xfunc, _yfunc, _zfunc;
     double _umin, _umax, _tol, _err;
     int _maxDepth, _degree;
@@ -177,9 +179,13 @@ std::vector<ChebSegment> CFunctionToBspline::CFunctionToBsplineImpl::approxSegme
     // to estimate the error, we do a chebycheff approximation at higher
     // degree and evaluate the coefficients
     const int K = _degree + 4;
-    const math_Vector cx = cheb_approx(_xfunc, K+1, umin, umax);
-    const math_Vector cy = cheb_approx(_yfunc, K+1, umin, umax);
-    const math_Vector cz = cheb_approx(_zfunc, K+1, umin, umax);
+
+    // evaluate all coordinates at all nodes at once
+    std::vector<double> fx, fy, fz;
+    _func.values(cheb_nodes(K+1, umin, umax), fx, fy, fz);
+    const math_Vector cx = cheb_coefficients(fx);
+    const math_Vector cy = cheb_coefficients(fy);
+    const math_Vector cz = cheb_coefficients(fz);
     
     // estimate error
     double errx=0., erry = 0., errz = 0.;
@@ -25,6 +25,7 @@
 #include "TiglSymmetryAxis.h"
 #include "CCPACSTransformation.h"
 #include "CNamedShape.h"
+#include "CTiglPersistentShapeCache.h"
 
 // OCCT defines
 #include <BRepBuilderAPI_Transform.hxx>
@@ -37,11 +38,16 @@ namespace tigl
 CTiglAbstractGeometricComponent::CTiglAbstractGeometricComponent()
     : loft(*this, &CTiglAbstractGeometricComponent::BuildLoft)
     , bounding_box(*this, &CTiglAbstractGeometricComponent::CalcBoundingBox)
+    , point_classifier(*this, &CTiglAbstractGeometricComponent::BuildPointClassifier)
 {
 }
 
 void CTiglAbstractGeometricComponent::Reset() const {
     bounding_box.clear();
+    {
+        boost::lock_guard<boost::mutex> guard(point_classifier_mutex);
+        point_classifier.clear();
+    }
     loft.clear();
 }
 
@@ -60,6 +66,49 @@ Bnd_Box const& CTiglAbstractGeometricComponent::GetBoundingBox() const
     return *bounding_box;
 }
 
+bool CTiglAbstractGeometricComponent::IsPointInside(const gp_Pnt& pnt) const
+{
+    return GetPointClassifier()->Classify(pnt);
+}
+
+std::vector<bool> CTiglAbstractGeometricComponent::ArePointsInside(const std::vector<gp_Pnt>& pnts) const
+{
+    return GetPointClassifier()->Classify(pnts);
+}
+
+std::shared_ptr<const CTiglPointInSolidClassifier> CTiglAbstractGeometricComponent::GetPointClassifier() const
+{
+    for (;;) {
+        PNamedShape shape = GetLoft();
+        if (!shape) {
+            throw CTiglError("The component has no loft to classify points against", TIGL_ERROR);
+        }
+
+        {
+            // The lock guards the check, the clearing and the copy of a built classifier.
+            // The classifier is never built while holding it.
+            boost::lock_guard<boost::mutex> guard(point_classifier_mutex);
+            if (point_classifier.isBuilt()) {
+                if ((*point_classifier)->GetShape().IsEqual(shape->Shape())) {
+                    return *point_classifier;
+                }
+                // some components reset their loft without resetting the other caches
+                point_classifier.clear();
+            }
+        }
+
+        // Build without the lock. Concurrent callers wait in the cache for the running build
+        // and clearing waits for it as well. The result is copied in the next iteration,
+        // as the classifier might have been cleared again in the meantime.
+        point_classifier.value();
+    }
+}
+
+void CTiglAbstractGeometricComponent::BuildPointClassifier(std::shared_ptr<const CTiglPointInSolidClassifier>& classifier) const
+{
+    classifier = std::make_shared<CTiglPointInSolidClassifier>(GetLoft()->Shape());
+}
+
 PNamedShape CTiglAbstractGeometricComponent::GetMirroredLoft() const
 {
     const TiglSymmetryAxis& symmetryAxis = GetSymmetryAxis();
@@ -149,9 +198,29 @@ bool CTiglAbstractGeometricComponent::GetIsOnMirrored(const gp_Pnt& pnt) const
     return GetIsOn(mirroredPnt);
 }
 
+std::string CTiglAbstractGeometricComponent::GetPersistentCacheKey() const
+{
+    return "";
+}
+
 void CTiglAbstractGeometricComponent::BuildLoft(PNamedShape& cache) const
 {
+    CTiglPersistentShapeCache& persistentCache = CTiglPersistentShapeCache::GetInstance();
+
+    std::string key;
+    if (persistentCache.IsEnabled()) {
+        key = GetPersistentCacheKey();
+        cache = persistentCache.Load(key);
+        if (cache) {
+            return;
+        }
+    }
+
     cache = BuildLoft();
+
+    if (!key.empty()) {
+        persistentCache.Store(key, cache);
+    }
 }
 
 void CTiglAbstractGeometricComponent::CalcBoundingBox(Bnd_Box& bb) const
@@ -27,8 +27,12 @@
 
 #include "PNamedShape.h"
 #include "ITiglGeometricComponent.h"
+#include "CTiglPointInSolidClassifier.h"
 #include "Cache.h"
 
+#include <memory>
+#include <vector>
+
 #include "Bnd_Box.hxx"
 
 namespace tigl
@@ -61,11 +65,23 @@ public:
     // returns the bounding box of this component's loft
     TIGL_EXPORT Bnd_Box const& GetBoundingBox() const;
 
+    // returns true, if pnt lies inside the loft or on its boundary. The loft must be a solid.
+    // The classifier is built on the first call and reused for all further points
+    TIGL_EXPORT bool IsPointInside(const gp_Pnt& pnt) const;
+
+    // classifies multiple points in parallel, see IsPointInside
+    TIGL_EXPORT std::vector<bool> ArePointsInside(const std::vector<gp_Pnt>& pnts) const;
+
 protected:
     virtual PNamedShape BuildLoft() const = 0;
 
+    // Returns the key of the loft in the persistent shape cache (see CTiglPersistentShapeCache).
+    // An empty key, which is the default, excludes the loft from the persistent cache.
+    virtual std::string GetPersistentCacheKey() const;
+
     Cache<PNamedShape, CTiglAbstractGeometricComponent> loft;
     Cache<Bnd_Box, CTiglAbstractGeometricComponent> bounding_box;
+    Cache<std::shared_ptr<const CTiglPointInSolidClassifier>, CTiglAbstractGeometricComponent> point_classifier;
 
 private:
     CTiglAbstractGeometricComponent(const CTiglAbstractGeometricComponent&);
@@ -73,6 +89,13 @@ private:
 
     void BuildLoft(PNamedShape& cache) const;
     void CalcBoundingBox(Bnd_Box& bb) const;
+    void BuildPointClassifier(std::shared_ptr<const CTiglPointInSolidClassifier>& classifier) const;
+    std::shared_ptr<const CTiglPointInSolidClassifier> GetPointClassifier() const;
+
+    // guards the replacement of an outdated point classifier and the copy of the built one,
+    // but is not held while the classifier is built. The callers share the ownership of
+    // the classifier, so it stays valid while they classify.
+    mutable boost::mutex point_classifier_mutex;
 };
 
 } // end namespace tigl
@@ -1015,10 +1015,14 @@ Handle(Geom_BSplineCurve) CTiglBSplineAlgorithms::reparameterizePiecewiseLinear(
 }
 
 math_Matrix CTiglBSplineAlgorithms::bsplineBasisMat(int degree, const TColStd_Array1OfReal& knots, const TColStd_Array1OfReal& params, unsigned int derivOrder)
+{
+    return bsplineBasisMatSparse(degree, knots, params, derivOrder).ToDense();
+}
+
+CTiglSparseMatrix CTiglBSplineAlgorithms::bsplineBasisMatSparse(int degree, const TColStd_Array1OfReal& knots, const TColStd_Array1OfReal& params, unsigned int derivOrder)
 {
     Standard_Integer ncp = knots.Length() - degree - 1;
-    math_Matrix mx(1, params.Length(), 1, ncp);
-    mx.Init(0.);
+    CTiglSparseMatrix mx(params.Length(), ncp);
     math_Matrix bspl_basis(1, derivOrder + 1, 1, degree + 1);
     bspl_basis.Init(0.);
     for (Standard_Integer iparm = 1; iparm <= params.Length(); ++iparm) {
@@ -1028,14 +1032,8 @@ math_Matrix CTiglBSplineAlgorithms::bsplineBasisMat(int degree, const TColStd_Ar
 #else
         BSplCLib::EvalBsplineBasis(1, derivOrder, degree + 1, knots, params.Value(iparm), basis_start_index, bspl_basis);
 #endif
-        if(derivOrder > 0) {
-            math_Vector help_vector(1, ncp);
-            help_vector.Init(0.);
-            help_vector.Set(basis_start_index, basis_start_index + degree, bspl_basis.Row(derivOrder + 1));
-            mx.SetRow(iparm, help_vector);
-        }
-        else {
-            mx.Set(iparm, iparm, basis_start_index, basis_start_index + degree, bspl_basis);
+        for (Standard_Integer i = 1; i <= degree + 1; ++i) {
+            mx.Add(iparm - 1, basis_start_index + i - 2, bspl_basis(derivOrder + 1, i));
         }
     }
     return mx;
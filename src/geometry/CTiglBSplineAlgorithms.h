@@ -21,6 +21,7 @@
 
 #include "tigl_internal.h"
 #include "CTiglApproxResult.h"
+#include "CTiglSparseMatrix.h"
 
 #include <Geom_BSplineCurve.hxx>
 #include <Geom_BSplineSurface.hxx>
@@ -87,6 +88,16 @@ public:
      */
     TIGL_EXPORT static math_Matrix bsplineBasisMat(int degree, const TColStd_Array1OfReal& flatKnots, const TColStd_Array1OfReal& params, unsigned int derivOrder=0);
 
+    /**
+     * @brief Computes the bspline basis matrix of size (params.Length(), flatKnots.Length() - degree - 1)
+     * in compressed row storage. Each row has degree + 1 nonzero entries.
+     * @param degree    Degree of the bspline
+     * @param flatKnots Flatted know vector
+     * @param params    Parameters of B-Spline evaluation
+     * @return          The sparse B-spline matrix
+     */
+    TIGL_EXPORT static CTiglSparseMatrix bsplineBasisMatSparse(int degree, const TColStd_Array1OfReal& flatKnots, const TColStd_Array1OfReal& params, unsigned int derivOrder=0);
+
     /**
      * @brief computeParamsBSplineSurf:
      *          Computes the parameters of a Geom_BSplineSurface at the given points
@@ -20,6 +20,8 @@
 
 #include <CTiglError.h>
 #include <CTiglBSplineAlgorithms.h>
+#include "CTiglSparseMatrix.h"
+#include "CTiglSymmetricBandMatrix.h"
 
 #include <TColgp_Array1OfPnt.hxx>
 #include <Geom_BSplineCurve.hxx>
@@ -89,6 +91,7 @@ CTiglBSplineApproxInterp::CTiglBSplineApproxInterp(const TColgp_Array1OfPnt& poi
     , m_degree(degree)
     , m_ncp(nControlPoints)
     , m_C2Continuous(continuous_if_closed)
+    , m_useDenseSolver(false)
 {
     for (Standard_Integer i = 0; i < points.Length(); ++i) {
         size_t idx = static_cast<size_t>(i);
@@ -112,6 +115,11 @@ void CTiglBSplineApproxInterp::InterpolatePoint(size_t pointIndex, bool withKink
     }
 }
 
+void CTiglBSplineApproxInterp::SetUseDenseSolver(bool useDenseSolver)
+{
+    m_useDenseSolver = useDenseSolver;
+}
+
 double CTiglBSplineApproxInterp::maxDistanceOfBoundingBox(const TColgp_Array1OfPnt& points) const
 {
     gp_Pnt max(-DBL_MAX, -DBL_MAX, -DBL_MAX);
@@ -383,6 +391,143 @@ CTiglApproxResult CTiglBSplineApproxInterp::solve(const std::vector<double>& par
         throw tigl::CTiglError("Wrong number of control points for curve interpolation!");
     }
 
+    TColgp_Array1OfPnt poles(1, nCtrPnts);
+    if (m_useDenseSolver || !solveBanded(params, flatKnots, n_continuityConditions, poles)) {
+        solveDense(params, flatKnots, n_continuityConditions, poles);
+    }
+
+    CTiglApproxResult result;
+    result.curve = new Geom_BSplineCurve(poles, knots, mults, m_degree, false);
+
+    // Create gp_Pnt vectors containing the exact points and their projections on the created
+    // approximation function, respectively, to compute the approximation error
+    gp_Pnt curvePnt;
+    std::vector<gp_Pnt> pnts;
+    std::vector<gp_Pnt> curveEval;
+
+    for (std::vector<size_t>::const_iterator it_idx = m_indexOfApproximated.begin(); it_idx != m_indexOfApproximated.end(); ++it_idx) {
+        Standard_Integer ipnt = static_cast<Standard_Integer>(*it_idx + 1);
+
+        pnts.push_back(m_pnts.Value(ipnt));
+
+        double param = params[*it_idx];
+        double projectedParam = projectOnCurve(pnts.back(), result.curve, param).parameter;
+        curveEval.push_back(result.curve->Value(projectedParam));
+    }
+
+    result.error = calcErrorFct(pnts, curveEval);
+
+    return result;
+}
+
+/**
+ * @brief Solves the constrained least squares problem using the band structure
+ * of the normal equations A^T*A, which have degree + 1 nonzeros per row.
+ *
+ * The constraints C*x = d are eliminated by the Schur complement C*(A^T*A)^-1*C^T,
+ * which is small as long as only few points are interpolated. Returns false, if
+ * A^T*A is not positive definite, e.g. if a knot span contains no approximated points.
+ */
+bool CTiglBSplineApproxInterp::solveBanded(const std::vector<double>& params, const TColStd_Array1OfReal& flatKnots,
+                                           int n_continuityConditions, TColgp_Array1OfPnt& poles) const
+{
+    Standard_Integer n_intpolated = static_cast<Standard_Integer>(m_indexOfInterpolated.size());
+    Standard_Integer n_constraints = n_intpolated + n_continuityConditions;
+    Standard_Integer nCtrPnts = poles.Length();
+
+    if (m_indexOfApproximated.empty()) {
+        return false;
+    }
+
+    // Assemble the normal equations A^T*A x = A^T*b for all coordinates at once
+    Standard_Integer n_apprxmated = static_cast<Standard_Integer>(m_indexOfApproximated.size());
+    TColStd_Array1OfReal appParams(1, n_apprxmated);
+    math_Matrix b(1, n_apprxmated, 1, 3);
+    Standard_Integer appIndex = 1;
+    for (std::vector<size_t>::const_iterator it_idx = m_indexOfApproximated.begin(); it_idx != m_indexOfApproximated.end(); ++it_idx) {
+        const gp_Pnt& p = m_pnts.Value(static_cast<Standard_Integer>(*it_idx + 1));
+        b(appIndex, 1) = p.X();
+        b(appIndex, 2) = p.Y();
+        b(appIndex, 3) = p.Z();
+        appParams(appIndex) = params[*it_idx];
+        appIndex++;
+    }
+
+    CTiglSparseMatrix A = CTiglBSplineAlgorithms::bsplineBasisMatSparse(m_degree, flatKnots, appParams);
+    CTiglSymmetricBandMatrix lhs = A.TransposeMultipliedSelf();
+    math_Matrix rhs = A.TransposeMultiplied(b);
+
+    if (!lhs.Factorize()) {
+        return false;
+    }
+    lhs.Solve(rhs);
+
+    if (n_constraints > 0) {
+        // Constraints C*x = d of the interpolated points and the closing continuity
+        math_Matrix C(1, n_constraints, 1, nCtrPnts, 0.);
+        math_Matrix d(1, n_constraints, 1, 3, 0.);
+        if (n_intpolated > 0) {
+            TColStd_Array1OfReal interpParams(1, n_intpolated);
+            Standard_Integer intpIndex = 1;
+            for (std::vector<size_t>::const_iterator it_idx = m_indexOfInterpolated.begin(); it_idx != m_indexOfInterpolated.end(); ++it_idx) {
+                const gp_Pnt& p = m_pnts.Value(static_cast<Standard_Integer>(*it_idx + 1));
+                d(intpIndex, 1) = p.X();
+                d(intpIndex, 2) = p.Y();
+                d(intpIndex, 3) = p.Z();
+                interpParams(intpIndex) = params[*it_idx];
+                intpIndex++;
+            }
+            C.Set(1, n_intpolated, 1, nCtrPnts, CTiglBSplineAlgorithms::bsplineBasisMat(m_degree, flatKnots, interpParams));
+        }
+        if (n_continuityConditions > 0) {
+            C.Set(n_intpolated + 1, n_constraints, 1, nCtrPnts, getContinuityMatrix(nCtrPnts, n_continuityConditions, params, flatKnots));
+        }
+
+        // The solution x = x0 - Y*lambda with Y = (A^T*A)^-1 * C^T
+        // must fulfill C*x = d, hence (C*Y)*lambda = C*x0 - d
+        math_Matrix Y = C.Transposed();
+        lhs.Solve(Y);
+
+        math_Gauss schur(C.Multiplied(Y));
+        if (!schur.IsDone()) {
+            return false;
+        }
+
+        math_Matrix residual = C.Multiplied(rhs) - d;
+        math_Vector lambda(1, n_constraints);
+        for (Standard_Integer icoord = 1; icoord <= 3; ++icoord) {
+            schur.Solve(residual.Col(icoord), lambda);
+            if (!schur.IsDone()) {
+                return false;
+            }
+            for (Standard_Integer icp = 1; icp <= nCtrPnts; ++icp) {
+                double correction = 0.;
+                for (Standard_Integer k = 1; k <= n_constraints; ++k) {
+                    correction += Y(icp, k) * lambda(k);
+                }
+                rhs(icp, icoord) -= correction;
+            }
+        }
+    }
+
+    for (Standard_Integer icp = 1; icp <= nCtrPnts; ++icp) {
+        poles.SetValue(icp, gp_Pnt(rhs(icp, 1), rhs(icp, 2), rhs(icp, 3)));
+    }
+    return true;
+}
+
+/**
+ * @brief Solves the constrained least squares problem with the dense
+ * KKT system of the normal equations and the constraints.
+ */
+void CTiglBSplineApproxInterp::solveDense(const std::vector<double>& params, const TColStd_Array1OfReal& flatKnots,
+                                          int n_continuityConditions, TColgp_Array1OfPnt& poles) const
+{
+    Standard_Integer n_apprxmated = static_cast<Standard_Integer>(m_indexOfApproximated.size());
+    Standard_Integer n_intpolated = static_cast<Standard_Integer>(m_indexOfInterpolated.size());
+    Standard_Integer nCtrPnts = poles.Length();
+    bool makeClosed = n_continuityConditions > 0;
+
     // Build left hand side of the equation
     Standard_Integer n_vars = nCtrPnts + n_intpolated + n_continuityConditions;
     math_Matrix lhs(1, n_vars, 1, n_vars);
@@ -416,14 +561,18 @@ CTiglApproxResult CTiglBSplineApproxInterp::solve(const std::vector<double>& par
         // Create left hand side block matrix
         // A.T*A  C.T
         // C      0
-        math_Matrix A = CTiglBSplineAlgorithms::bsplineBasisMat(m_degree, flatKnots, appParams);
-        math_Matrix At = A.Transposed();
+        CTiglSparseMatrix A = CTiglBSplineAlgorithms::bsplineBasisMatSparse(m_degree, flatKnots, appParams);
 
-        lhs.Set(1, nCtrPnts, 1, nCtrPnts, At.Multiplied(A));
+        lhs.Set(1, nCtrPnts, 1, nCtrPnts, A.TransposeMultipliedSelf().ToDense());
 
-        rhsx.Set(1, nCtrPnts, At.Multiplied(bx));
-        rhsy.Set(1, nCtrPnts, At.Multiplied(by));
-        rhsz.Set(1, nCtrPnts, At.Multiplied(bz));
+        math_Matrix b(1, n_apprxmated, 1, 3);
+        b.SetCol(1, bx);
+        b.SetCol(2, by);
+        b.SetCol(3, bz);
+        math_Matrix Atb = A.TransposeMultiplied(b);
+        rhsx.Set(1, nCtrPnts, Atb.Col(1));
+        rhsy.Set(1, nCtrPnts, Atb.Col(2));
+        rhsz.Set(1, nCtrPnts, Atb.Col(3));
     }
 
     if (n_intpolated + n_continuityConditions > 0) {
@@ -481,34 +630,10 @@ CTiglApproxResult CTiglBSplineApproxInterp::solve(const std::vector<double>& par
         throw CTiglError("Singular Matrix", TIGL_MATH_ERROR);
     }
 
-    TColgp_Array1OfPnt poles(1, nCtrPnts);
     for (Standard_Integer icp = 1; icp <= nCtrPnts; ++icp) {
         gp_Pnt pnt(cp_x.Value(icp), cp_y.Value(icp), cp_z.Value(icp));
         poles.SetValue(icp, pnt);
     }
-
-    CTiglApproxResult result;
-    result.curve = new Geom_BSplineCurve(poles, knots, mults, m_degree, false);
-
-    // Create gp_Pnt vectors containing the exact points and their projections on the created
-    // approximation function, respectively, to compute the approximation error
-    gp_Pnt curvePnt;
-    std::vector<gp_Pnt> pnts;
-    std::vector<gp_Pnt> curveEval;
-
-    for (std::vector<size_t>::const_iterator it_idx = m_indexOfApproximated.begin(); it_idx != m_indexOfApproximated.end(); ++it_idx) {
-        Standard_Integer ipnt = static_cast<Standard_Integer>(*it_idx + 1);
-
-        pnts.push_back(m_pnts.Value(ipnt));
-
-        double param = params[*it_idx];
-        double projectedParam = projectOnCurve(pnts.back(), result.curve, param).parameter;
-        curveEval.push_back(result.curve->Value(projectedParam));
-    }
-
-    result.error = calcErrorFct(pnts, curveEval);
-
-    return result;
 }
 
 /**
@@ -62,6 +62,10 @@ public:
     /// Important: Parameters of points that are interpolated are not optimized
     TIGL_EXPORT CTiglApproxResult FitCurveOptimal(const std::vector<double>& initialParms = std::vector<double>(), int maxIter=10, CalcPointVecErrorFct calcErrorFct=calcPointVecErrorMax) const;
 
+    /// Solves the least squares systems with dense matrices instead of band matrices,
+    /// e.g. to cross-check the results. Disabled by default.
+    TIGL_EXPORT void SetUseDenseSolver(bool useDenseSolver);
+
 private:
     ProjectResult projectOnCurve(const gp_Pnt& pnt, const Handle(Geom_Curve)& curve, double initial_Parm) const;
     std::vector<double> computeParameters(double alpha) const;
@@ -69,6 +73,10 @@ private:
 
     CTiglApproxResult solve(const std::vector<double>& params, const TColStd_Array1OfReal& knots, const TColStd_Array1OfInteger& mults,
                             CalcPointVecErrorFct calcErrorFct=calcPointVecErrorMax) const;
+    bool solveBanded(const std::vector<double>& params, const TColStd_Array1OfReal& flatKnots,
+                     int n_continuityConditions, TColgp_Array1OfPnt& poles) const;
+    void solveDense(const std::vector<double>& params, const TColStd_Array1OfReal& flatKnots,
+                    int n_continuityConditions, TColgp_Array1OfPnt& poles) const;
     math_Matrix getContinuityMatrix(int nCtrPnts, int contin_cons, const std::vector<double>& params, const TColStd_Array1OfReal& flatKnots) const;
 
     void optimizeParameters(const Handle(Geom_Curve)& curve, std::vector<double>& parms) const;
@@ -94,6 +102,9 @@ private:
 
     /// determines the continuous closing of curve
     bool  m_C2Continuous;
+
+    /// solve with the dense KKT system instead of the band matrix
+    bool  m_useDenseSolver;
 };
 
 } // namespace tigl
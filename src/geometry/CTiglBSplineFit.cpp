@@ -15,6 +15,7 @@
  */
 
 #include "CTiglBSplineFit.h"
+#include "CTiglSymmetricBandMatrix.h"
 
 #include <Standard_Version.hxx>
 #include <TColStd_Array1OfReal.hxx>
@@ -37,6 +38,7 @@ BSplineFit::BSplineFit( int deg, int ncp)
     : _degree(deg)
     , _ncp(ncp)
     , _knots(1, ncp + deg + 1)
+    , _useDenseSolver(false)
 {
     computeKnots();
 }
@@ -69,11 +71,10 @@ void BSplineFit::copyPoints( const TColgp_Array1OfPnt& points )
 /**
  * @brief Initializes linear equation system for least square fit
  */
-void BSplineFit::initSystem(math_Matrix& A, math_Vector& rhsx, math_Vector& rhsy, math_Vector& rhsz)
+void BSplineFit::initSystem(tigl::CTiglSymmetricBandMatrix& A, math_Vector& rhsx, math_Vector& rhsy, math_Vector& rhsz)
 {
 
-    // init matrices and vectors
-    A.Init(0.);
+    // init vectors, the matrix is zero initialized
     rhsx.Init(0.);
     rhsy.Init(0.);
     rhsz.Init(0.);
@@ -116,10 +117,10 @@ void BSplineFit::initSystem(math_Matrix& A, math_Vector& rhsx, math_Vector& rhsy
             N1 = bspl_basis.Value(1, order);
         }
 
-        // compute matrix values
+        // compute matrix values, the band matrix is symmetric by construction
         for (int i=start; i < stop; ++i ) {
             for (int j=i; j < stop; ++j ) {
-                A(i, j) += bspl_basis.Value(1, i+1-basis_start_index)*bspl_basis.Value(1, j+1-basis_start_index);
+                A.Add(i-1, j-1, bspl_basis.Value(1, i+1-basis_start_index)*bspl_basis.Value(1, j+1-basis_start_index));
             }
         }
 
@@ -131,13 +132,6 @@ void BSplineFit::initSystem(math_Matrix& A, math_Vector& rhsx, math_Vector& rhsy
         }
 
     } //  loop over all curve points
-
-    // symmetrize the matrix of the LES
-    for (int i=2; i <= n_vars; ++i ) {
-        for (int j=1; j < i; ++j ) {
-            A(i, j) = A(j, i);
-        }
-    }
 }
 
 
@@ -348,6 +342,11 @@ BSplineFit::error BSplineFit::FitOptimal(const TColgp_Array1OfPnt &points, doubl
 }
 
 
+void BSplineFit::SetUseDenseSolver(bool useDenseSolver)
+{
+    _useDenseSolver = useDenseSolver;
+}
+
 Handle_Geom_BSplineCurve BSplineFit::Curve() const
 {
     return _curve;
@@ -401,25 +400,39 @@ BSplineFit::error BSplineFit::fitCurve()
     math_Vector cy(1,n_vars);
     math_Vector cz(1,n_vars);
 
-    math_Matrix A(1, n_vars, 1, n_vars);
+    // the basis functions of each parameter span degree+1 control points
+    tigl::CTiglSymmetricBandMatrix A(n_vars, _degree);
 
     initSystem(A, cx, cy, cz);
 
-    math_Gauss solver(A);
-
-    solver.Solve(cx, X);
-    if (!solver.IsDone()) {
-        return MatrixSingular;
+    // the factorization overwrites the band, even if it fails. Hence, we factorize
+    // a copy to keep the original system for the dense fallback
+    tigl::CTiglSymmetricBandMatrix L(A);
+    if (!_useDenseSolver && L.Factorize()) {
+        X = cx;
+        Y = cy;
+        Z = cz;
+        L.Solve(X);
+        L.Solve(Y);
+        L.Solve(Z);
     }
+    else {
+        math_Gauss solver(A.ToDense());
 
-    solver.Solve(cy, Y);
-    if (!solver.IsDone()) {
-        return MatrixSingular;
-    }
+        solver.Solve(cx, X);
+        if (!solver.IsDone()) {
+            return MatrixSingular;
+        }
 
-    solver.Solve(cz, Z);
-    if (!solver.IsDone()) {
-        return MatrixSingular;
+        solver.Solve(cy, Y);
+        if (!solver.IsDone()) {
+            return MatrixSingular;
+        }
+
+        solver.Solve(cz, Z);
+        if (!solver.IsDone()) {
+            return MatrixSingular;
+        }
     }
 
     // copy solution to control point vector
@@ -25,6 +25,11 @@
 #include <TColgp_Array1OfPnt.hxx>
 #include <math_Vector.hxx>
 
+namespace tigl
+{
+class CTiglSymmetricBandMatrix;
+}
+
 class BSplineFit
 {
 
@@ -56,6 +61,10 @@ public:
     /// This is an iterative algorithm and requires more time than the other fit algorithms
     TIGL_EXPORT error FitOptimal(const TColgp_Array1OfPnt& points, double alpha=1.0, double eps=1.0E-3, int maxIter=100);
 
+    /// Solves the least squares system with a dense matrix instead of
+    /// the band matrix, e.g. to cross-check the results
+    TIGL_EXPORT void SetUseDenseSolver(bool useDenseSolver);
+
     /// Returns the resulting curve. Returns
     /// Null in case of an error
     TIGL_EXPORT Handle_Geom_BSplineCurve Curve() const;
@@ -70,7 +79,7 @@ private:
 
 
     /// Computes the matrix and the right hand side of the system to be solved
-    void initSystem(class math_Matrix& A, math_Vector& rhsx, math_Vector& rhsy, math_Vector& rhsz);
+    void initSystem(tigl::CTiglSymmetricBandMatrix& A, math_Vector& rhsx, math_Vector& rhsy, math_Vector& rhsz);
 
     /// Computes an uniform knot vector
     void computeKnots();
@@ -105,6 +114,9 @@ private:
     std::vector<double> _py;
     std::vector<double> _pz;
 
+    /// solve with a dense matrix instead of the band matrix
+    bool _useDenseSolver;
+
 };
 
 #endif
@@ -0,0 +1,278 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "CTiglBoundingVolumeHierarchy.h"
+#include "CTiglError.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace tigl
+{
+
+namespace
+{
+    // slab test of a ray against a box
+    bool rayHitsBox(const Bnd_Box& box, const double origin[3], const double invDir[3])
+    {
+        double bmin[3], bmax[3];
+        box.Get(bmin[0], bmin[1], bmin[2], bmax[0], bmax[1], bmax[2]);
+
+        double tmin = 0.;
+        double tmax = std::numeric_limits<double>::max();
+        for (int i = 0; i < 3; ++i) {
+            if (std::isinf(invDir[i])) {
+                // ray parallel to the slab
+                if (origin[i] < bmin[i] || origin[i] > bmax[i]) {
+                    return false;
+                }
+                continue;
+            }
+            double t1 = (bmin[i] - origin[i]) * invDir[i];
+            double t2 = (bmax[i] - origin[i]) * invDir[i];
+            tmin = std::max(tmin, std::min(t1, t2));
+            tmax = std::min(tmax, std::max(t1, t2));
+            if (tmin > tmax) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    double center(const Bnd_Box& box, int axis)
+    {
+        double xmin, ymin, zmin, xmax, ymax, zmax;
+        box.Get(xmin, ymin, zmin, xmax, ymax, zmax);
+        switch (axis) {
+        case 0:
+            return 0.5 * (xmin + xmax);
+        case 1:
+            return 0.5 * (ymin + ymax);
+        default:
+            return 0.5 * (zmin + zmax);
+        }
+    }
+}
+
+CTiglBoundingVolumeHierarchy::CTiglBoundingVolumeHierarchy(const std::vector<Bnd_Box>& boxes, size_t maxLeafSize)
+{
+    Build(boxes, maxLeafSize);
+}
+
+void CTiglBoundingVolumeHierarchy::Build(const std::vector<Bnd_Box>& boxes, size_t maxLeafSize)
+{
+    m_boxes = boxes;
+    m_order.clear();
+    m_nodes.clear();
+
+    for (size_t i = 0; i < m_boxes.size(); ++i) {
+        if (!m_boxes[i].IsVoid()) {
+            m_order.push_back(i);
+        }
+    }
+
+    if (!m_order.empty()) {
+        m_nodes.reserve(2 * m_order.size());
+        BuildNode(0, m_order.size(), std::max(maxLeafSize, size_t(1)));
+    }
+}
+
+int CTiglBoundingVolumeHierarchy::BuildNode(size_t first, size_t count, size_t maxLeafSize)
+{
+    int nodeIndex = static_cast<int>(m_nodes.size());
+    m_nodes.push_back(Node());
+
+    Bnd_Box box;
+    for (size_t i = first; i < first + count; ++i) {
+        box.Add(m_boxes[m_order[i]]);
+    }
+    m_nodes[nodeIndex].box = box;
+
+    if (count <= maxLeafSize) {
+        m_nodes[nodeIndex].first = first;
+        m_nodes[nodeIndex].count = count;
+        return nodeIndex;
+    }
+
+    // split at the median of the longest axis
+    double xmin, ymin, zmin, xmax, ymax, zmax;
+    box.Get(xmin, ymin, zmin, xmax, ymax, zmax);
+    int axis = 0;
+    if (ymax - ymin > xmax - xmin) {
+        axis = 1;
+    }
+    if (zmax - zmin > std::max(xmax - xmin, ymax - ymin)) {
+        axis = 2;
+    }
+
+    size_t half = count / 2;
+    std::nth_element(m_order.begin() + first, m_order.begin() + first + half, m_order.begin() + first + count,
+                     [this, axis](size_t a, size_t b) {
+        return center(m_boxes[a], axis) < center(m_boxes[b], axis);
+    });
+
+    int left  = BuildNode(first, half, maxLeafSize);
+    int right = BuildNode(first + half, count - half, maxLeafSize);
+    m_nodes[nodeIndex].left  = left;
+    m_nodes[nodeIndex].right = right;
+    return nodeIndex;
+}
+
+size_t CTiglBoundingVolumeHierarchy::Size() const
+{
+    return m_boxes.size();
+}
+
+const Bnd_Box& CTiglBoundingVolumeHierarchy::GetBox(size_t index) const
+{
+    if (index >= m_boxes.size()) {
+        throw CTiglError("Invalid box index in CTiglBoundingVolumeHierarchy::GetBox", TIGL_INDEX_ERROR);
+    }
+    return m_boxes[index];
+}
+
+Bnd_Box CTiglBoundingVolumeHierarchy::GetBoundingBox() const
+{
+    if (m_nodes.empty()) {
+        return Bnd_Box();
+    }
+    return m_nodes[0].box;
+}
+
+double CTiglBoundingVolumeHierarchy::SquareDistance(const Bnd_Box& box, const gp_Pnt& p)
+{
+    double xmin, ymin, zmin, xmax, ymax, zmax;
+    box.Get(xmin, ymin, zmin, xmax, ymax, zmax);
+
+    double dx = std::max(std::max(xmin - p.X(), 0.), p.X() - xmax);
+    double dy = std::max(std::max(ymin - p.Y(), 0.), p.Y() - ymax);
+    double dz = std::max(std::max(zmin - p.Z(), 0.), p.Z() - zmax);
+    return dx*dx + dy*dy + dz*dz;
+}
+
+std::vector<size_t> CTiglBoundingVolumeHierarchy::FindNear(const gp_Pnt& p, double tolerance) const
+{
+    std::vector<std::pair<double, size_t>> found;
+    if (m_nodes.empty()) {
+        return std::vector<size_t>();
+    }
+
+    const double tol2 = tolerance * tolerance;
+    std::vector<int> stack(1, 0);
+    while (!stack.empty()) {
+        const Node& node = m_nodes[stack.back()];
+        stack.pop_back();
+
+        if (SquareDistance(node.box, p) > tol2) {
+            continue;
+        }
+
+        if (node.left < 0) {
+            for (size_t i = node.first; i < node.first + node.count; ++i) {
+                double dist2 = SquareDistance(m_boxes[m_order[i]], p);
+                if (dist2 <= tol2) {
+                    found.push_back(std::make_pair(dist2, m_order[i]));
+                }
+            }
+        }
+        else {
+            stack.push_back(node.left);
+            stack.push_back(node.right);
+        }
+    }
+
+    std::sort(found.begin(), found.end());
+
+    std::vector<size_t> result;
+    result.reserve(found.size());
+    for (const auto& entry : found) {
+        result.push_back(entry.second);
+    }
+    return result;
+}
+
+std::vector<size_t> CTiglBoundingVolumeHierarchy::FindAlongRay(const gp_Pnt& origin, const gp_Dir& direction) const
+{
+    std::vector<size_t> result;
+    if (m_nodes.empty()) {
+        return result;
+    }
+
+    const double o[3] = {origin.X(), origin.Y(), origin.Z()};
+    const double invDir[3] = {1. / direction.X(), 1. / direction.Y(), 1. / direction.Z()};
+
+    std::vector<int> stack(1, 0);
+    while (!stack.empty()) {
+        const Node& node = m_nodes[stack.back()];
+        stack.pop_back();
+
+        if (!rayHitsBox(node.box, o, invDir)) {
+            continue;
+        }
+
+        if (node.left < 0) {
+            for (size_t i = node.first; i < node.first + node.count; ++i) {
+                if (rayHitsBox(m_boxes[m_order[i]], o, invDir)) {
+                    result.push_back(m_order[i]);
+                }
+            }
+        }
+        else {
+            stack.push_back(node.left);
+            stack.push_back(node.right);
+        }
+    }
+
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+std::vector<size_t> CTiglBoundingVolumeHierarchy::FindIntersecting(const Bnd_Box& box) const
+{
+    std::vector<size_t> result;
+    if (m_nodes.empty() || box.IsVoid()) {
+        return result;
+    }
+
+    std::vector<int> stack(1, 0);
+    while (!stack.empty()) {
+        const Node& node = m_nodes[stack.back()];
+        stack.pop_back();
+
+        if (node.box.IsOut(box)) {
+            continue;
+        }
+
+        if (node.left < 0) {
+            for (size_t i = node.first; i < node.first + node.count; ++i) {
+                if (!m_boxes[m_order[i]].IsOut(box)) {
+                    result.push_back(m_order[i]);
+                }
+            }
+        }
+        else {
+            stack.push_back(node.left);
+            stack.push_back(node.right);
+        }
+    }
+
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+} // namespace tigl
@@ -0,0 +1,92 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @brief A bounding volume hierarchy over a list of axis aligned boxes.
+ *
+ * The hierarchy is a binary tree, that is built once by splitting the boxes
+ * at the median of the longest axis. It answers queries for all boxes near a point,
+ * hit by a ray or intersecting another box in logarithmic time. The queries return the indices
+ * of the boxes in the list passed to Build.
+ */
+
+#ifndef CTIGLBOUNDINGVOLUMEHIERARCHY_H
+#define CTIGLBOUNDINGVOLUMEHIERARCHY_H
+
+#include "tigl_internal.h"
+
+#include <Bnd_Box.hxx>
+#include <gp_Dir.hxx>
+#include <gp_Pnt.hxx>
+
+#include <vector>
+
+namespace tigl
+{
+
+class CTiglBoundingVolumeHierarchy
+{
+public:
+    TIGL_EXPORT CTiglBoundingVolumeHierarchy() = default;
+
+    TIGL_EXPORT explicit CTiglBoundingVolumeHierarchy(const std::vector<Bnd_Box>& boxes, size_t maxLeafSize = 4);
+
+    /// Builds the hierarchy. Void boxes are never returned by any query.
+    TIGL_EXPORT void Build(const std::vector<Bnd_Box>& boxes, size_t maxLeafSize = 4);
+
+    /// Returns the number of boxes in the hierarchy
+    TIGL_EXPORT size_t Size() const;
+
+    /// Returns the box with the given index
+    TIGL_EXPORT const Bnd_Box& GetBox(size_t index) const;
+
+    /// Returns the bounding box of all boxes
+    TIGL_EXPORT Bnd_Box GetBoundingBox() const;
+
+    /// Returns the indices of all boxes with a distance to p less or equal than tolerance,
+    /// sorted by ascending distance
+    TIGL_EXPORT std::vector<size_t> FindNear(const gp_Pnt& p, double tolerance = 0.) const;
+
+    /// Returns the indices of all boxes intersecting the given box in ascending order
+    TIGL_EXPORT std::vector<size_t> FindIntersecting(const Bnd_Box& box) const;
+
+    /// Returns the indices of all boxes hit by the ray starting at origin in the given direction,
+    /// in ascending order
+    TIGL_EXPORT std::vector<size_t> FindAlongRay(const gp_Pnt& origin, const gp_Dir& direction) const;
+
+    /// Returns the squared distance between a point and a box, zero if the point is inside
+    TIGL_EXPORT static double SquareDistance(const Bnd_Box& box, const gp_Pnt& p);
+
+private:
+    struct Node
+    {
+        Bnd_Box box;
+        int left = -1;
+        int right = -1;
+        size_t first = 0; // index range into m_order for leaves
+        size_t count = 0;
+    };
+
+    int BuildNode(size_t first, size_t count, size_t maxLeafSize);
+
+    std::vector<Bnd_Box> m_boxes;
+    std::vector<size_t> m_order;
+    std::vector<Node> m_nodes;
+};
+
+} // namespace tigl
+
+#endif // CTIGLBOUNDINGVOLUMEHIERARCHY_H
@@ -25,10 +25,13 @@
 #include "tiglcommonfunctions.h"
 #include "CTiglGordonSurfaceBuilder.h"
 #include "Debugging.h"
+#include "tiglparallel.h"
 
 #include <algorithm>
+#include <exception>
 
 #include <math_Matrix.hxx>
+#include <Bnd_Box.hxx>
 #include <TColStd_HArray1OfReal.hxx>
 #include <GeomConvert.hxx>
 
@@ -39,6 +42,7 @@ CTiglInterpolateCurveNetwork::CTiglInterpolateCurveNetwork(const std::vector<Han
                                                            const std::vector<Handle (Geom_Curve)> &guides,
                                                            double spatialTol)
     : m_hasPerformed(false)
+    , m_parallel(true)
     , m_spatialTol(spatialTol)
 {
     // check whether there are any u-directional and v-directional B-splines in the vectors
@@ -63,20 +67,75 @@ CTiglInterpolateCurveNetwork::CTiglInterpolateCurveNetwork(const std::vector<Han
 }
 
 
+namespace
+{
+
+// Returns the bounding box of the control points enlarged by the intersection tolerance.
+// Due to the convex hull property, the curve lies inside of this box.
+Bnd_Box controlPolygonBox(const Handle(Geom_BSplineCurve)& curve, double spatialTol)
+{
+    Bnd_Box box;
+    for (int i = 1; i <= curve->NbPoles(); ++i) {
+        box.Add(curve->Pole(i));
+    }
+    box.Enlarge(spatialTol * CTiglBSplineAlgorithms::scale(curve));
+    return box;
+}
+
+} // namespace
+
 void CTiglInterpolateCurveNetwork::ComputeIntersections(math_Matrix& intersection_params_u,
                                                         math_Matrix& intersection_params_v) const
 {
     const std::vector<Handle(Geom_BSplineCurve)>& profiles = m_profiles;
     const std::vector<Handle(Geom_BSplineCurve)>& guides = m_guides;
-    
+
+    const int nProfiles = static_cast<int>(profiles.size());
+    const int nGuides = static_cast<int>(guides.size());
+
+    // pairs with disjoint control polygon boxes can't intersect
+    std::vector<Bnd_Box> profileBoxes, guideBoxes;
+    for (const auto& profile : profiles) {
+        profileBoxes.push_back(controlPolygonBox(profile, m_spatialTol));
+    }
+    for (const auto& guide : guides) {
+        guideBoxes.push_back(controlPolygonBox(guide, m_spatialTol));
+    }
+
+    // The pairs are independent. Each task writes only its own entries, which are
+    // evaluated below in a fixed order. Hence, the result and the reported error
+    // don't depend on the number of threads.
+    const size_t nPairs = static_cast<size_t>(nProfiles) * static_cast<size_t>(nGuides);
+    std::vector<std::vector<std::pair<double, double> > > pairIntersections(nPairs);
+    std::vector<std::exception_ptr> pairErrors(nPairs);
+    ParallelFor(0, static_cast<int>(nPairs), [&](int iPair) {
+        size_t spline_u_idx = static_cast<size_t>(iPair / nGuides);
+        size_t spline_v_idx = static_cast<size_t>(iPair % nGuides);
+        if (profileBoxes[spline_u_idx].IsOut(guideBoxes[spline_v_idx])) {
+            return;
+        }
+        try {
+            pairIntersections[static_cast<size_t>(iPair)] = CTiglBSplineAlgorithms::intersections(profiles[spline_u_idx],
+                                                                                                  guides[spline_v_idx],
+                                                                                                  m_spatialTol);
+        }
+        catch (...) {
+            pairErrors[static_cast<size_t>(iPair)] = std::current_exception();
+        }
+    }, m_parallel);
+
+    for (const auto& error : pairErrors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
     bool fail = false;
     DEBUG_SCOPE(debug);
 
-    for (int spline_u_idx = 0; spline_u_idx < static_cast<int>(profiles.size()); ++spline_u_idx) {
-        for (int spline_v_idx = 0; spline_v_idx < static_cast<int>(guides.size()); ++spline_v_idx) {
-            std::vector<std::pair<double, double> > currentIntersections = CTiglBSplineAlgorithms::intersections(profiles[static_cast<size_t>(spline_u_idx)],
-                                                                                                                 guides[static_cast<size_t>(spline_v_idx)],
-                                                                                                                 m_spatialTol);
+    for (int spline_u_idx = 0; spline_u_idx < nProfiles; ++spline_u_idx) {
+        for (int spline_v_idx = 0; spline_v_idx < nGuides; ++spline_v_idx) {
+            const std::vector<std::pair<double, double> >& currentIntersections = pairIntersections[static_cast<size_t>(spline_u_idx * nGuides + spline_v_idx)];
 
             if (currentIntersections.size() < 1) {
                 fail = true;
@@ -357,6 +416,11 @@ CTiglInterpolateCurveNetwork::operator Handle(Geom_BSplineSurface) ()
     return Surface();
 }
 
+void CTiglInterpolateCurveNetwork::SetParallel(bool parallel)
+{
+    m_parallel = parallel;
+}
+
 Handle(Geom_BSplineSurface) CTiglInterpolateCurveNetwork::SurfaceProfiles()
 {
     Perform();
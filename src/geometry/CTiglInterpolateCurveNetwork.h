@@ -74,6 +74,13 @@ public:
     /// Returns the u parameters of the final surface, that correspond to the guide curve locations
     TIGL_EXPORT std::vector<double> ParametersGuides();
 
+    /**
+     * @brief Enables the concurrent computation of the profile-guide intersections (default: true)
+     *
+     * The result does not depend on this setting. It must be set before the surface is computed.
+     */
+    TIGL_EXPORT void SetParallel(bool parallel);
+
 private:
     void Perform();
 
@@ -92,6 +99,7 @@ private:
                                                    math_Matrix & intersection_params_v) const;
 
     bool m_hasPerformed;
+    bool m_parallel;
     double m_spatialTol;
     
     typedef std::vector<Handle(Geom_BSplineCurve)> CurveArray;
@@ -209,8 +209,9 @@ CTiglIntersectionCalculation::CTiglIntersectionCalculation(CTiglShapeCache* cach
     bool inCache = false;
     if (cache) {
         // check, if result is already in cache
-        if (cache->HasShape(id)) {
-            intersectionResult = TopoDS::Compound(cache->GetShape(id));
+        const TopoDS_Shape* cachedResult = cache->Find(id);
+        if (cachedResult) {
+            intersectionResult = TopoDS::Compound(*cachedResult);
             inCache = true;
         }
     }
@@ -258,8 +259,9 @@ CTiglIntersectionCalculation::CTiglIntersectionCalculation(CTiglShapeCache* cach
     bool inCache = false;
     if (cache) {
         // check, if result is already in cache
-        if (cache->HasShape(id)) {
-            intersectionResult = TopoDS::Compound(cache->GetShape(id));
+        const TopoDS_Shape* cachedResult = cache->Find(id);
+        if (cachedResult) {
+            intersectionResult = TopoDS::Compound(*cachedResult);
             inCache = true;
         }
     }
@@ -302,7 +304,8 @@ CTiglIntersectionCalculation::CTiglIntersectionCalculation(CTiglShapeCache& cach
 {
     // check that intersectionID is in cache
     if (!cache.HasShape(intersectionID)) {
-        throw CTiglError("The given intersectionID can not be found.", TIGL_NOT_FOUND);
+        throw CTiglError("The given intersectionID can not be found. "
+                         "It might have been evicted from the intersection cache.", TIGL_NOT_FOUND);
     }
     
     try {
@@ -339,8 +342,9 @@ void CTiglIntersectionCalculation::computeIntersection(CTiglShapeCache * cache,
     bool inCache = false;
     if (cache) {
         // check, if result is already in cache
-        if (cache->HasShape(id)) {
-            intersectionResult = TopoDS::Compound(cache->GetShape(id));
+        const TopoDS_Shape* cachedResult = cache->Find(id);
+        if (cachedResult) {
+            intersectionResult = TopoDS::Compound(*cachedResult);
             inCache = true;
         }
     }
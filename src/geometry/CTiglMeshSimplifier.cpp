@@ -0,0 +1,565 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "CTiglMeshSimplifier.h"
+
+#include "CTiglError.h"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <queue>
+#include <utility>
+
+namespace
+{
+    // collapses must not tilt a triangle by more than 60 degrees
+    const double kMinNormalCosine = 0.5;
+
+    struct Vec
+    {
+        Vec(double xval, double yval, double zval) : x(xval), y(yval), z(zval) {}
+        explicit Vec(const double* p) : x(p[0]), y(p[1]), z(p[2]) {}
+
+        Vec operator-(const Vec& o) const
+        {
+            return Vec(x - o.x, y - o.y, z - o.z);
+        }
+
+        double dot(const Vec& o) const
+        {
+            return x*o.x + y*o.y + z*o.z;
+        }
+
+        Vec cross(const Vec& o) const
+        {
+            return Vec(y*o.z - z*o.y, z*o.x - x*o.z, x*o.y - y*o.x);
+        }
+
+        double norm() const
+        {
+            return std::sqrt(dot(*this));
+        }
+
+        double x, y, z;
+    };
+
+    // adds the squared distance to the plane n*p + d = 0 (|n| = 1) to the quadric
+    void addPlane(double* q, const Vec& n, double d)
+    {
+        q[0] += n.x*n.x; q[1] += n.x*n.y; q[2] += n.x*n.z; q[3] += n.x*d;
+        q[4] += n.y*n.y; q[5] += n.y*n.z; q[6] += n.y*d;
+        q[7] += n.z*n.z; q[8] += n.z*d;
+        q[9] += d*d;
+    }
+
+    double evaluate(const double* q, const Vec& p)
+    {
+        return q[0]*p.x*p.x + 2.*q[1]*p.x*p.y + 2.*q[2]*p.x*p.z + 2.*q[3]*p.x
+             + q[4]*p.y*p.y + 2.*q[5]*p.y*p.z + 2.*q[6]*p.y
+             + q[7]*p.z*p.z + 2.*q[8]*p.z
+             + q[9];
+    }
+
+    Vec combine(const Vec& a, const Vec& ab, double s, const Vec& ac, double t)
+    {
+        return Vec(a.x + s*ab.x + t*ac.x, a.y + s*ab.y + t*ac.y, a.z + s*ab.z + t*ac.z);
+    }
+
+    // squared distance of p to the triangle abc, see Ericson, Real-Time Collision Detection, 5.1.5
+    double squaredDistanceToTriangle(const Vec& p, const Vec& a, const Vec& b, const Vec& c)
+    {
+        const Vec ab = b - a, ac = c - a, ap = p - a;
+        const double d1 = ab.dot(ap), d2 = ac.dot(ap);
+        if (d1 <= 0. && d2 <= 0.) {
+            return ap.dot(ap);
+        }
+
+        const Vec bp = p - b;
+        const double d3 = ab.dot(bp), d4 = ac.dot(bp);
+        if (d3 >= 0. && d4 <= d3) {
+            return bp.dot(bp);
+        }
+
+        const double vc = d1*d4 - d3*d2;
+        if (vc <= 0. && d1 >= 0. && d3 <= 0.) {
+            const Vec d = p - combine(a, ab, d1 / (d1 - d3), ac, 0.);
+            return d.dot(d);
+        }
+
+        const Vec cp = p - c;
+        const double d5 = ab.dot(cp), d6 = ac.dot(cp);
+        if (d6 >= 0. && d5 <= d6) {
+            return cp.dot(cp);
+        }
+
+        const double vb = d5*d2 - d1*d6;
+        if (vb <= 0. && d2 >= 0. && d6 <= 0.) {
+            const Vec d = p - combine(a, ab, 0., ac, d2 / (d2 - d6));
+            return d.dot(d);
+        }
+
+        const double va = d3*d6 - d5*d4;
+        if (va <= 0. && (d4 - d3) >= 0. && (d5 - d6) >= 0.) {
+            const double w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+            const Vec d = p - combine(b, c - b, w, c - b, 0.);
+            return d.dot(d);
+        }
+
+        const double denom = 1. / (va + vb + vc);
+        const Vec d = p - combine(a, ab, vb * denom, ac, vc * denom);
+        return d.dot(d);
+    }
+
+} // namespace
+
+namespace tigl
+{
+
+struct CTiglMeshSimplifier::Candidate
+{
+    double cost;
+    unsigned int from;
+    unsigned int to;
+    unsigned int stampFrom;
+    unsigned int stampTo;
+
+    // the cheapest collapse has the highest priority
+    bool operator<(const Candidate& other) const
+    {
+        return cost > other.cost;
+    }
+};
+
+CTiglMeshSimplifier::CTiglMeshSimplifier(const CTiglPolyObject& mesh, const std::vector<unsigned int>& groups)
+    : m_mesh(mesh)
+    , m_points(mesh.getPointData().data())
+    , m_nAliveTriangles(0)
+{
+    const unsigned long nPolygons = mesh.getNPolygons();
+    if (!groups.empty() && groups.size() != nPolygons) {
+        throw CTiglError("The number of groups does not match the number of polygons in CTiglMeshSimplifier", TIGL_ERROR);
+    }
+
+    const unsigned long nVertices = mesh.getNVertices();
+    m_vertexTriangles.resize(nVertices);
+    m_vertexLocked.resize(nVertices, 0);
+    m_vertexStamp.resize(nVertices, 0);
+
+    const CTiglConstSpan<unsigned int> connectivity = mesh.getConnectivity();
+    const CTiglConstSpan<unsigned int> offsets = mesh.getPolygonOffsets();
+    for (unsigned long iPoly = 0; iPoly < nPolygons; ++iPoly) {
+        const unsigned int* v = &connectivity[offsets[iPoly]];
+        const unsigned int nPoints = offsets[iPoly + 1] - offsets[iPoly];
+        if (nPoints != 3 || v[0] == v[1] || v[1] == v[2] || v[0] == v[2]) {
+            // other polygons stay attached to their vertices
+            m_otherPolygons.push_back(iPoly);
+            for (unsigned int k = 0; k < nPoints; ++k) {
+                m_vertexLocked[v[k]] = 1;
+            }
+            continue;
+        }
+
+        const unsigned int iTriangle = static_cast<unsigned int>(m_trianglePolygon.size());
+        m_triangles.insert(m_triangles.end(), v, v + 3);
+        m_trianglePolygon.push_back(static_cast<unsigned int>(iPoly));
+        m_triangleGroup.push_back(groups.empty() ? 0 : groups[iPoly]);
+        m_triangleAlive.push_back(1);
+        for (int k = 0; k < 3; ++k) {
+            m_vertexTriangles[v[k]].push_back(iTriangle);
+        }
+    }
+    m_nAliveTriangles = m_trianglePolygon.size();
+    m_triangleRemovedVertices.resize(m_trianglePolygon.size());
+
+    m_quadrics.resize(10 * nVertices, 0.);
+    AddFaceQuadrics();
+}
+
+void CTiglMeshSimplifier::AddFaceQuadrics()
+{
+    for (size_t t = 0; t < m_trianglePolygon.size(); ++t) {
+        const unsigned int* v = &m_triangles[3*t];
+        const Vec p0(m_points + 3*v[0]), p1(m_points + 3*v[1]), p2(m_points + 3*v[2]);
+        Vec n = (p1 - p0).cross(p2 - p0);
+        const double length = n.norm();
+        if (length <= 0.) {
+            continue;
+        }
+        n = Vec(n.x/length, n.y/length, n.z/length);
+
+        for (int k = 0; k < 3; ++k) {
+            addPlane(&m_quadrics[10*v[k]], n, -n.dot(p0));
+        }
+
+        // A feature edge may only move within the plane perpendicular to the triangle.
+        // This keeps the group boundaries in place.
+        for (int k = 0; k < 3; ++k) {
+            const unsigned int a = v[k], b = v[(k+1) % 3];
+            if (!IsFeatureEdge(a, b)) {
+                continue;
+            }
+            const Vec pa(m_points + 3*a), pb(m_points + 3*b);
+            Vec m = (pb - pa).cross(n);
+            const double mLength = m.norm();
+            if (mLength <= 0.) {
+                continue;
+            }
+            m = Vec(m.x/mLength, m.y/mLength, m.z/mLength);
+            addPlane(&m_quadrics[10*a], m, -m.dot(pa));
+            addPlane(&m_quadrics[10*b], m, -m.dot(pa));
+        }
+    }
+}
+
+bool CTiglMeshSimplifier::IsFeatureEdge(unsigned int v1, unsigned int v2) const
+{
+    int count = 0;
+    unsigned int group = 0;
+    for (unsigned int t : m_vertexTriangles[v1]) {
+        if (!m_triangleAlive[t]) {
+            continue;
+        }
+        const unsigned int* v = &m_triangles[3*t];
+        if (v[0] != v2 && v[1] != v2 && v[2] != v2) {
+            continue;
+        }
+        if (count > 0 && m_triangleGroup[t] != group) {
+            return true;
+        }
+        group = m_triangleGroup[t];
+        count++;
+    }
+    // border and non-manifold edges
+    return count != 2;
+}
+
+void CTiglMeshSimplifier::Neighbors(unsigned int vertex, std::vector<unsigned int>& neighbors) const
+{
+    neighbors.clear();
+    for (unsigned int t : m_vertexTriangles[vertex]) {
+        if (!m_triangleAlive[t]) {
+            continue;
+        }
+        for (int k = 0; k < 3; ++k) {
+            const unsigned int v = m_triangles[3*t + k];
+            if (v != vertex && std::find(neighbors.begin(), neighbors.end(), v) == neighbors.end()) {
+                neighbors.push_back(v);
+            }
+        }
+    }
+}
+
+int CTiglMeshSimplifier::CountFeatureEdges(unsigned int vertex) const
+{
+    std::vector<unsigned int> neighbors;
+    Neighbors(vertex, neighbors);
+
+    int count = 0;
+    for (unsigned int v : neighbors) {
+        if (IsFeatureEdge(vertex, v)) {
+            count++;
+        }
+    }
+    return count;
+}
+
+bool CTiglMeshSimplifier::IsCollapseValid(unsigned int from, unsigned int to) const
+{
+    if (m_vertexLocked[from]) {
+        return false;
+    }
+
+    // Vertices on a feature line can only move along this line. Corners of the
+    // feature lines are kept.
+    const int nFeatureEdges = CountFeatureEdges(from);
+    if (nFeatureEdges == 2) {
+        if (!IsFeatureEdge(from, to)) {
+            return false;
+        }
+    }
+    else if (nFeatureEdges != 0) {
+        return false;
+    }
+
+    // The common neighbors of both vertices must be the opposite vertices
+    // of the removed triangles. Otherwise, the collapse changes the topology.
+    std::vector<unsigned int> opposite;
+    for (unsigned int t : m_vertexTriangles[from]) {
+        if (!m_triangleAlive[t]) {
+            continue;
+        }
+        const unsigned int* v = &m_triangles[3*t];
+        if (v[0] == to || v[1] == to || v[2] == to) {
+            for (int k = 0; k < 3; ++k) {
+                if (v[k] != from && v[k] != to) {
+                    opposite.push_back(v[k]);
+                }
+            }
+        }
+    }
+    if (opposite.empty()) {
+        return false;
+    }
+
+    std::vector<unsigned int> neighborsFrom, neighborsTo;
+    Neighbors(from, neighborsFrom);
+    Neighbors(to, neighborsTo);
+    for (unsigned int v : neighborsFrom) {
+        if (v != to && std::find(neighborsTo.begin(), neighborsTo.end(), v) != neighborsTo.end()
+            && std::find(opposite.begin(), opposite.end(), v) == opposite.end()) {
+            return false;
+        }
+    }
+
+    // the remaining triangles must neither flip nor degenerate
+    const Vec pTo(m_points + 3*to);
+    for (unsigned int t : m_vertexTriangles[from]) {
+        if (!m_triangleAlive[t]) {
+            continue;
+        }
+        const unsigned int* v = &m_triangles[3*t];
+        if (v[0] == to || v[1] == to || v[2] == to) {
+            continue;
+        }
+
+        const Vec p0(m_points + 3*v[0]), p1(m_points + 3*v[1]), p2(m_points + 3*v[2]);
+        const Vec oldNormal = (p1 - p0).cross(p2 - p0);
+        const Vec q0 = v[0] == from ? pTo : p0;
+        const Vec q1 = v[1] == from ? pTo : p1;
+        const Vec q2 = v[2] == from ? pTo : p2;
+        const Vec newNormal = (q1 - q0).cross(q2 - q0);
+
+        const double oldLength = oldNormal.norm();
+        const double newLength = newNormal.norm();
+        if (newLength <= 1e-10 * oldLength || oldNormal.dot(newNormal) < kMinNormalCosine * oldLength * newLength) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool CTiglMeshSimplifier::AssignRemovedVertices(unsigned int from, unsigned int to, double maxDeviation,
+                                                std::vector<std::pair<unsigned int, unsigned int> >& assignment) const
+{
+    // the triangles around 'to' after the collapse
+    std::vector<unsigned int> fan;
+    for (unsigned int t : m_vertexTriangles[from]) {
+        const unsigned int* v = &m_triangles[3*t];
+        if (m_triangleAlive[t] && v[0] != to && v[1] != to && v[2] != to) {
+            fan.push_back(t);
+        }
+    }
+    for (unsigned int t : m_vertexTriangles[to]) {
+        const unsigned int* v = &m_triangles[3*t];
+        if (m_triangleAlive[t] && v[0] != from && v[1] != from && v[2] != from) {
+            fan.push_back(t);
+        }
+    }
+
+    // 'from' and the vertices removed before from its triangles need a new triangle
+    std::vector<unsigned int> removed(1, from);
+    for (unsigned int t : m_vertexTriangles[from]) {
+        if (m_triangleAlive[t]) {
+            removed.insert(removed.end(), m_triangleRemovedVertices[t].begin(), m_triangleRemovedVertices[t].end());
+        }
+    }
+
+    const double maxDistance2 = maxDeviation * maxDeviation;
+    assignment.clear();
+    for (unsigned int r : removed) {
+        const Vec p(m_points + 3*r);
+        double minDistance2 = maxDistance2;
+        unsigned int nearest = UINT_MAX;
+        for (unsigned int t : fan) {
+            const unsigned int* v = &m_triangles[3*t];
+            const Vec p0(m_points + 3*(v[0] == from ? to : v[0]));
+            const Vec p1(m_points + 3*(v[1] == from ? to : v[1]));
+            const Vec p2(m_points + 3*(v[2] == from ? to : v[2]));
+            const double distance2 = squaredDistanceToTriangle(p, p0, p1, p2);
+            if (distance2 <= minDistance2) {
+                minDistance2 = distance2;
+                nearest = t;
+            }
+        }
+        if (nearest == UINT_MAX) {
+            return false;
+        }
+        assignment.push_back(std::make_pair(r, nearest));
+    }
+    return true;
+}
+
+double CTiglMeshSimplifier::CollapseCost(unsigned int from, unsigned int to) const
+{
+    double q[10];
+    for (int i = 0; i < 10; ++i) {
+        q[i] = m_quadrics[10*from + i] + m_quadrics[10*to + i];
+    }
+    return std::max(0., evaluate(q, Vec(m_points + 3*to)));
+}
+
+void CTiglMeshSimplifier::Collapse(unsigned int from, unsigned int to, const std::vector<std::pair<unsigned int, unsigned int> >& assignment)
+{
+    for (unsigned int t : m_vertexTriangles[from]) {
+        if (!m_triangleAlive[t]) {
+            continue;
+        }
+        m_triangleRemovedVertices[t].clear();
+        unsigned int* v = &m_triangles[3*t];
+        if (v[0] == to || v[1] == to || v[2] == to) {
+            m_triangleAlive[t] = 0;
+            m_nAliveTriangles--;
+        }
+        else {
+            std::replace(v, v + 3, from, to);
+            m_vertexTriangles[to].push_back(t);
+        }
+    }
+    m_vertexTriangles[from].clear();
+
+    std::vector<unsigned int>& trianglesTo = m_vertexTriangles[to];
+    trianglesTo.erase(std::remove_if(trianglesTo.begin(), trianglesTo.end(), [this](unsigned int t) {
+        return !m_triangleAlive[t];
+    }), trianglesTo.end());
+
+    for (const std::pair<unsigned int, unsigned int>& removed : assignment) {
+        m_triangleRemovedVertices[removed.second].push_back(removed.first);
+    }
+
+    for (int i = 0; i < 10; ++i) {
+        m_quadrics[10*to + i] += m_quadrics[10*from + i];
+    }
+    m_vertexStamp[from]++;
+    m_vertexStamp[to]++;
+}
+
+void CTiglMeshSimplifier::Simplify(double maxDeviation)
+{
+    maxDeviation = std::max(0., maxDeviation);
+
+    // The quadric error sums up the squared distances to several planes. It is
+    // at least the squared distance to each plane, hence it is used as a cheap
+    // precheck and to order the collapses.
+    const double maxCost = maxDeviation * maxDeviation;
+
+    std::priority_queue<Candidate> queue;
+    auto addCandidate = [&](unsigned int from, unsigned int to) {
+        if (m_vertexLocked[from]) {
+            return;
+        }
+        const double cost = CollapseCost(from, to);
+        if (cost <= maxCost) {
+            Candidate candidate = {cost, from, to, m_vertexStamp[from], m_vertexStamp[to]};
+            queue.push(candidate);
+        }
+    };
+
+    for (size_t t = 0; t < m_trianglePolygon.size(); ++t) {
+        if (!m_triangleAlive[t]) {
+            continue;
+        }
+        for (int k = 0; k < 3; ++k) {
+            const unsigned int a = m_triangles[3*t + k], b = m_triangles[3*t + (k+1) % 3];
+            addCandidate(a, b);
+            addCandidate(b, a);
+        }
+    }
+
+    std::vector<unsigned int> neighbors;
+    std::vector<std::pair<unsigned int, unsigned int> > assignment;
+    while (!queue.empty()) {
+        const Candidate candidate = queue.top();
+        queue.pop();
+
+        // the costs of collapses at modified vertices are outdated
+        if (candidate.stampFrom != m_vertexStamp[candidate.from] || candidate.stampTo != m_vertexStamp[candidate.to]) {
+            continue;
+        }
+        if (!IsCollapseValid(candidate.from, candidate.to) ||
+            !AssignRemovedVertices(candidate.from, candidate.to, maxDeviation, assignment)) {
+            continue;
+        }
+
+        Collapse(candidate.from, candidate.to, assignment);
+
+        Neighbors(candidate.to, neighbors);
+        for (unsigned int v : neighbors) {
+            addCandidate(v, candidate.to);
+            addCandidate(candidate.to, v);
+        }
+    }
+}
+
+unsigned long CTiglMeshSimplifier::GetNTriangles() const
+{
+    return m_nAliveTriangles;
+}
+
+void CTiglMeshSimplifier::GetMesh(CTiglPolyObject& result) const
+{
+    result.enableNormals(m_mesh.hasNormals());
+
+    std::vector<unsigned long> newIndex(m_vertexTriangles.size(), ULONG_MAX);
+    auto vertexIndex = [&](unsigned int v) {
+        if (newIndex[v] == ULONG_MAX) {
+            newIndex[v] = result.addPointNormal(m_mesh.getVertexPoint(v), m_mesh.getVertexNormal(v));
+        }
+        return newIndex[v];
+    };
+
+    // pairs of new and original polygon index
+    std::vector<std::pair<unsigned long, unsigned long> > polygons;
+    polygons.reserve(m_nAliveTriangles + m_otherPolygons.size());
+    for (size_t t = 0; t < m_trianglePolygon.size(); ++t) {
+        if (!m_triangleAlive[t]) {
+            continue;
+        }
+        const unsigned long i1 = vertexIndex(m_triangles[3*t]);
+        const unsigned long i2 = vertexIndex(m_triangles[3*t + 1]);
+        const unsigned long i3 = vertexIndex(m_triangles[3*t + 2]);
+        polygons.push_back(std::make_pair(result.addTriangleByVertexIndex(i1, i2, i3), m_trianglePolygon[t]));
+    }
+
+    for (unsigned long iPoly : m_otherPolygons) {
+        CTiglPolygon polygon;
+        for (unsigned long k = 0; k < m_mesh.getNPointsOfPolygon(iPoly); ++k) {
+            const unsigned long v = m_mesh.getVertexIndexOfPolygon(k, iPoly);
+            polygon.addPoint(m_mesh.getVertexPoint(v));
+            polygon.addNormal(m_mesh.getVertexNormal(v));
+        }
+        result.addPolygon(polygon);
+        polygons.push_back(std::make_pair(result.getNPolygons() - 1, iPoly));
+    }
+
+    for (unsigned int iField = 0; iField < m_mesh.getNumberOfPolyRealData(); ++iField) {
+        const char* name = m_mesh.getPolyDataFieldName(iField);
+        const CTiglConstSpan<double> values = m_mesh.getPolyDataColumn(name);
+        for (const std::pair<unsigned long, unsigned long>& polygon : polygons) {
+            result.setPolyDataReal(polygon.first, name, values[polygon.second]);
+        }
+    }
+
+    if (m_mesh.hasMetadata()) {
+        result.setMetadataElements(m_mesh.getMetadataElements());
+        for (const std::pair<unsigned long, unsigned long>& polygon : polygons) {
+            result.setPolyMetadata(polygon.first, m_mesh.getPolyMetadata(polygon.second));
+        }
+    }
+}
+
+} // namespace tigl
@@ -0,0 +1,109 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @brief Simplifies a triangulation by edge collapses, e.g. to derive coarser
+ * levels of detail from a fine triangulation.
+ *
+ * An edge collapse moves one vertex onto a neighboring vertex. Hence, all remaining
+ * vertices, normals and polygon data are taken from the input mesh. The collapses are
+ * ordered by quadrics of the original triangle planes. Each removed vertex is assigned
+ * to its nearest triangle of the simplified mesh, which bounds the deviation.
+ *
+ * Each triangle belongs to a group, e.g. the face it was meshed from. Edges between
+ * different groups and edges at the mesh border are feature edges. Feature edges are
+ * only shortened along the feature line, such that the group boundaries are preserved.
+ */
+
+#ifndef CTIGLMESHSIMPLIFIER_H
+#define CTIGLMESHSIMPLIFIER_H
+
+#include "tigl_internal.h"
+#include "CTiglPolyData.h"
+
+#include <utility>
+#include <vector>
+
+namespace tigl
+{
+
+class CTiglMeshSimplifier
+{
+public:
+    /**
+     * @brief Prepares the simplification of the mesh. The mesh must outlive the simplifier.
+     *
+     * @param mesh The triangulation to simplify. Polygons that are not triangles are kept as they are.
+     * @param groups One group id per polygon of the mesh. If empty, all triangles belong to the same group.
+     */
+    TIGL_EXPORT CTiglMeshSimplifier(const CTiglPolyObject& mesh, const std::vector<unsigned int>& groups = std::vector<unsigned int>());
+
+    /**
+     * @brief Collapses edges, until each further collapse would move the simplified
+     * mesh farther than maxDeviation away from a vertex of the original mesh.
+     *
+     * The deviation is measured at the original vertices. The original triangles
+     * in between are not checked, i.e. they are assumed to be small.
+     *
+     * The simplification continues from the current state, so coarser levels
+     * can be computed by calling Simplify with increasing deviations.
+     */
+    TIGL_EXPORT void Simplify(double maxDeviation);
+
+    /// Returns the number of triangles of the current mesh
+    TIGL_EXPORT unsigned long GetNTriangles() const;
+
+    /// Adds the current mesh to the object, including normals, polygon data and metadata
+    TIGL_EXPORT void GetMesh(CTiglPolyObject& result) const;
+
+private:
+    struct Candidate;
+
+    bool IsFeatureEdge(unsigned int v1, unsigned int v2) const;
+    int CountFeatureEdges(unsigned int v) const;
+    void Neighbors(unsigned int v, std::vector<unsigned int>& neighbors) const;
+    bool IsCollapseValid(unsigned int from, unsigned int to) const;
+    double CollapseCost(unsigned int from, unsigned int to) const;
+    bool AssignRemovedVertices(unsigned int from, unsigned int to, double maxDeviation,
+                               std::vector<std::pair<unsigned int, unsigned int> >& assignment) const;
+    void Collapse(unsigned int from, unsigned int to, const std::vector<std::pair<unsigned int, unsigned int> >& assignment);
+    void AddFaceQuadrics();
+
+    const CTiglPolyObject& m_mesh;
+    const double* m_points;
+
+    // three vertex indices per triangle
+    std::vector<unsigned int> m_triangles;
+    std::vector<unsigned int> m_trianglePolygon;
+    std::vector<unsigned int> m_triangleGroup;
+    std::vector<char> m_triangleAlive;
+    unsigned long m_nAliveTriangles;
+    // removed original vertices, assigned to their nearest triangle
+    std::vector<std::vector<unsigned int> > m_triangleRemovedVertices;
+
+    std::vector<std::vector<unsigned int> > m_vertexTriangles;
+    std::vector<char> m_vertexLocked;
+    std::vector<unsigned int> m_vertexStamp;
+    // symmetric 4x4 error quadric per vertex, 10 entries each
+    std::vector<double> m_quadrics;
+
+    // polygons that are not triangles
+    std::vector<unsigned long> m_otherPolygons;
+};
+
+} // namespace tigl
+
+#endif // CTIGLMESHSIMPLIFIER_H
@@ -0,0 +1,425 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "CTiglPersistentShapeCache.h"
+
+#include "CNamedShape.h"
+#include "CTiglError.h"
+#include "CTiglLogging.h"
+#include "tigl_version.h"
+
+#include <BinTools.hxx>
+#include <Standard_Failure.hxx>
+
+#include <boost/filesystem.hpp>
+#include <boost/thread/lock_guard.hpp>
+
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <set>
+#include <sstream>
+
+namespace
+{
+
+const std::string cacheFileMagic = "TIGLSHAPECACHE1";
+
+enum OriginType
+{
+    NoOrigin = 0,
+    SelfOrigin = 1,
+    OtherOrigin = 2
+};
+
+// 128 bit FNV-1a hash. In contrast to std::hash, the result is the same
+// in each process and on each platform.
+class ContentHash
+{
+public:
+    void Add(const std::string& data)
+    {
+        // prefix the length to avoid ambiguities when concatenating strings
+        const uint64_t length = data.size();
+        AddBytes(reinterpret_cast<const unsigned char*>(&length), sizeof(length));
+        AddBytes(reinterpret_cast<const unsigned char*>(data.data()), data.size());
+    }
+
+    std::string HexDigest() const
+    {
+        std::stringstream stream;
+        stream << std::hex << std::setfill('0') << std::setw(16) << m_high << std::setw(16) << m_low;
+        return stream.str();
+    }
+
+private:
+    void AddBytes(const unsigned char* data, size_t size)
+    {
+        for (size_t i = 0; i < size; ++i) {
+            m_low ^= data[i];
+            MultiplyByPrime();
+        }
+    }
+
+    // multiplies the hash by the 128 bit FNV prime 2^88 + 0x13B (modulo 2^128)
+    void MultiplyByPrime()
+    {
+        const uint64_t factor = 0x13B;
+
+        // carry of the 64 x 64 bit product m_low * factor
+        const uint64_t lowProduct  = (m_low & 0xFFFFFFFFULL) * factor;
+        const uint64_t highProduct = (m_low >> 32) * factor;
+        const uint64_t carry = (highProduct + (lowProduct >> 32)) >> 32;
+
+        m_high = m_high * factor + carry + (m_low << 24);
+        m_low  = m_low * factor;
+    }
+
+    // 128 bit FNV offset basis
+    uint64_t m_high = 0x6C62272E07BB0142ULL;
+    uint64_t m_low  = 0x62B821756295C58DULL;
+};
+
+// returns the trimmed text contents of all xml elements of the given xml string
+std::vector<std::string> elementTexts(const std::string& xml)
+{
+    std::vector<std::string> texts;
+    size_t pos = xml.find('>');
+    while (pos != std::string::npos) {
+        size_t end = xml.find('<', pos);
+        if (end == std::string::npos) {
+            break;
+        }
+        size_t first = xml.find_first_not_of(" \t\r\n", pos + 1);
+        if (first < end) {
+            size_t last = xml.find_last_not_of(" \t\r\n", end - 1);
+            texts.push_back(xml.substr(first, last - first + 1));
+        }
+        pos = xml.find('>', end);
+    }
+    return texts;
+}
+
+void writeUInt(std::ostream& stream, unsigned int value)
+{
+    const uint32_t v = value;
+    stream.write(reinterpret_cast<const char*>(&v), sizeof(v));
+}
+
+unsigned int readUInt(std::istream& stream)
+{
+    uint32_t v = 0;
+    stream.read(reinterpret_cast<char*>(&v), sizeof(v));
+    if (!stream) {
+        throw tigl::CTiglError("Unexpected end of file");
+    }
+    return v;
+}
+
+void writeString(std::ostream& stream, const std::string& str)
+{
+    writeUInt(stream, static_cast<unsigned int>(str.size()));
+    stream.write(str.data(), str.size());
+}
+
+std::string readString(std::istream& stream)
+{
+    const unsigned int size = readUInt(stream);
+    std::string str(size, '\0');
+    stream.read(&str[0], size);
+    if (!stream) {
+        throw tigl::CTiglError("Unexpected end of file");
+    }
+    return str;
+}
+
+void writeDouble(std::ostream& stream, double value)
+{
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+double readDouble(std::istream& stream)
+{
+    double value = 0.;
+    stream.read(reinterpret_cast<char*>(&value), sizeof(value));
+    if (!stream) {
+        throw tigl::CTiglError("Unexpected end of file");
+    }
+    return value;
+}
+
+} // namespace
+
+namespace tigl
+{
+
+CTiglPersistentShapeCache& CTiglPersistentShapeCache::GetInstance()
+{
+    static CTiglPersistentShapeCache instance;
+    return instance;
+}
+
+void CTiglPersistentShapeCache::SetDirectory(const std::string& directory)
+{
+    if (!directory.empty()) {
+        try {
+            boost::filesystem::create_directories(directory);
+        }
+        catch (const boost::filesystem::filesystem_error& err) {
+            throw CTiglError("Cannot create geometry cache directory " + directory + ": " + err.what(), TIGL_OPEN_FAILED);
+        }
+    }
+
+    boost::lock_guard<boost::mutex> guard(m_mutex);
+    m_directory = directory;
+}
+
+std::string CTiglPersistentShapeCache::GetDirectory() const
+{
+    boost::lock_guard<boost::mutex> guard(m_mutex);
+    return m_directory;
+}
+
+bool CTiglPersistentShapeCache::IsEnabled() const
+{
+    return !GetDirectory().empty();
+}
+
+std::string CTiglPersistentShapeCache::FileName(const std::string& key) const
+{
+    return (boost::filesystem::path(GetDirectory()) / (key + ".tiglshape")).string();
+}
+
+PNamedShape CTiglPersistentShapeCache::Load(const std::string& key) const
+{
+    if (!IsEnabled() || key.empty()) {
+        return PNamedShape();
+    }
+
+    const std::string filename = FileName(key);
+    std::ifstream file(filename.c_str(), std::ios::binary);
+    if (!file) {
+        return PNamedShape();
+    }
+
+    try {
+        if (readString(file) != cacheFileMagic) {
+            LOG(WARNING) << "Ignoring invalid geometry cache file " << filename;
+            return PNamedShape();
+        }
+
+        const std::string name = readString(file);
+        const std::string shortName = readString(file);
+
+        struct StoredTraits
+        {
+            std::string name;
+            std::string componentUID;
+            unsigned int index;
+            unsigned int originType;
+            std::string originName;
+            std::string originShortName;
+            CTiglTransformation transformation;
+        };
+
+        std::vector<StoredTraits> storedTraits(readUInt(file));
+        for (auto& traits : storedTraits) {
+            traits.name = readString(file);
+            traits.componentUID = readString(file);
+            traits.index = readUInt(file);
+            traits.originType = readUInt(file);
+            traits.originName = readString(file);
+            traits.originShortName = readString(file);
+            for (int row = 0; row < 4; ++row) {
+                for (int col = 0; col < 4; ++col) {
+                    traits.transformation.SetValue(row, col, readDouble(file));
+                }
+            }
+        }
+
+        TopoDS_Shape shape;
+        BinTools::Read(shape, file);
+        if (shape.IsNull()) {
+            LOG(WARNING) << "Ignoring invalid geometry cache file " << filename;
+            return PNamedShape();
+        }
+
+        PNamedShape result(new CNamedShape(shape, name, shortName));
+        if (result->GetFaceCount() != storedTraits.size()) {
+            LOG(WARNING) << "Ignoring invalid geometry cache file " << filename;
+            return PNamedShape();
+        }
+
+        // The original shapes of the faces are not stored in the cache.
+        // We create proxies of them, that carry at least their names.
+        std::map<std::pair<std::string, std::string>, PNamedShape> origins;
+        for (unsigned int iFace = 0; iFace < storedTraits.size(); ++iFace) {
+            const StoredTraits& stored = storedTraits[iFace];
+
+            CFaceTraits traits;
+            traits.SetName(stored.name);
+            traits.SetComponentUID(stored.componentUID);
+            traits.SetIndex(stored.index);
+            traits.SetTransformation(stored.transformation);
+            if (stored.originType == SelfOrigin) {
+                traits.SetOrigin(result);
+            }
+            else if (stored.originType == OtherOrigin) {
+                PNamedShape& origin = origins[std::make_pair(stored.originName, stored.originShortName)];
+                if (!origin) {
+                    origin = PNamedShape(new CNamedShape(TopoDS_Shape(), stored.originName, stored.originShortName));
+                }
+                traits.SetOrigin(origin);
+            }
+            result->SetFaceTraits(static_cast<int>(iFace), traits);
+        }
+
+        LOG(INFO) << "Loaded shape " << name << " from geometry cache file " << filename;
+        return result;
+    }
+    catch (const Standard_Failure& err) {
+        LOG(WARNING) << "Cannot read geometry cache file " << filename << ": " << err.GetMessageString();
+    }
+    catch (const std::exception& err) {
+        LOG(WARNING) << "Cannot read geometry cache file " << filename << ": " << err.what();
+    }
+    return PNamedShape();
+}
+
+void CTiglPersistentShapeCache::Store(const std::string& key, const PNamedShape& shape) const
+{
+    if (!IsEnabled() || key.empty() || !shape) {
+        return;
+    }
+
+    const std::string filename = FileName(key);
+
+    // Other processes might read the cache at the same time. Hence, we write
+    // into a temporary file first and move it to its final location afterwards.
+    boost::filesystem::path tmpFile = boost::filesystem::path(GetDirectory()) / boost::filesystem::unique_path("%%%%-%%%%-%%%%-%%%%.tmp");
+    try {
+        {
+            std::ofstream file(tmpFile.string().c_str(), std::ios::binary);
+            if (!file) {
+                LOG(WARNING) << "Cannot write geometry cache file " << tmpFile.string();
+                return;
+            }
+
+            writeString(file, cacheFileMagic);
+            writeString(file, shape->Name());
+            writeString(file, shape->ShortName());
+            writeUInt(file, shape->GetFaceCount());
+            for (unsigned int iFace = 0; iFace < shape->GetFaceCount(); ++iFace) {
+                const CFaceTraits& traits = shape->GetFaceTraits(iFace);
+                writeString(file, traits.Name());
+                writeString(file, traits.ComponentUID());
+                writeUInt(file, traits.Index());
+
+                PNamedShape origin = traits.Origin();
+                if (!origin) {
+                    writeUInt(file, NoOrigin);
+                    writeString(file, "");
+                    writeString(file, "");
+                }
+                else {
+                    writeUInt(file, origin == shape ? SelfOrigin : OtherOrigin);
+                    writeString(file, origin->Name());
+                    writeString(file, origin->ShortName());
+                }
+
+                for (int row = 0; row < 4; ++row) {
+                    for (int col = 0; col < 4; ++col) {
+                        writeDouble(file, traits.Transformation().GetValue(row, col));
+                    }
+                }
+            }
+
+            BinTools::Write(shape->Shape(), file);
+            if (!file) {
+                throw CTiglError("Error writing geometry cache file " + tmpFile.string());
+            }
+        }
+
+        boost::filesystem::rename(tmpFile, filename);
+        LOG(INFO) << "Stored shape " << shape->Name() << " in geometry cache file " << filename;
+    }
+    catch (const Standard_Failure& err) {
+        LOG(WARNING) << "Cannot write geometry cache file " << filename << ": " << err.GetMessageString();
+    }
+    catch (const std::exception& err) {
+        LOG(WARNING) << "Cannot write geometry cache file " << filename << ": " << err.what();
+    }
+
+    boost::system::error_code ec;
+    boost::filesystem::remove(tmpFile, ec);
+}
+
+std::string CTiglPersistentShapeCache::ComputeKey(TixiDocumentHandle tixiHandle,
+                                                  const std::string& uid,
+                                                  const std::string& variant,
+                                                  const std::vector<std::string>& additionalDependencies)
+{
+    if (uid.empty() || tixiUIDCheckExists(tixiHandle, uid.c_str()) != SUCCESS) {
+        return "";
+    }
+
+    ContentHash hash;
+    hash.Add(TIGL_VERSION_STRING);
+    hash.Add(variant);
+
+    // depth first search over all referenced uids
+    std::vector<std::string> pending(additionalDependencies.rbegin(), additionalDependencies.rend());
+    pending.push_back(uid);
+
+    std::set<std::string> visited;
+    while (!pending.empty()) {
+        const std::string current = pending.back();
+        pending.pop_back();
+        if (!visited.insert(current).second) {
+            continue;
+        }
+
+        char* xpath = nullptr;
+        if (tixiUIDCheckExists(tixiHandle, current.c_str()) != SUCCESS ||
+            tixiUIDGetXPath(tixiHandle, current.c_str(), &xpath) != SUCCESS) {
+            // not a uid, just some text value
+            continue;
+        }
+
+        char* xml = nullptr;
+        if (tixiExportElementAsString(tixiHandle, xpath, &xml) != SUCCESS || !xml) {
+            LOG(WARNING) << "Cannot export CPACS element " << xpath << " for the geometry cache key.";
+            return "";
+        }
+
+        const std::string subtree(xml);
+        hash.Add(current);
+        hash.Add(subtree);
+
+        const std::vector<std::string> texts = elementTexts(subtree);
+        for (auto it = texts.rbegin(); it != texts.rend(); ++it) {
+            // skip vectors, these are never uids
+            if (it->find(';') == std::string::npos && visited.find(*it) == visited.end()) {
+                pending.push_back(*it);
+            }
+        }
+    }
+
+    return hash.HexDigest();
+}
+
+} // namespace tigl
@@ -0,0 +1,92 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @brief The CTiglPersistentShapeCache stores lofts of geometric components
+ * on disk, such that they can be reused by other processes opening the same
+ * CPACS data.
+ *
+ * Each shape is stored in binary BRep format together with its face traits.
+ * The shapes are identified by a key, that is computed from the CPACS
+ * description of the component and all elements it references.
+ */
+
+#ifndef CTIGLPERSISTENTSHAPECACHE_H
+#define CTIGLPERSISTENTSHAPECACHE_H
+
+#include "tigl_internal.h"
+#include "tixi.h"
+#include "PNamedShape.h"
+
+#include <boost/thread/mutex.hpp>
+
+#include <string>
+#include <vector>
+
+namespace tigl
+{
+
+class CTiglPersistentShapeCache
+{
+public:
+    // Returns a reference to the only instance of this class
+    TIGL_EXPORT static CTiglPersistentShapeCache& GetInstance();
+
+    /// Sets the cache directory. The directory is created, if it does not exist.
+    /// An empty directory disables the cache.
+    TIGL_EXPORT void SetDirectory(const std::string& directory);
+
+    /// Returns the cache directory or an empty string, if the cache is disabled
+    TIGL_EXPORT std::string GetDirectory() const;
+
+    /// Returns true, if a cache directory is set
+    TIGL_EXPORT bool IsEnabled() const;
+
+    /// Loads the shape with the given key. If the shape is not in the cache, a null pointer is returned
+    TIGL_EXPORT PNamedShape Load(const std::string& key) const;
+
+    /// Stores the shape with the given key in the cache
+    TIGL_EXPORT void Store(const std::string& key, const PNamedShape& shape) const;
+
+    /**
+     * @brief Computes the cache key of a CPACS element
+     *
+     * The key is a hash of the CPACS subtree of the element with the given uid,
+     * of the subtrees of all uids referenced therein (recursively) and of the
+     * additional dependencies. The TiGL version and the variant string are included
+     * as well, to distinguish different shapes built from the same CPACS element.
+     *
+     * Returns an empty string, if the uid cannot be found in the document.
+     */
+    TIGL_EXPORT static std::string ComputeKey(TixiDocumentHandle tixiHandle,
+                                              const std::string& uid,
+                                              const std::string& variant = "",
+                                              const std::vector<std::string>& additionalDependencies = std::vector<std::string>());
+
+private:
+    CTiglPersistentShapeCache() = default;
+    CTiglPersistentShapeCache(const CTiglPersistentShapeCache&) = delete;
+    void operator=(const CTiglPersistentShapeCache&) = delete;
+
+    std::string FileName(const std::string& key) const;
+
+    mutable boost::mutex m_mutex;
+    std::string m_directory;
+};
+
+} // namespace tigl
+
+#endif // CTIGLPERSISTENTSHAPECACHE_H
@@ -0,0 +1,275 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "CTiglPointInSolidClassifier.h"
+#include "CTiglError.h"
+#include "tiglparallel.h"
+
+#include <BRepBndLib.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
+#include <BRepClass3d_SolidClassifier.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRep_Tool.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
+
+#include <algorithm>
+#include <cmath>
+
+namespace tigl
+{
+
+namespace
+{
+    // tolerance of the barycentric coordinates to detect rays hitting triangle edges
+    const double kEdgeEpsilon = 1e-9;
+
+    // Squared distance between p and the triangle (a, b, c),
+    // see Ericson, Real-Time Collision Detection, 5.1.5
+    double squareDistanceToTriangle(const gp_XYZ& p, const gp_XYZ& a, const gp_XYZ& b, const gp_XYZ& c)
+    {
+        gp_XYZ ab = b - a;
+        gp_XYZ ac = c - a;
+        gp_XYZ ap = p - a;
+        double d1 = ab.Dot(ap);
+        double d2 = ac.Dot(ap);
+        if (d1 <= 0. && d2 <= 0.) {
+            return ap.SquareModulus();
+        }
+
+        gp_XYZ bp = p - b;
+        double d3 = ab.Dot(bp);
+        double d4 = ac.Dot(bp);
+        if (d3 >= 0. && d4 <= d3) {
+            return bp.SquareModulus();
+        }
+
+        double vc = d1*d4 - d3*d2;
+        if (vc <= 0. && d1 >= 0. && d3 <= 0.) {
+            double v = d1 / (d1 - d3);
+            return (p - (a + ab * v)).SquareModulus();
+        }
+
+        gp_XYZ cp = p - c;
+        double d5 = ab.Dot(cp);
+        double d6 = ac.Dot(cp);
+        if (d6 >= 0. && d5 <= d6) {
+            return cp.SquareModulus();
+        }
+
+        double vb = d5*d2 - d1*d6;
+        if (vb <= 0. && d2 >= 0. && d6 <= 0.) {
+            double w = d2 / (d2 - d6);
+            return (p - (a + ac * w)).SquareModulus();
+        }
+
+        double va = d3*d6 - d5*d4;
+        if (va <= 0. && (d4 - d3) >= 0. && (d5 - d6) >= 0.) {
+            double w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+            return (p - (b + (c - b) * w)).SquareModulus();
+        }
+
+        double denom = 1. / (va + vb + vc);
+        double v = vb * denom;
+        double w = vc * denom;
+        return (p - (a + ab * v + ac * w)).SquareModulus();
+    }
+}
+
+CTiglPointInSolidClassifier::CTiglPointInSolidClassifier(const TopoDS_Shape& solid, double tolerance)
+    : m_shape(solid)
+    , m_tolerance(tolerance)
+    , m_surfaceBand(0.)
+    , m_shapeIsReversed(false)
+{
+    if (solid.IsNull() || solid.ShapeType() != TopAbs_SOLID) {
+        throw CTiglError("The shape is not a solid");
+    }
+    m_solid = TopoDS::Solid(solid);
+
+    BRepBndLib::Add(m_solid, m_boundingBox);
+    m_boundingBox.Enlarge(m_tolerance);
+
+    // test whether a point at infinity lies inside. If yes, then the shape is reversed
+    BRepClass3d_SolidClassifier algo(m_solid);
+    algo.PerformInfinitePoint(m_tolerance);
+    m_shapeIsReversed = (algo.State() == TopAbs_IN);
+
+    // mesh a copy of the solid, to leave the triangulation of the original shape untouched
+    TopoDS_Shape meshShape = BRepBuilderAPI_Copy(m_solid, Standard_False).Shape();
+    double diagonal = std::sqrt(m_boundingBox.SquareExtent());
+    double deflection = std::max(1e-3 * diagonal, m_tolerance);
+    BRepMesh_IncrementalMesh(meshShape, deflection, Standard_False, 0.5, Standard_True);
+
+    double maxDeviation = 0.;
+    std::vector<Bnd_Box> boxes;
+    for (TopExp_Explorer exp(meshShape, TopAbs_FACE); exp.More(); exp.Next()) {
+        const TopoDS_Face& face = TopoDS::Face(exp.Current());
+        TopLoc_Location location;
+        const Handle(Poly_Triangulation) triangulation = BRep_Tool::Triangulation(face, location);
+        if (triangulation.IsNull()) {
+            // without a closed mesh, the ray test is not reliable
+            m_triangles.clear();
+            boxes.clear();
+            break;
+        }
+
+        maxDeviation = std::max(maxDeviation, std::max(triangulation->Deflection(), deflection) + BRep_Tool::Tolerance(face));
+
+        gp_Trsf nodeTransformation = location;
+        bool reversed = face.Orientation() == TopAbs_REVERSED;
+        for (int j = 1; j <= triangulation->NbTriangles(); j++) {
+            int i1, i2, i3;
+            triangulation->Triangle(j).Get(i1, i2, i3);
+            if (reversed) {
+                std::swap(i2, i3);
+            }
+
+            Triangle t;
+            t.p1 = triangulation->Node(i1).Transformed(nodeTransformation);
+            t.p2 = triangulation->Node(i2).Transformed(nodeTransformation);
+            t.p3 = triangulation->Node(i3).Transformed(nodeTransformation);
+            m_triangles.push_back(t);
+
+            Bnd_Box box;
+            box.Add(t.p1);
+            box.Add(t.p2);
+            box.Add(t.p3);
+            boxes.push_back(box);
+        }
+    }
+
+    m_surfaceBand = maxDeviation + m_tolerance;
+    m_bvh.Build(boxes);
+}
+
+const TopoDS_Shape& CTiglPointInSolidClassifier::GetShape() const
+{
+    return m_shape;
+}
+
+size_t CTiglPointInSolidClassifier::GetTriangleCount() const
+{
+    return m_triangles.size();
+}
+
+bool CTiglPointInSolidClassifier::Classify(const gp_Pnt& point) const
+{
+    if (m_boundingBox.IsOut(point)) {
+        return false;
+    }
+
+    if (m_triangles.empty() || IsNearSurface(point)) {
+        return ClassifyExact(point);
+    }
+
+    // two rays in skew directions, that are unlikely to hit mesh edges
+    static const gp_Dir dir1(1., 0.1234567, 0.0456789);
+    static const gp_Dir dir2(-0.0789123, 0.3456789, 1.);
+
+    RayResult result1 = CastRay(point, dir1);
+    if (result1 == RayAmbiguous) {
+        return ClassifyExact(point);
+    }
+    RayResult result2 = CastRay(point, dir2);
+    if (result2 != result1) {
+        // e.g. due to a gap in the mesh
+        return ClassifyExact(point);
+    }
+    return result1 == RayInside;
+}
+
+std::vector<bool> CTiglPointInSolidClassifier::Classify(const std::vector<gp_Pnt>& points) const
+{
+    // std::vector<bool> must not be written concurrently
+    std::vector<char> inside(points.size(), 0);
+    ParallelFor(0, static_cast<int>(points.size()), [&](int i) {
+        inside[i] = Classify(points[i]) ? 1 : 0;
+    });
+    return std::vector<bool>(inside.begin(), inside.end());
+}
+
+CTiglPointInSolidClassifier::RayResult CTiglPointInSolidClassifier::CastRay(const gp_Pnt& point, const gp_Dir& direction) const
+{
+    const gp_XYZ o = point.XYZ();
+    const gp_XYZ d = direction.XYZ();
+
+    // sum of the signed crossings of the ray with the oriented triangles
+    int winding = 0;
+    for (size_t index : m_bvh.FindAlongRay(point, direction)) {
+        const Triangle& t = m_triangles[index];
+
+        // Moeller-Trumbore intersection
+        gp_XYZ e1 = t.p2.XYZ() - t.p1.XYZ();
+        gp_XYZ e2 = t.p3.XYZ() - t.p1.XYZ();
+        gp_XYZ pvec = d.Crossed(e2);
+        double det = e1.Dot(pvec);
+        if (std::fabs(det) <= kEdgeEpsilon * e1.Modulus() * e2.Modulus()) {
+            // ray parallel to the triangle
+            continue;
+        }
+
+        double invDet = 1. / det;
+        gp_XYZ tvec = o - t.p1.XYZ();
+        double u = tvec.Dot(pvec) * invDet;
+        if (u < -kEdgeEpsilon || u > 1. + kEdgeEpsilon) {
+            continue;
+        }
+
+        gp_XYZ qvec = tvec.Crossed(e1);
+        double v = d.Dot(qvec) * invDet;
+        if (v < -kEdgeEpsilon || u + v > 1. + kEdgeEpsilon) {
+            continue;
+        }
+
+        if (e2.Dot(qvec) * invDet <= 0.) {
+            // behind the ray origin
+            continue;
+        }
+
+        if (u < kEdgeEpsilon || v < kEdgeEpsilon || u + v > 1. - kEdgeEpsilon) {
+            // ray hits an edge or a vertex of the mesh
+            return RayAmbiguous;
+        }
+
+        winding += det > 0. ? 1 : -1;
+    }
+
+    return winding != 0 ? RayInside : RayOutside;
+}
+
+bool CTiglPointInSolidClassifier::IsNearSurface(const gp_Pnt& point) const
+{
+    const double band2 = m_surfaceBand * m_surfaceBand;
+    for (size_t index : m_bvh.FindNear(point, m_surfaceBand)) {
+        const Triangle& t = m_triangles[index];
+        if (squareDistanceToTriangle(point.XYZ(), t.p1.XYZ(), t.p2.XYZ(), t.p3.XYZ()) <= band2) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool CTiglPointInSolidClassifier::ClassifyExact(const gp_Pnt& point) const
+{
+    BRepClass3d_SolidClassifier algo(m_solid);
+    algo.Perform(point, m_tolerance);
+    return ((algo.State() == TopAbs_IN) != m_shapeIsReversed) || (algo.State() == TopAbs_ON);
+}
+
+} // namespace tigl
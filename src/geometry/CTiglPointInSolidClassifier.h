@@ -0,0 +1,92 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @brief Classifies points against a solid, with the same result as IsPointInsideShape.
+ *
+ * The classifier triangulates a copy of the solid once and stores the triangles
+ * in a bounding volume hierarchy. Points far from the surface are classified by
+ * casting a ray and counting the signed crossings with the triangles (winding number).
+ * Points within the mesh deflection of the surface and ambiguous rays are classified
+ * by the exact BRepClass3d_SolidClassifier.
+ *
+ * Classify is thread-safe.
+ */
+
+#ifndef CTIGLPOINTINSOLIDCLASSIFIER_H
+#define CTIGLPOINTINSOLIDCLASSIFIER_H
+
+#include "tigl_internal.h"
+#include "CTiglBoundingVolumeHierarchy.h"
+
+#include <Bnd_Box.hxx>
+#include <TopoDS_Shape.hxx>
+#include <TopoDS_Solid.hxx>
+#include <gp_Pnt.hxx>
+
+#include <vector>
+
+namespace tigl
+{
+
+class CTiglPointInSolidClassifier
+{
+public:
+    /// Prepares the classifier. Throws, if the shape is not a solid.
+    TIGL_EXPORT explicit CTiglPointInSolidClassifier(const TopoDS_Shape& solid, double tolerance = 1e-3);
+
+    /// Returns true, if the point is inside the solid or on its boundary
+    TIGL_EXPORT bool Classify(const gp_Pnt& point) const;
+
+    /// Classifies all points in parallel
+    TIGL_EXPORT std::vector<bool> Classify(const std::vector<gp_Pnt>& points) const;
+
+    /// Returns the solid, this classifier was created for
+    TIGL_EXPORT const TopoDS_Shape& GetShape() const;
+
+    /// Returns the number of triangles of the internal mesh
+    TIGL_EXPORT size_t GetTriangleCount() const;
+
+private:
+    struct Triangle
+    {
+        gp_Pnt p1, p2, p3;
+    };
+
+    enum RayResult
+    {
+        RayInside,
+        RayOutside,
+        RayAmbiguous
+    };
+
+    RayResult CastRay(const gp_Pnt& point, const gp_Dir& direction) const;
+    bool IsNearSurface(const gp_Pnt& point) const;
+    bool ClassifyExact(const gp_Pnt& point) const;
+
+    TopoDS_Shape m_shape;
+    TopoDS_Solid m_solid;
+    double m_tolerance;
+    double m_surfaceBand;   // points closer than this to the mesh are classified exactly
+    bool m_shapeIsReversed;
+    Bnd_Box m_boundingBox;
+    std::vector<Triangle> m_triangles;
+    CTiglBoundingVolumeHierarchy m_bvh;
+};
+
+} // namespace tigl
+
+#endif // CTIGLPOINTINSOLIDCLASSIFIER_H
@@ -128,55 +128,52 @@ Handle(Geom_BSplineCurve) CTiglPointsToBSplineInterpolation::Curve() const
         params.pop_back();
     }
 
-    math_Matrix bsplMat =
-        CTiglBSplineAlgorithms::bsplineBasisMat(degree, toArray(knots)->Array1(), toArray(params)->Array1());
-
     // build left hand side of the linear system
+    // For closed curves, the first control points are wrapped around. This is a trick
+    // to make the matrix square and enforce the endpoint conditions.
     int nParams = static_cast<int>(params.size());
-    math_Matrix lhs(1, nParams, 1, nParams, 0.);
-    for (int iCol = 1; iCol <= nParams; ++iCol) {
-        lhs.SetCol(iCol, bsplMat.Col(iCol));
-    }
-    if (isClosed()) {
-        // sets the continuity constraints for closed curves on the left hand side if requested
-        // by wrapping around the control points
-
-        // This is a trick to make the matrix square and enforce the endpoint conditions
-        for (int iCol = 1; iCol <= degree; ++iCol) {
-            lhs.SetCol(iCol, lhs.Col(iCol) + bsplMat.Col(nParams + iCol));
+    CTiglSparseMatrix bsplMat =
+        CTiglBSplineAlgorithms::bsplineBasisMatSparse(degree, toArray(knots)->Array1(), toArray(params)->Array1());
+
+    const bool wrapControlPoints = isClosed();
+    CTiglSparseMatrix lhs(nParams, nParams);
+    for (int iRow = 0; iRow < nParams; ++iRow) {
+        for (int k = bsplMat.RowBegin(iRow); k < bsplMat.RowEnd(iRow); ++k) {
+            int iCol = bsplMat.ColIndex(k);
+            if (iCol < nParams) {
+                lhs.Add(iRow, iCol, bsplMat.EntryValue(k));
+            }
+            else if (wrapControlPoints && iCol < nParams + degree) {
+                lhs.Add(iRow, iCol - nParams, bsplMat.EntryValue(k));
+            }
         }
     }
 
     // right hand side
-    math_Vector rhsx(1, nParams, 0.);
-    math_Vector rhsy(1, nParams, 0.);
-    math_Vector rhsz(1, nParams, 0.);
+    math_Matrix rhs(1, nParams, 1, 3, 0.);
     for (int i = 1; i <= nParams; ++i) {
         const gp_Pnt& p = m_pnts->Value(i);
-        rhsx(i)         = p.X();
-        rhsy(i)         = p.Y();
-        rhsz(i)         = p.Z();
+        rhs(i, 1)       = p.X();
+        rhs(i, 2)       = p.Y();
+        rhs(i, 3)       = p.Z();
     }
 
-    math_Gauss solver(lhs);
-
-    math_Vector cp_x(1, nParams);
-    math_Vector cp_y(1, nParams);
-    math_Vector cp_z(1, nParams);
-
-    solver.Solve(rhsx, cp_x);
-    if (!solver.IsDone()) {
-        throw CTiglError("Singular Matrix", TIGL_MATH_ERROR);
-    }
-
-    solver.Solve(rhsy, cp_y);
-    if (!solver.IsDone()) {
-        throw CTiglError("Singular Matrix", TIGL_MATH_ERROR);
-    }
+    // the collocation matrix is banded, except for the wrapped control points
+    math_Matrix cp(rhs);
+    if (!lhs.SolveBanded(degree, cp)) {
+        math_Gauss solver(lhs.ToDense());
+        if (!solver.IsDone()) {
+            throw CTiglError("Singular Matrix", TIGL_MATH_ERROR);
+        }
 
-    solver.Solve(rhsz, cp_z);
-    if (!solver.IsDone()) {
-        throw CTiglError("Singular Matrix", TIGL_MATH_ERROR);
+        math_Vector x(1, nParams);
+        for (int icoord = 1; icoord <= 3; ++icoord) {
+            solver.Solve(rhs.Col(icoord), x);
+            if (!solver.IsDone()) {
+                throw CTiglError("Singular Matrix", TIGL_MATH_ERROR);
+            }
+            cp.SetCol(icoord, x);
+        }
     }
 
     int nCtrPnts = static_cast<int>(m_params.size());
@@ -188,14 +185,14 @@ Handle(Geom_BSplineCurve) CTiglPointsToBSplineInterpolation::Curve() const
     }
     TColgp_Array1OfPnt poles(1, nCtrPnts);
     for (Standard_Integer icp = 1; icp <= nParams; ++icp) {
-        gp_Pnt pnt(cp_x.Value(icp), cp_y.Value(icp), cp_z.Value(icp));
+        gp_Pnt pnt(cp(icp, 1), cp(icp, 2), cp(icp, 3));
         poles.SetValue(icp, pnt);
     }
 
     if (isClosed()) {
         // wrap control points
         for (Standard_Integer icp = 1; icp <= degree; ++icp) {
-            gp_Pnt pnt(cp_x.Value(icp), cp_y.Value(icp), cp_z.Value(icp));
+            gp_Pnt pnt(cp(icp, 1), cp(icp, 2), cp(icp, 3));
             poles.SetValue(nParams + icp, pnt);
         }
     }
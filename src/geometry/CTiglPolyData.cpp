@@ -27,11 +27,15 @@
 #include "tixi.h"
 #include "to_string.h"
 
+#include <algorithm>
 #include <iostream>
 #include <cassert>
+#include <climits>
+#include <cmath>
+#include <iterator>
 #include <vector>
 #include <map>
-#include <set>
+#include <unordered_map>
 #include <utility>
 
 #include <fstream>
@@ -45,217 +49,142 @@ using namespace tigl;
 #endif
 
 
+// two vertices closer than sqrt(COMP_TOLERANCE) with normals closer than that are welded
 #define COMP_TOLERANCE 1.e-10
 
+// edge length of the cells of the vertex hash grid, relative to the weld distance.
+// The cells are much larger than the weld distance, so that most lookups need to
+// check a single cell only
+#define CELL_SIZE_FACTOR 64.
 
-struct TiglPointComparer;
-
-class PointImpl 
+namespace
 {
-public:
-    PointImpl() : 
-        p_(CTiglPoint(0,0,0)),
-        n_(CTiglPoint(1,0,0)) 
-    {
-    }
 
-    PointImpl(const CTiglPoint& p, const CTiglPoint& n) : p_(p), n_(n) 
-    {
-        realDataMap.clear();
-    }
-
-    CTiglPoint& point(){ return p_; }
-    CTiglPoint& normal(){ return n_; }
+struct CellKey
+{
+    long long i, j, k;
 
-    const CTiglPoint& getPoint() const { return p_; }
-    const CTiglPoint& getNormal()const { return n_; }
-    
-    void setRealData(const char * txt, double value)
+    bool operator==(const CellKey& other) const
     {
-        realDataMap[txt] = value;
+        return i == other.i && j == other.j && k == other.k;
     }
-    
-    double getRealData(const char * txt) const 
-    {
-        std::map<std::string, double>::const_iterator it=realDataMap.find(txt);
-        if (it != realDataMap.end()) {
-            return it->second;
-        }
-        else {
-            return UNDEFINED_REAL;
-        }
-    }
-
-private:
-    CTiglPoint p_;
-    CTiglPoint n_;
-    
-    std::map<std::string, double> realDataMap;
 };
 
-typedef std::map<PointImpl, unsigned int, TiglPointComparer> PointMap;
-
-// Comparer for gp_Pnts
-struct TiglPointComparer
+struct CellKeyHash
 {
-    bool isSmaller(const CTiglPoint& lhs, const CTiglPoint& rhs) const 
-    {
-        // if two points lie inside the epsilon environment
-        // they should be the same, hence lhs is not smaller than rhs
-        if (lhs.distance2(rhs) < COMP_TOLERANCE ) {
-            return false;
-        }
-
-
-        // as lhs and rhs don't lie inside an epsilon environment
-        if (lhs.x < rhs.x) {
-            return true;
-        }
-        else if (lhs.x == rhs.x) {
-            if (lhs.y < rhs.y) {
-                return true;
-            }
-            else if (lhs.y == rhs.y) {
-                return lhs.z < rhs.z;
-            }
-            else {
-                return false;
-            }
-        }
-        else {
-            return false;
-        }
-    }
-
-
-    // function should only return true, if lhs < rhs
-    bool operator()(const PointImpl& lhs, const PointImpl& rhs) const
+    size_t operator()(const CellKey& key) const
     {
-        const CTiglPoint& leftP  = lhs.getPoint();
-        const CTiglPoint& rightP = rhs.getPoint();
-
-        const CTiglPoint& leftN  = lhs.getNormal();
-        const CTiglPoint& rightN = rhs.getNormal();
-
-        if (isSmaller(leftP,rightP)) {
-            return true;
-        }
-        else {
-            // if points are equal, compare normals
-            if (leftP.distance2(rightP) <  COMP_TOLERANCE ) {
-                return isSmaller(leftN, rightN);
-            }
-            else {
-                return false;
-            }
-        }
+        return static_cast<size_t>(key.i * 73856093LL ^ key.j * 19349663LL ^ key.k * 83492791LL);
     }
 };
 
+const unsigned int NO_VERTEX = UINT_MAX;
 
-//class to store a polygon by its point indices
-struct PolyIndexList
+typedef std::map<std::string, std::vector<double> > DataColumns;
+
+double getColumnValue(const DataColumns& columns, const char * name, unsigned long index)
 {
-    PolyIndexList(int num) : _metadata("")
-    {
-        myid = num;
+    DataColumns::const_iterator it = columns.find(name);
+    if (it != columns.end()) {
+        return it->second[index];
     }
-
-    void setMetadata(const std::string& str)
-    {
-        _metadata = str;
+    else {
+        return UNDEFINED_REAL;
     }
+}
 
-    const std::string& getMetadata() const
-    {
-        return _metadata;
-    }
-    
-    void addPoint(int index);
-    
-    void setRealData(const char * txt, double value)
-    {
-        realDataMap[txt] = value;
-    }
-    
-    double getRealData(const char * txt) const 
-    {
-        std::map<std::string, double>::const_iterator it=realDataMap.find(txt);
-        if (it != realDataMap.end()) {
-            return it->second;
-        }
-        else {
-            return UNDEFINED_REAL;
-        }
+void setColumnValue(DataColumns& columns, size_t columnSize, const char * name, unsigned long index, double value)
+{
+    std::vector<double>& column = columns[name];
+    // a new column has to be filled for all existing entries
+    column.resize(columnSize, UNDEFINED_REAL);
+    column[index] = value;
+}
+
+tigl::CTiglConstSpan<double> getColumn(const DataColumns& columns, const char * name)
+{
+    DataColumns::const_iterator it = columns.find(name);
+    if (it != columns.end()) {
+        return tigl::CTiglConstSpan<double>(it->second.data(), it->second.size());
     }
-    
-    int getNVert() const
-    {
-        return static_cast<int>(pindex.size());
+    else {
+        return tigl::CTiglConstSpan<double>();
     }
+}
 
-    int getPointIndex(int i) const
-    {
-        return pindex.at(i);
+void appendToColumns(DataColumns& columns)
+{
+    for (DataColumns::iterator it = columns.begin(); it != columns.end(); ++it) {
+        it->second.push_back(UNDEFINED_REAL);
     }
-    
-private:
-    std::vector<int> pindex;
-
-    //each polygon should have it's own metadata
-    std::string _metadata;
-    
-    std::map<std::string, double> realDataMap;
-
-    int myid;
-};
+}
 
+} // namespace
 
+// Stores the polygons as structure of arrays. Vertices are welded
+// using a spatial hash grid.
 class ObjectImpl 
 {
 public:
     ObjectImpl()
+        : has_normals(false)
+        , has_metadata(false)
+        , weldDistance(sqrt(COMP_TOLERANCE))
+        , cellSize(CELL_SIZE_FACTOR * sqrt(COMP_TOLERANCE))
     {
-        pointlist.clear();
-        polys.clear();
-        pPoints.clear();
-        has_normals = false;
-        has_metadata = false;
-        metaDataElements = "";
+        offsets.push_back(0);
     }
 
-    void addPointNorm(const CTiglPoint &p, const CTiglPoint& norm, long polynum);
     unsigned long addPointNorm(const CTiglPoint &p, const CTiglPoint &norm);
     
     unsigned long addTriangleByVertexIndex(unsigned long i1, unsigned long i2, unsigned long i3 );
     
     void addPolygon(const CTiglPolygon&);
+
+    void append(const ObjectImpl& other);
     
+    unsigned long getNVertices() const;
     unsigned long getNPolygons() const;
     unsigned long getNPointsOfPolygon(unsigned long ipoly) const;
 
-    const CTiglPoint& getVertexPoint(unsigned long iVertexIndex) const;
-    const CTiglPoint& getVertexNormal(unsigned long iVertexIndex) const;
-
-    unsigned long getVertexIndexOfPolygon(unsigned long ipoint, unsigned long ipoly) const;
+    CTiglPoint getVertexPoint(unsigned long iVertexIndex) const;
+    CTiglPoint getVertexNormal(unsigned long iVertexIndex) const;
 
     bool has_normals;
     bool has_metadata;
 
-    // we use this container to store point data, it allows us to find
-    // efficiently a specific point in the list
-    PointMap pointlist;
+    // x, y, z of each vertex
+    std::vector<double> points;
+    std::vector<double> normals;
 
-    // this vector keeps track of the order of points, it complies with
-    // the polygon indices
-    std::vector<PointImpl*> pPoints;
+    // vertex indices of the polygons and the start of each polygon
+    // in this list, including the end of the last polygon
+    std::vector<unsigned int> connectivity;
+    std::vector<unsigned int> offsets;
 
-    std::vector<PolyIndexList> polys;
-    
-    std::set<std::string> polyDataElems;
-    std::set<std::string> vertexDataElems;
+    // only polygons up to the last one with metadata are stored
+    std::vector<std::string> polyMetadata;
+
+    // one value per polygon / vertex for each named data field
+    DataColumns polyData;
+    DataColumns vertexData;
     
     std::string metaDataElements;
+
+private:
+    void beginPolygon();
+    void addIndexToLastPolygon(unsigned int index);
+
+    CellKey cellOf(double x, double y, double z) const;
+    unsigned int findVertex(const CTiglPoint& p, const CTiglPoint& n) const;
+    bool isSameVertex(unsigned int index, const CTiglPoint& p, const CTiglPoint& n) const;
+
+    double weldDistance;
+    double cellSize;
+
+    // first vertex in each cell of the hash grid and the next vertex of the same cell
+    std::unordered_map<CellKey, unsigned int, CellKeyHash> cellHeads;
+    std::vector<unsigned int> nextInCell;
 };
 
 
@@ -347,17 +276,6 @@ unsigned long CTiglPolyData::getTotalVertexCount() const
     return nVertices;
 }
 
-// --------------------------------------------------------------------------//
-
-void PolyIndexList::addPoint(int index)
-{
-    // dont add same point twice
-    if (pindex.size() == 0 || pindex.back() != index) {
-         pindex.push_back(index);
-    }
-}
-
-
 //--------------------------------------------------------------------------//
 
 CTiglPolyObject::CTiglPolyObject()
@@ -380,6 +298,14 @@ void CTiglPolyObject::addPolygon(const CTiglPolygon & polygon)
     impl->addPolygon(polygon);
 }
 
+void CTiglPolyObject::append(const CTiglPolyObject& other)
+{
+    if (&other == this) {
+        throw tigl::CTiglError("Cannot append a CTiglPolyObject to itself", TIGL_ERROR);
+    }
+    impl->append(*other.impl);
+}
+
 unsigned long CTiglPolyObject::addTriangleByVertexIndex(unsigned long i1, unsigned long i2, unsigned long i3)
 {
     return impl->addTriangleByVertexIndex(i1, i2, i3);
@@ -397,7 +323,7 @@ unsigned long CTiglPolyObject::getNPolygons() const
 
 unsigned long CTiglPolyObject::getNVertices() const
 {
-    return static_cast<unsigned long>(impl->pPoints.size());
+    return impl->getNVertices();
 }
 
 void CTiglPolyObject::enableNormals(bool normals_enabled)
@@ -414,7 +340,7 @@ unsigned long CTiglPolyObject::getVertexIndexOfPolygon(unsigned long iPoint, uns
 {
     if (iPoly < getNPolygons()) {
         if (iPoint < getNPointsOfPolygon(iPoly)) {
-            return impl->polys[iPoly].getPointIndex(iPoint);
+            return impl->connectivity[impl->offsets[iPoly] + iPoint];
         }
         else {
             throw tigl::CTiglError("Illegal Point Index at CTiglPolyObject::getVertexIndexOfPolygon", TIGL_INDEX_ERROR);
@@ -425,20 +351,20 @@ unsigned long CTiglPolyObject::getVertexIndexOfPolygon(unsigned long iPoint, uns
     }
 }
 
-const CTiglPoint& CTiglPolyObject::getVertexNormal(unsigned long iVertexIndex) const 
+CTiglPoint CTiglPolyObject::getVertexNormal(unsigned long iVertexIndex) const 
 {
     if (iVertexIndex < getNVertices()) {
-        return impl->pPoints[iVertexIndex]->getNormal();
+        return impl->getVertexNormal(iVertexIndex);
     }
     else {
         throw tigl::CTiglError("Illegal Vertex Index at CTiglPolyObject::getVertexNormal", TIGL_INDEX_ERROR);
     }
 }
 
-const CTiglPoint& CTiglPolyObject::getVertexPoint(unsigned long iVertexIndex) const 
+CTiglPoint CTiglPolyObject::getVertexPoint(unsigned long iVertexIndex) const 
 {
     if (iVertexIndex < getNVertices()) {
-        return impl->pPoints[iVertexIndex]->getPoint();
+        return impl->getVertexPoint(iVertexIndex);
     }
     else {
         throw tigl::CTiglError("Illegal Vertex Index at CTiglPolyObject::getVertexNormal", TIGL_INDEX_ERROR);
@@ -463,7 +389,10 @@ void CTiglPolyObject::setMetadataElements(const char * elems)
 const char * CTiglPolyObject::getPolyMetadata(unsigned long iPoly) const 
 {
     if (iPoly < getNPolygons()) {
-        return impl->polys[iPoly].getMetadata().c_str();
+        if (iPoly < impl->polyMetadata.size()) {
+            return impl->polyMetadata[iPoly].c_str();
+        }
+        return "";
     }
     else {
         throw tigl::CTiglError("Illegal Polygon Index at CTiglPolyObject::getPolyMetadata", TIGL_INDEX_ERROR);
@@ -473,7 +402,10 @@ const char * CTiglPolyObject::getPolyMetadata(unsigned long iPoly) const
 void CTiglPolyObject::setPolyMetadata(unsigned long iPoly, const char * txt)
 {
     if (iPoly < getNPolygons()) {
-        impl->polys[iPoly].setMetadata(txt);
+        if (iPoly >= impl->polyMetadata.size()) {
+            impl->polyMetadata.resize(iPoly + 1);
+        }
+        impl->polyMetadata[iPoly] = txt;
         impl->has_metadata = true;
     }
     else {
@@ -484,10 +416,7 @@ void CTiglPolyObject::setPolyMetadata(unsigned long iPoly, const char * txt)
 void CTiglPolyObject::setVertexDataReal(unsigned long iVertexIndex, const char *dataName, double value)
 {
     if (iVertexIndex < getNVertices()) {
-        //insert into elems
-        impl->vertexDataElems.insert(dataName);
-        
-        impl->pPoints[iVertexIndex]->setRealData(dataName, value);
+        setColumnValue(impl->vertexData, getNVertices(), dataName, iVertexIndex, value);
     }
     else {
         throw tigl::CTiglError("Illegal Vertex Index at CTiglPolyObject::setVertexDataReal", TIGL_INDEX_ERROR);
@@ -497,7 +426,7 @@ void CTiglPolyObject::setVertexDataReal(unsigned long iVertexIndex, const char *
 double CTiglPolyObject::getVertexDataReal(unsigned long iVertexIndex, const char *dataName) const
 {
     if (iVertexIndex < getNVertices()) {
-        return impl->pPoints[iVertexIndex]->getRealData(dataName);
+        return getColumnValue(impl->vertexData, dataName, iVertexIndex);
     }
     else {
         throw tigl::CTiglError("Illegal Vertex Index at CTiglPolyObject::getVertexDataReal", TIGL_INDEX_ERROR);
@@ -507,10 +436,7 @@ double CTiglPolyObject::getVertexDataReal(unsigned long iVertexIndex, const char
 void CTiglPolyObject::setPolyDataReal(unsigned long iPolyIndex, const char *dataName, double value)
 {
     if (iPolyIndex < getNPolygons()) {
-        //insert into elems
-        impl->polyDataElems.insert(dataName);
-        
-        impl->polys[iPolyIndex].setRealData(dataName, value);
+        setColumnValue(impl->polyData, getNPolygons(), dataName, iPolyIndex, value);
     }
     else {
         throw tigl::CTiglError("Illegal Polygon Index at CTiglPolyObject::setPolyDataReal", TIGL_INDEX_ERROR);
@@ -520,7 +446,7 @@ void CTiglPolyObject::setPolyDataReal(unsigned long iPolyIndex, const char *data
 double CTiglPolyObject::getPolyDataReal(unsigned long iPolyIndex, const char *dataName) const
 {
     if (iPolyIndex < getNPolygons()) {
-        return impl->polys[iPolyIndex].getRealData(dataName);
+        return getColumnValue(impl->polyData, dataName, iPolyIndex);
     }
     else {
         throw tigl::CTiglError("Illegal Polygon Index at CTiglPolyObject::getPolyDataReal", TIGL_INDEX_ERROR);
@@ -530,18 +456,16 @@ double CTiglPolyObject::getPolyDataReal(unsigned long iPolyIndex, const char *da
 // returns the number if different polygon data entries 
 unsigned int CTiglPolyObject::getNumberOfPolyRealData() const 
 {
-    return static_cast<unsigned int>(impl->polyDataElems.size());
+    return static_cast<unsigned int>(impl->polyData.size());
 }
 
 // returns the name of the ith data field (i = 0 .. getNumberPolyReadlData - 1)
 const char * CTiglPolyObject::getPolyDataFieldName(unsigned long iField) const 
 {
     if (iField < getNumberOfPolyRealData()) {
-        std::set<std::string>::iterator it = impl->polyDataElems.begin();
-        for (unsigned long i = 0; i < iField; ++i) {
-            ++it;
-        }
-        return it->c_str();
+        DataColumns::const_iterator it = impl->polyData.begin();
+        std::advance(it, iField);
+        return it->first.c_str();
     }
     else {
         throw tigl::CTiglError("Illegal Data Field Index at CTiglPolyObject::getPolyDataFieldName", TIGL_INDEX_ERROR);
@@ -549,6 +473,36 @@ const char * CTiglPolyObject::getPolyDataFieldName(unsigned long iField) const
 }
 
 
+CTiglConstSpan<double> CTiglPolyObject::getPointData() const
+{
+    return CTiglConstSpan<double>(impl->points.data(), impl->points.size());
+}
+
+CTiglConstSpan<double> CTiglPolyObject::getNormalData() const
+{
+    return CTiglConstSpan<double>(impl->normals.data(), impl->normals.size());
+}
+
+CTiglConstSpan<unsigned int> CTiglPolyObject::getConnectivity() const
+{
+    return CTiglConstSpan<unsigned int>(impl->connectivity.data(), impl->connectivity.size());
+}
+
+CTiglConstSpan<unsigned int> CTiglPolyObject::getPolygonOffsets() const
+{
+    return CTiglConstSpan<unsigned int>(impl->offsets.data(), impl->offsets.size());
+}
+
+CTiglConstSpan<double> CTiglPolyObject::getPolyDataColumn(const char * dataName) const
+{
+    return getColumn(impl->polyData, dataName);
+}
+
+CTiglConstSpan<double> CTiglPolyObject::getVertexDataColumn(const char * dataName) const
+{
+    return getColumn(impl->vertexData, dataName);
+}
+
 //---------------------------------------------------------------------------//
 
 CTiglPolygon::CTiglPolygon()
@@ -600,41 +554,114 @@ const char * CTiglPolygon::getMetadata() const
 
 //--------------------------------------------------------------//
 
-void ObjectImpl::addPointNorm(const CTiglPoint& p, const CTiglPoint& n, long polynum)
+unsigned long ObjectImpl::getNVertices() const
 {
-    unsigned long index = addPointNorm(p,n);
+    return static_cast<unsigned long>(points.size() / 3);
+}
 
-    // now insert point into polygon list
-    if (polynum > (long) polys.size()) {
-        polys.push_back(PolyIndexList(polynum));
+CTiglPoint ObjectImpl::getVertexPoint(unsigned long iVertexIndex) const
+{
+    const double* p = &points[3*iVertexIndex];
+    return CTiglPoint(p[0], p[1], p[2]);
+}
+
+CTiglPoint ObjectImpl::getVertexNormal(unsigned long iVertexIndex) const
+{
+    const double* n = &normals[3*iVertexIndex];
+    return CTiglPoint(n[0], n[1], n[2]);
+}
+
+CellKey ObjectImpl::cellOf(double x, double y, double z) const
+{
+    CellKey key;
+    key.i = static_cast<long long>(std::floor(x / cellSize));
+    key.j = static_cast<long long>(std::floor(y / cellSize));
+    key.k = static_cast<long long>(std::floor(z / cellSize));
+    return key;
+}
+
+bool ObjectImpl::isSameVertex(unsigned int index, const CTiglPoint& p, const CTiglPoint& n) const
+{
+    return getVertexPoint(index).distance2(p) < COMP_TOLERANCE
+        && getVertexNormal(index).distance2(n) < COMP_TOLERANCE;
+}
+
+unsigned int ObjectImpl::findVertex(const CTiglPoint& p, const CTiglPoint& n) const
+{
+    if (cellHeads.empty()) {
+        return NO_VERTEX;
     }
-    assert(polynum == polys.size());
-    polys.at(polynum-1).addPoint(index);
+
+    // all cells touched by the weld environment of p, at most two per axis
+    CellKey low  = cellOf(p.x - weldDistance, p.y - weldDistance, p.z - weldDistance);
+    CellKey high = cellOf(p.x + weldDistance, p.y + weldDistance, p.z + weldDistance);
+
+    CellKey key;
+    for (key.i = low.i; key.i <= high.i; ++key.i) {
+        for (key.j = low.j; key.j <= high.j; ++key.j) {
+            for (key.k = low.k; key.k <= high.k; ++key.k) {
+                std::unordered_map<CellKey, unsigned int, CellKeyHash>::const_iterator it = cellHeads.find(key);
+                if (it == cellHeads.end()) {
+                    continue;
+                }
+                for (unsigned int index = it->second; index != NO_VERTEX; index = nextInCell[index]) {
+                    if (isSameVertex(index, p, n)) {
+                        return index;
+                    }
+                }
+            }
+        }
+    }
+
+    return NO_VERTEX;
 }
 
 unsigned long ObjectImpl::addPointNorm(const CTiglPoint& p, const CTiglPoint& n) 
 {
     //check if point is already in pointlist
-    unsigned int index = static_cast<unsigned int>(pointlist.size());
-    std::pair<PointMap::iterator,bool> ret;
-
-    ret = pointlist.insert(std::pair<PointImpl, int>(PointImpl(p,n),index));
-    index = ret.first->second;
-/*#ifndef NDEBUG
-    if(ret.second == false){
-        double dist = ret.first->first.dist2(p);
-        assert(pointlist.size() == 0 ||  dist < 1e-9);
-    }
-#endif*/
-    if (ret.second == true) {
-        // a new point was inserted, we have to keep track
-        PointImpl * ptmp = (PointImpl*)&ret.first->first;
-        pPoints.push_back(ptmp);
+    unsigned int index = findVertex(p, n);
+    if (index != NO_VERTEX) {
+        return index;
+    }
+
+    index = static_cast<unsigned int>(getNVertices());
+    points.push_back(p.x);
+    points.push_back(p.y);
+    points.push_back(p.z);
+    normals.push_back(n.x);
+    normals.push_back(n.y);
+    normals.push_back(n.z);
+    appendToColumns(vertexData);
+
+    // prepend the vertex to the list of its cell
+    std::pair<std::unordered_map<CellKey, unsigned int, CellKeyHash>::iterator, bool> ret =
+        cellHeads.insert(std::make_pair(cellOf(p.x, p.y, p.z), index));
+    if (ret.second) {
+        nextInCell.push_back(NO_VERTEX);
     }
-    
+    else {
+        nextInCell.push_back(ret.first->second);
+        ret.first->second = index;
+    }
+
     return index;
 }
 
+void ObjectImpl::beginPolygon()
+{
+    offsets.push_back(offsets.back());
+    appendToColumns(polyData);
+}
+
+void ObjectImpl::addIndexToLastPolygon(unsigned int index)
+{
+    // dont add same point twice
+    if (offsets.back() == offsets[offsets.size() - 2] || connectivity.back() != index) {
+        connectivity.push_back(index);
+        offsets.back()++;
+    }
+}
+
 unsigned long ObjectImpl::addTriangleByVertexIndex(unsigned long i1, unsigned long i2, unsigned long i3 )
 {
     // if we don't have a true triangle / 2 indices are the same, report error
@@ -642,13 +669,11 @@ unsigned long ObjectImpl::addTriangleByVertexIndex(unsigned long i1, unsigned lo
         return ULONG_MAX;
     }
 
-    unsigned long nPolys = static_cast<unsigned long>(polys.size());
-    polys.push_back(PolyIndexList(nPolys));
-    
-    std::vector<PolyIndexList>::iterator itLastPoly = polys.end()-1;
-    itLastPoly->addPoint(i1);
-    itLastPoly->addPoint(i2);
-    itLastPoly->addPoint(i3);
+    unsigned long nPolys = getNPolygons();
+    beginPolygon();
+    addIndexToLastPolygon(static_cast<unsigned int>(i1));
+    addIndexToLastPolygon(static_cast<unsigned int>(i2));
+    addIndexToLastPolygon(static_cast<unsigned int>(i3));
     
     return nPolys;
 }
@@ -656,35 +681,80 @@ unsigned long ObjectImpl::addTriangleByVertexIndex(unsigned long i1, unsigned lo
 
 void ObjectImpl::addPolygon(const CTiglPolygon & poly)
 {
-    long polynum = static_cast<long>(polys.size()) + 1;
+    unsigned long iPoly = getNPolygons();
+    beginPolygon();
     if (!has_normals) {
         for (unsigned long i = 0 ; i < poly.getNPoints(); ++i) {
             CTiglPoint n(1,0,0);
-            addPointNorm(poly.getPointConst(i), n, polynum);
+            addIndexToLastPolygon(addPointNorm(poly.getPointConst(i), n));
         }
     }
     else {
         for (unsigned long i = 0 ; i < poly.getNPoints(); ++i) {
-            addPointNorm(poly.getPointConst(i), poly.getNormConst(i), polynum);
+            addIndexToLastPolygon(addPointNorm(poly.getPointConst(i), poly.getNormConst(i)));
         }
     }
-    assert(polynum == polys.size());
-    polys.at(polynum-1).setMetadata(poly.getMetadata());
+
+    const char* metadata = poly.getMetadata();
+    if (metadata[0] != '\0') {
+        polyMetadata.resize(iPoly + 1);
+        polyMetadata[iPoly] = metadata;
+    }
 }
 
 
+void ObjectImpl::append(const ObjectImpl& other)
+{
+    const unsigned long nPolysBefore = getNPolygons();
+
+    std::vector<unsigned int> vertexMap(other.getNVertices());
+    for (unsigned long i = 0; i < other.getNVertices(); ++i) {
+        unsigned long nVerticesBefore = getNVertices();
+        vertexMap[i] = static_cast<unsigned int>(addPointNorm(other.getVertexPoint(i), other.getVertexNormal(i)));
+
+        // welded vertices keep their data
+        if (vertexMap[i] < nVerticesBefore) {
+            continue;
+        }
+        for (DataColumns::const_iterator it = other.vertexData.begin(); it != other.vertexData.end(); ++it) {
+            setColumnValue(vertexData, getNVertices(), it->first.c_str(), vertexMap[i], it->second[i]);
+        }
+    }
+
+    for (unsigned long iPoly = 0; iPoly < other.getNPolygons(); ++iPoly) {
+        beginPolygon();
+        for (unsigned int j = other.offsets[iPoly]; j < other.offsets[iPoly + 1]; ++j) {
+            addIndexToLastPolygon(vertexMap[other.connectivity[j]]);
+        }
+    }
+
+    for (DataColumns::const_iterator it = other.polyData.begin(); it != other.polyData.end(); ++it) {
+        std::vector<double>& column = polyData[it->first];
+        column.resize(getNPolygons(), UNDEFINED_REAL);
+        std::copy(it->second.begin(), it->second.end(), column.begin() + nPolysBefore);
+    }
+
+    if (other.has_metadata) {
+        polyMetadata.resize(nPolysBefore + other.polyMetadata.size());
+        std::copy(other.polyMetadata.begin(), other.polyMetadata.end(), polyMetadata.begin() + nPolysBefore);
+        has_metadata = true;
+    }
+    if (metaDataElements.empty()) {
+        metaDataElements = other.metaDataElements;
+    }
+}
+
 unsigned long ObjectImpl::getNPolygons() const 
 {
-    return static_cast<unsigned long>(polys.size());
+    return static_cast<unsigned long>(offsets.size() - 1);
 }
 
 unsigned long ObjectImpl::getNPointsOfPolygon(unsigned long ipoly) const 
 {
     if (ipoly < getNPolygons()) {
-        return polys[ipoly].getNVert();
+        return offsets[ipoly + 1] - offsets[ipoly];
     }
     else {
         throw tigl::CTiglError("Illegal Polygon Index at SurfaceImpl::getNPointsOfPolygon", TIGL_INDEX_ERROR);
     }
 }
-
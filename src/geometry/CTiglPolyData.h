@@ -22,6 +22,7 @@
 #ifndef VTKPOLYDATA_H
 #define VTKPOLYDATA_H
 
+#include <cstddef>
 #include <vector>
 #include "tigl_internal.h"
 #include <tixi.h>
@@ -34,6 +35,28 @@ class ObjectImpl;
 namespace tigl 
 {
 
+// read-only view of a contiguous buffer of the polygon data, e.g. for exporters
+template <typename T>
+class CTiglConstSpan
+{
+public:
+    CTiglConstSpan() : m_data(nullptr), m_size(0) {}
+    CTiglConstSpan(const T* data, size_t size) : m_data(data), m_size(size) {}
+
+    const T* data() const { return m_data; }
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    const T& operator[](size_t i) const { return m_data[i]; }
+
+    const T* begin() const { return m_data; }
+    const T* end() const { return m_data + m_size; }
+
+private:
+    const T* m_data;
+    size_t m_size;
+};
+
 class CTiglPolygon
 {
 public:
@@ -83,6 +106,10 @@ public:
 
     // adds a polygon to the object
     TIGL_EXPORT void addPolygon(const class CTiglPolygon&);
+
+    // appends all polygons of the other object, including their data fields and metadata.
+    // The vertices are welded with the vertices of this object
+    TIGL_EXPORT void append(const CTiglPolyObject& other);
     
     TIGL_EXPORT unsigned long getNVertices() const;
 
@@ -119,10 +146,10 @@ public:
     TIGL_EXPORT unsigned long addPointNormal(const class CTiglPoint& p, const class CTiglPoint& n);
     
     // returns the actual point, specified with the vertex index
-    TIGL_EXPORT const CTiglPoint& getVertexPoint(unsigned long iVertexIndex) const;
+    TIGL_EXPORT CTiglPoint getVertexPoint(unsigned long iVertexIndex) const;
     
     // returns the normal vector, specified with vertex index
-    TIGL_EXPORT const CTiglPoint& getVertexNormal(unsigned long iVertexIndex) const;
+    TIGL_EXPORT CTiglPoint getVertexNormal(unsigned long iVertexIndex) const;
     
     // each vertex has a list of data elements, this methods sets the value
     TIGL_EXPORT void setVertexDataReal(unsigned long iVertexIndex, const char * dataName, double value);
@@ -135,6 +162,27 @@ public:
     // returns the name of the ith data field (i = 0 .. getNumberPolyReadlData - 1)
     TIGL_EXPORT const char * getPolyDataFieldName(unsigned long iField) const;
 
+    //  ---------- Raw buffer access -----------------
+
+    // coordinates of all vertices, stored as x0, y0, z0, x1, y1, z1, ...
+    TIGL_EXPORT CTiglConstSpan<double> getPointData() const;
+
+    // normal vectors of all vertices, stored as the points
+    TIGL_EXPORT CTiglConstSpan<double> getNormalData() const;
+
+    // vertex indices of all polygons, one polygon after the other
+    TIGL_EXPORT CTiglConstSpan<unsigned int> getConnectivity() const;
+
+    // getNPolygons() + 1 offsets into the connectivity. The vertex indices of polygon i
+    // are stored from offsets[i] up to (excluding) offsets[i+1]
+    TIGL_EXPORT CTiglConstSpan<unsigned int> getPolygonOffsets() const;
+
+    // returns the values of a polygon data field for all polygons, empty if the field does not exist
+    TIGL_EXPORT CTiglConstSpan<double> getPolyDataColumn(const char * dataName) const;
+
+    // returns the values of a vertex data field for all vertices, empty if the field does not exist
+    TIGL_EXPORT CTiglConstSpan<double> getVertexDataColumn(const char * dataName) const;
+
 
 private:
     CTiglPolyObject& operator=(const CTiglPolyObject&);
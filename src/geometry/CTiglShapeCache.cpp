@@ -17,32 +17,90 @@
 */
 
 #include "CTiglShapeCache.h"
+
+#include <BRep_Tool.hxx>
+#include <Geom_BSplineCurve.hxx>
+#include <Geom_BSplineSurface.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TopExp.hxx>
+#include <TopoDS.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+
 #include <sstream>
 
 namespace tigl 
 {
 
+namespace
+{
+    // Intersections with planes are cheap to request, hence long sessions
+    // can accumulate a large number of cached results
+    const size_t kDefaultMemoryBudget = size_t(512) * 1024 * 1024;
+}
+
 CTiglShapeCache::CTiglShapeCache() 
+    : memoryBudget(kDefaultMemoryBudget)
+    , memoryUsage(0)
+    , hitCount(0)
+    , missCount(0)
+    , evictionCount(0)
 {
     Reset();
 }
 
 void CTiglShapeCache::Insert(const TopoDS_Shape &shape, const std::string& id)
 {
+    SynchronizeUsage();
+
     shapeContainer[id] = shape;
+
+    const size_t size = EstimateShapeSize(shape);
+    std::map<std::string, Entry>::iterator it = entries.find(id);
+    if (it != entries.end()) {
+        memoryUsage -= it->second.size;
+        it->second.size = size;
+        usageList.splice(usageList.begin(), usageList, it->second.usage);
+    }
+    else {
+        usageList.push_front(id);
+        Entry entry;
+        entry.usage = usageList.begin();
+        entry.size = size;
+        entries[id] = entry;
+    }
+    memoryUsage += size;
+
+    EvictIfNeeded();
 }
 
 TopoDS_Shape& CTiglShapeCache::GetShape(const std::string& id) 
 {
     ShapeContainer::iterator it = shapeContainer.find(id);
     if (it == shapeContainer.end()) {
+        missCount++;
         return nullShape;
     }
     else {
+        hitCount++;
+        Touch(id);
         return it->second;
     }
 }
 
+const TopoDS_Shape* CTiglShapeCache::Find(const std::string& id)
+{
+    ShapeContainer::iterator it = shapeContainer.find(id);
+    if (it == shapeContainer.end()) {
+        missCount++;
+        return nullptr;
+    }
+    else {
+        hitCount++;
+        Touch(id);
+        return &it->second;
+    }
+}
+
 /// Returns true, if the shape with id is in the cache
 bool CTiglShapeCache::HasShape(const std::string& id)
 {
@@ -59,6 +117,9 @@ unsigned int CTiglShapeCache::GetNShape() const
 void CTiglShapeCache::Clear()
 {
     shapeContainer.clear();
+    entries.clear();
+    usageList.clear();
+    memoryUsage = 0;
 }
 
 void CTiglShapeCache::Remove(const std::string& id) 
@@ -67,6 +128,13 @@ void CTiglShapeCache::Remove(const std::string& id)
     if (it != shapeContainer.end()) {
         shapeContainer.erase(it);
     }
+
+    std::map<std::string, Entry>::iterator entryIt = entries.find(id);
+    if (entryIt != entries.end()) {
+        memoryUsage -= entryIt->second.size;
+        usageList.erase(entryIt->second.usage);
+        entries.erase(entryIt);
+    }
 }
 
 void CTiglShapeCache::Reset() 
@@ -80,4 +148,147 @@ CTiglShapeCache::ShapeContainer& CTiglShapeCache::GetContainer()
     return shapeContainer;
 }
 
+void CTiglShapeCache::SetMemoryBudget(size_t bytes)
+{
+    memoryBudget = bytes;
+    SynchronizeUsage();
+    EvictIfNeeded();
+}
+
+size_t CTiglShapeCache::GetMemoryBudget() const
+{
+    return memoryBudget;
+}
+
+size_t CTiglShapeCache::GetMemoryUsage()
+{
+    SynchronizeUsage();
+    return memoryUsage;
+}
+
+size_t CTiglShapeCache::GetHitCount() const
+{
+    return hitCount;
+}
+
+size_t CTiglShapeCache::GetMissCount() const
+{
+    return missCount;
+}
+
+size_t CTiglShapeCache::GetEvictionCount() const
+{
+    return evictionCount;
+}
+
+void CTiglShapeCache::ResetStatistics()
+{
+    hitCount = 0;
+    missCount = 0;
+    evictionCount = 0;
+}
+
+void CTiglShapeCache::Touch(const std::string& id)
+{
+    std::map<std::string, Entry>::iterator it = entries.find(id);
+    if (it != entries.end()) {
+        usageList.splice(usageList.begin(), usageList, it->second.usage);
+    }
+}
+
+void CTiglShapeCache::SynchronizeUsage()
+{
+    // the container might have been modified directly via GetContainer
+    if (shapeContainer.size() == entries.size()) {
+        return;
+    }
+
+    // remove entries, that are not in the container anymore
+    for (std::map<std::string, Entry>::iterator it = entries.begin(); it != entries.end();) {
+        if (shapeContainer.find(it->first) == shapeContainer.end()) {
+            memoryUsage -= it->second.size;
+            usageList.erase(it->second.usage);
+            it = entries.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+
+    // add new shapes of the container as least recently used
+    for (ShapeContainer::iterator it = shapeContainer.begin(); it != shapeContainer.end(); ++it) {
+        if (entries.find(it->first) == entries.end()) {
+            usageList.push_back(it->first);
+            Entry entry;
+            entry.usage = --usageList.end();
+            entry.size = EstimateShapeSize(it->second);
+            entries[it->first] = entry;
+            memoryUsage += entry.size;
+        }
+    }
+}
+
+void CTiglShapeCache::EvictIfNeeded()
+{
+    if (memoryBudget == 0) {
+        return;
+    }
+
+    // keep at least the most recently used shape, even if it exceeds the budget
+    while (memoryUsage > memoryBudget && usageList.size() > 1) {
+        const std::string id = usageList.back();
+        Remove(id);
+        evictionCount++;
+    }
+}
+
+size_t CTiglShapeCache::EstimateShapeSize(const TopoDS_Shape& shape)
+{
+    if (shape.IsNull()) {
+        return 0;
+    }
+
+    // approximate size of a topological entity with its geometry handles,
+    // tolerances and locations, excluding the geometric data itself
+    const size_t entitySize = 200;
+
+    TopTools_IndexedMapOfShape faces, edges, vertices;
+    TopExp::MapShapes(shape, TopAbs_FACE, faces);
+    TopExp::MapShapes(shape, TopAbs_EDGE, edges);
+    TopExp::MapShapes(shape, TopAbs_VERTEX, vertices);
+
+    size_t size = entitySize * static_cast<size_t>(faces.Extent() + edges.Extent() + vertices.Extent() + 1);
+
+    for (int iFace = 1; iFace <= faces.Extent(); ++iFace) {
+        const TopoDS_Face& face = TopoDS::Face(faces(iFace));
+        TopLoc_Location location;
+
+        Handle(Geom_BSplineSurface) surface = Handle(Geom_BSplineSurface)::DownCast(BRep_Tool::Surface(face, location));
+        if (!surface.IsNull()) {
+            size += static_cast<size_t>(surface->NbUPoles() * surface->NbVPoles()) * (sizeof(gp_Pnt) + sizeof(double));
+            size += static_cast<size_t>(surface->NbUKnots() + surface->NbVKnots()) * (sizeof(double) + sizeof(int));
+        }
+
+        Handle(Poly_Triangulation) triangulation = BRep_Tool::Triangulation(face, location);
+        if (!triangulation.IsNull()) {
+            size += static_cast<size_t>(triangulation->NbNodes()) * sizeof(gp_Pnt);
+            size += static_cast<size_t>(triangulation->NbTriangles()) * 3 * sizeof(int);
+        }
+    }
+
+    for (int iEdge = 1; iEdge <= edges.Extent(); ++iEdge) {
+        const TopoDS_Edge& edge = TopoDS::Edge(edges(iEdge));
+        TopLoc_Location location;
+        Standard_Real first, last;
+
+        Handle(Geom_BSplineCurve) curve = Handle(Geom_BSplineCurve)::DownCast(BRep_Tool::Curve(edge, location, first, last));
+        if (!curve.IsNull()) {
+            size += static_cast<size_t>(curve->NbPoles()) * (sizeof(gp_Pnt) + sizeof(double));
+            size += static_cast<size_t>(curve->NbKnots()) * (sizeof(double) + sizeof(int));
+        }
+    }
+
+    return size;
+}
+
 } // namespace tigl
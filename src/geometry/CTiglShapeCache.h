@@ -19,12 +19,17 @@
 /**
  * @brief The CTiglShapeCache class acts as a storage for all kinds of intermediate 
  * shape results in order to improve speed of reoccurent calculations.
+ *
+ * The memory consumption of the cache can be bounded by a memory budget. If the
+ * approximate size of all cached shapes exceeds the budget, the least recently
+ * used shapes are evicted from the cache.
  */
 
 #ifndef CTIGLSHAPECACHE_H
 #define CTIGLSHAPECACHE_H
 
 #include "tigl_internal.h"
+#include <list>
 #include <map>
 #include <string>
 #include <TopoDS_Shape.hxx>
@@ -39,11 +44,17 @@ public:
     
     TIGL_EXPORT CTiglShapeCache();
     
-    /// Inserts a shape with the given id into the cache
+    /// Inserts a shape with the given id into the cache.
+    /// If the memory budget is exceeded, the least recently used shapes are evicted.
     TIGL_EXPORT void Insert(const TopoDS_Shape& shape, const std::string& id);
     
     /// Returns the shape with the given id. If the shape is not found, a nullshape/empty shape is returned
+    /// The returned reference is valid until the next insertion into the cache.
     TIGL_EXPORT TopoDS_Shape& GetShape(const std::string& id);
+
+    /// Returns a pointer to the shape with the given id or a nullptr, if the shape is not in the cache
+    /// The returned pointer is valid until the next insertion into the cache.
+    TIGL_EXPORT const TopoDS_Shape* Find(const std::string& id);
     
     /// Returns true, if the shape with id is in the cache
     TIGL_EXPORT bool HasShape(const std::string& id);
@@ -58,13 +69,65 @@ public:
     TIGL_EXPORT void Clear();
     
     /// Returns the underlying map for direct access
+    /// Shapes added directly to the map are treated as least recently used.
     TIGL_EXPORT ShapeContainer& GetContainer();
+
+    /// Sets the memory budget of the cache in bytes (default: 512 MB). A budget of 0 disables the limit.
+    /// Evicted shapes are no longer found by their id.
+    TIGL_EXPORT void SetMemoryBudget(size_t bytes);
+
+    /// Returns the memory budget of the cache in bytes
+    TIGL_EXPORT size_t GetMemoryBudget() const;
+
+    /// Returns the approximate memory consumption of all cached shapes in bytes
+    TIGL_EXPORT size_t GetMemoryUsage();
+
+    /// Returns the number of successful lookups via GetShape or Find
+    TIGL_EXPORT size_t GetHitCount() const;
+
+    /// Returns the number of failed lookups via GetShape or Find
+    TIGL_EXPORT size_t GetMissCount() const;
+
+    /// Returns the number of shapes evicted due to the memory budget
+    TIGL_EXPORT size_t GetEvictionCount() const;
+
+    /// Resets the hit, miss and eviction counters
+    TIGL_EXPORT void ResetStatistics();
+
+    /// Returns the approximate memory consumption of a shape in bytes
+    TIGL_EXPORT static size_t EstimateShapeSize(const TopoDS_Shape& shape);
     
 private:
+    typedef std::list<std::string> UsageList;
+
+    struct Entry
+    {
+        UsageList::iterator usage;
+        size_t size;
+    };
+
     void Reset();
+
+    // marks the shape as most recently used
+    void Touch(const std::string& id);
+
+    // updates the usage data of shapes, that have been modified via GetContainer
+    void SynchronizeUsage();
+
+    void EvictIfNeeded();
     
     ShapeContainer shapeContainer;
     TopoDS_Shape nullShape;
+
+    // ids ordered from the most recently to the least recently used
+    UsageList usageList;
+    std::map<std::string, Entry> entries;
+
+    size_t memoryBudget;
+    size_t memoryUsage;
+    size_t hitCount;
+    size_t missCount;
+    size_t evictionCount;
 };
 
 } // namespace tigl
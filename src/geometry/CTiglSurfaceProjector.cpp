@@ -0,0 +1,252 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "CTiglSurfaceProjector.h"
+#include "CTiglError.h"
+
+#include <GeomAPI_ProjectPointOnSurf.hxx>
+#include <Precision.hxx>
+#include <gp_Vec.hxx>
+
+#include <boost/thread/lock_guard.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace tigl
+{
+
+namespace
+{
+    // number of grid samples used as start values of the Newton iteration
+    const size_t kNumberOfSeeds = 3;
+    const int kMaxIterations = 50;
+    // convergence tolerance of the newton step in 3D space
+    const double kStepTolerance = 1e-10;
+    // maximum tangential component of the distance vector of an orthogonal projection
+    const double kOrthogonalityTolerance = 1e-7;
+}
+
+CTiglSurfaceProjector::CTiglSurfaceProjector(const Handle(Geom_Surface)& surface, int nu, int nv)
+{
+    Init(surface, nu, nv);
+}
+
+void CTiglSurfaceProjector::Init(const Handle(Geom_Surface)& surface, int nu, int nv)
+{
+    if (surface.IsNull()) {
+        throw CTiglError("Null surface in CTiglSurfaceProjector::Init", TIGL_NULL_POINTER);
+    }
+    if (nu < 2 || nv < 2) {
+        throw CTiglError("At least 2x2 samples are required in CTiglSurfaceProjector::Init", TIGL_ERROR);
+    }
+
+    m_surface = surface;
+    m_exactProjectors = std::make_shared<ExactProjectorPool>();
+    m_us.clear();
+    m_vs.clear();
+    m_samples.clear();
+
+    m_surface->Bounds(m_umin, m_umax, m_vmin, m_vmax);
+    if (Precision::IsInfinite(m_umin) || Precision::IsInfinite(m_umax) ||
+        Precision::IsInfinite(m_vmin) || Precision::IsInfinite(m_vmax)) {
+        // no sampling possible, always use GeomAPI_ProjectPointOnSurf
+        return;
+    }
+
+    for (int i = 0; i < nu; ++i) {
+        m_us.push_back(m_umin + (m_umax - m_umin) * static_cast<double>(i) / static_cast<double>(nu - 1));
+    }
+    for (int j = 0; j < nv; ++j) {
+        m_vs.push_back(m_vmin + (m_vmax - m_vmin) * static_cast<double>(j) / static_cast<double>(nv - 1));
+    }
+
+    m_samples.reserve(m_us.size() * m_vs.size());
+    for (double u : m_us) {
+        for (double v : m_vs) {
+            m_samples.push_back(m_surface->Value(u, v));
+        }
+    }
+}
+
+const Handle(Geom_Surface)& CTiglSurfaceProjector::Surface() const
+{
+    return m_surface;
+}
+
+bool CTiglSurfaceProjector::Project(const gp_Pnt& point, double& u, double& v, double& distance) const
+{
+    if (m_surface.IsNull()) {
+        throw CTiglError("CTiglSurfaceProjector is not initialized", TIGL_NOT_FOUND);
+    }
+
+    if (m_samples.empty()) {
+        return ProjectExact(point, u, v, distance);
+    }
+
+    // find the closest samples
+    std::vector<std::pair<double, size_t>> seeds;
+    seeds.reserve(m_samples.size());
+    for (size_t i = 0; i < m_samples.size(); ++i) {
+        seeds.push_back(std::make_pair(m_samples[i].SquareDistance(point), i));
+    }
+    size_t nSeeds = std::min(kNumberOfSeeds, seeds.size());
+    std::partial_sort(seeds.begin(), seeds.begin() + nSeeds, seeds.end());
+
+    double bestDistance = std::numeric_limits<double>::max();
+    for (size_t iseed = 0; iseed < nSeeds; ++iseed) {
+        size_t index = seeds[iseed].second;
+        double us = m_us[index / m_vs.size()];
+        double vs = m_vs[index % m_vs.size()];
+        if (!Refine(point, us, vs)) {
+            return ProjectExact(point, u, v, distance);
+        }
+
+        // A minimum stuck at the parameter bounds is no projection in the sense of
+        // GeomAPI_ProjectPointOnSurf. Skip it, but an orthogonal projection might still exist.
+        if (!IsOrthogonal(point, us, vs)) {
+            continue;
+        }
+
+        double d = m_surface->Value(us, vs).Distance(point);
+        if (d < bestDistance) {
+            bestDistance = d;
+            u = us;
+            v = vs;
+        }
+    }
+
+    if (bestDistance == std::numeric_limits<double>::max()) {
+        return ProjectExact(point, u, v, distance);
+    }
+
+    distance = bestDistance;
+    return true;
+}
+
+bool CTiglSurfaceProjector::IsOrthogonal(const gp_Pnt& point, double u, double v) const
+{
+    gp_Pnt p;
+    gp_Vec su, sv;
+    m_surface->D1(u, v, p, su, sv);
+    gp_Vec r(point, p);
+
+    double su2 = su.SquareMagnitude();
+    double sv2 = sv.SquareMagnitude();
+    if (su2 > 0. && std::abs(r.Dot(su)) > kOrthogonalityTolerance * std::sqrt(su2)) {
+        return false;
+    }
+    if (sv2 > 0. && std::abs(r.Dot(sv)) > kOrthogonalityTolerance * std::sqrt(sv2)) {
+        return false;
+    }
+    return true;
+}
+
+bool CTiglSurfaceProjector::Refine(const gp_Pnt& point, double& u, double& v) const
+{
+    // Newton iteration on the squared distance, limited to the parameter bounds
+    gp_Pnt p;
+    gp_Vec su, sv, suu, svv, suv;
+    for (int iter = 0; iter < kMaxIterations; ++iter) {
+        m_surface->D2(u, v, p, su, sv, suu, svv, suv);
+        gp_Vec r(point, p);
+
+        double gu = r.Dot(su);
+        double gv = r.Dot(sv);
+        double huu = su.Dot(su) + r.Dot(suu);
+        double huv = su.Dot(sv) + r.Dot(suv);
+        double hvv = sv.Dot(sv) + r.Dot(svv);
+        double det = huu*hvv - huv*huv;
+        if (huu <= 0. || det <= 0.) {
+            // hessian not positive definite, use the Gauss-Newton approximation
+            huu = su.Dot(su);
+            huv = su.Dot(sv);
+            hvv = sv.Dot(sv);
+            det = huu*hvv - huv*huv;
+        }
+        if (det <= std::numeric_limits<double>::epsilon() * huu * hvv) {
+            // degenerated surface
+            return false;
+        }
+
+        double du = -(hvv*gu - huv*gv) / det;
+        double dv = -(huu*gv - huv*gu) / det;
+
+        // keep the parameters fixed at the bounds, if the step points outside
+        bool fixU = (u <= m_umin && du < 0.) || (u >= m_umax && du > 0.);
+        bool fixV = (v <= m_vmin && dv < 0.) || (v >= m_vmax && dv > 0.);
+        if (fixU && fixV) {
+            return true;
+        }
+        else if (fixU) {
+            du = 0.;
+            dv = -gv / (hvv > 0. ? hvv : sv.Dot(sv));
+        }
+        else if (fixV) {
+            dv = 0.;
+            du = -gu / (huu > 0. ? huu : su.Dot(su));
+        }
+
+        double un = std::min(std::max(u + du, m_umin), m_umax);
+        double vn = std::min(std::max(v + dv, m_vmin), m_vmax);
+
+        // damp the step, if the distance increases
+        double dist2 = r.SquareMagnitude();
+        for (int idamp = 0; idamp < 10 && m_surface->Value(un, vn).SquareDistance(point) > dist2; ++idamp) {
+            un = 0.5 * (u + un);
+            vn = 0.5 * (v + vn);
+        }
+
+        double step = (su * (un - u) + sv * (vn - v)).Magnitude();
+        u = un;
+        v = vn;
+        if (step < kStepTolerance) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool CTiglSurfaceProjector::ProjectExact(const gp_Pnt& point, double& u, double& v, double& distance) const
+{
+    std::unique_ptr<GeomAPI_ProjectPointOnSurf> proj;
+    {
+        boost::lock_guard<boost::mutex> guard(m_exactProjectors->mutex);
+        if (!m_exactProjectors->projectors.empty()) {
+            proj = std::move(m_exactProjectors->projectors.back());
+            m_exactProjectors->projectors.pop_back();
+        }
+    }
+    if (!proj) {
+        // the sampling of the surface is done once per instance
+        proj.reset(new GeomAPI_ProjectPointOnSurf());
+        proj->Init(m_surface, m_umin, m_umax, m_vmin, m_vmax);
+    }
+
+    proj->Perform(point);
+    bool found = proj->NbPoints() > 0;
+    if (found) {
+        proj->LowerDistanceParameters(u, v);
+        distance = proj->LowerDistance();
+    }
+
+    boost::lock_guard<boost::mutex> guard(m_exactProjectors->mutex);
+    m_exactProjectors->projectors.push_back(std::move(proj));
+    return found;
+}
+
+} // namespace tigl
@@ -0,0 +1,90 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @brief Reusable projection of points onto a bounded surface.
+ *
+ * In contrast to GeomAPI_ProjectPointOnSurf, the sampling grid of the surface
+ * is computed only once when the projector is initialized. Each projection
+ * starts a Newton iteration from the closest grid samples and returns the
+ * closest orthogonal projection found within the parameter bounds of the surface.
+ * As with GeomAPI_ProjectPointOnSurf, points beyond the surface boundaries
+ * without an orthogonal projection are not clamped onto the boundary, i.e.
+ * no projection is returned for them. If the iteration does not converge
+ * or ends on the boundary, GeomAPI_ProjectPointOnSurf is used instead.
+ * Its instances are initialized once and reused for subsequent projections.
+ *
+ * Project is thread-safe.
+ */
+
+#ifndef CTIGLSURFACEPROJECTOR_H
+#define CTIGLSURFACEPROJECTOR_H
+
+#include "tigl_internal.h"
+
+#include <Geom_Surface.hxx>
+#include <GeomAPI_ProjectPointOnSurf.hxx>
+#include <gp_Pnt.hxx>
+
+#include <boost/thread/mutex.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace tigl
+{
+
+class CTiglSurfaceProjector
+{
+public:
+    TIGL_EXPORT CTiglSurfaceProjector() = default;
+
+    TIGL_EXPORT explicit CTiglSurfaceProjector(const Handle(Geom_Surface)& surface, int nu = 16, int nv = 16);
+
+    /// Samples the surface on a grid of nu x nv points
+    TIGL_EXPORT void Init(const Handle(Geom_Surface)& surface, int nu = 16, int nv = 16);
+
+    /// Returns the surface, the projector was initialized with
+    TIGL_EXPORT const Handle(Geom_Surface)& Surface() const;
+
+    /// Projects the point onto the surface. Returns false, if no orthogonal projection exists.
+    /// Otherwise, u and v are the parameters of the projected point and distance is
+    /// the distance between the point and the surface.
+    TIGL_EXPORT bool Project(const gp_Pnt& point, double& u, double& v, double& distance) const;
+
+private:
+    bool Refine(const gp_Pnt& point, double& u, double& v) const;
+    bool IsOrthogonal(const gp_Pnt& point, double u, double v) const;
+    bool ProjectExact(const gp_Pnt& point, double& u, double& v, double& distance) const;
+
+    // GeomAPI_ProjectPointOnSurf is not thread-safe. Each concurrent projection takes
+    // an instance out of the pool and returns it afterwards.
+    struct ExactProjectorPool
+    {
+        boost::mutex mutex;
+        std::vector<std::unique_ptr<GeomAPI_ProjectPointOnSurf>> projectors;
+    };
+
+    Handle(Geom_Surface) m_surface;
+    std::shared_ptr<ExactProjectorPool> m_exactProjectors;
+    double m_umin = 0., m_umax = 0., m_vmin = 0., m_vmax = 0.;
+    std::vector<double> m_us, m_vs;
+    std::vector<gp_Pnt> m_samples; // row major, m_us.size() x m_vs.size()
+};
+
+} // namespace tigl
+
+#endif // CTIGLSURFACEPROJECTOR_H
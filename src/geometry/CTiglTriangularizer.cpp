@@ -24,6 +24,8 @@
 #include "CCPACSConfiguration.h"
 #include "CTiglFusePlane.h"
 #include "CNamedShape.h"
+#include "tiglparallel.h"
+#include "CTiglMeshSimplifier.h"
 
 #include <TopoDS.hxx>
 #include <TopoDS_Shape.hxx>
@@ -37,6 +39,7 @@
 #include <BRepGProp_Face.hxx>
 #include <BRepMesh_IncrementalMesh.hxx>
 #include <BRepTools.hxx>
+#include <IMeshTools_Parameters.hxx>
 
 #include <gp_Pnt.hxx>
 #include <gp_Pnt2d.hxx>
@@ -44,7 +47,10 @@
 #include <TColgp_Array1OfPnt2d.hxx>
 #include <TopTools_IndexedMapOfShape.hxx>
 #include <TopExp.hxx>
+#include <algorithm>
 #include <climits>
+#include <sstream>
+#include <utility>
 
 namespace 
 {
@@ -68,8 +74,32 @@ namespace
 namespace tigl
 {
 
-CTiglTriangularizer::CTiglTriangularizer(PNamedShape pshape, double deflection, bool computeNormals)
+struct CTiglTriangularizer::FaceMesh
+{
+    FaceMesh() : hasTriangulation(false) {}
+
+    bool hasTriangulation;
+    std::vector<CTiglPoint> points;
+    std::vector<CTiglPoint> normals;
+    // three node indices per triangle, already oriented
+    std::vector<int> triangles;
+};
+
+struct CTiglTriangularizer::PolyMeta
+{
+    PolyMeta() : isUpper(0.), segmentIndex(0.), eta(0.), xsi(0.) {}
+
+    double isUpper;
+    double segmentIndex;
+    double eta;
+    double xsi;
+    std::string metadata;
+};
+
+CTiglTriangularizer::CTiglTriangularizer(PNamedShape pshape, double deflection, bool computeNormals, bool parallel)
     : m_computeNormals(computeNormals)
+    , m_parallel(parallel)
+    , m_deflection(deflection)
 {
     if (!pshape) {
         throw CTiglError("Null pointer shape in CTiglTriangularizer", TIGL_NULL_POINTER);
@@ -78,8 +108,10 @@ CTiglTriangularizer::CTiglTriangularizer(PNamedShape pshape, double deflection,
     triangularizeComponent(NULL, pshape, deflection, NO_INFO);
 }
 
-CTiglTriangularizer::CTiglTriangularizer(const CTiglUIDManager* uidMgr, PNamedShape shape, double deflection, ComponentTraingMode mode, bool computeNormals)
+CTiglTriangularizer::CTiglTriangularizer(const CTiglUIDManager* uidMgr, PNamedShape shape, double deflection, ComponentTraingMode mode, bool computeNormals, bool parallel)
     : m_computeNormals(computeNormals)
+    , m_parallel(parallel)
+    , m_deflection(deflection)
 {
     if (!shape) {
         throw CTiglError("Null pointer shape in CTiglTriangularizer", TIGL_NULL_POINTER);
@@ -100,25 +132,21 @@ bool isValidCoord(double c)
     }
 }
 
-void CTiglTriangularizer::writeFaceDummyMeta(unsigned long iPolyLower, unsigned long iPolyUpper)
+void CTiglTriangularizer::computeFaceDummyMeta(std::vector<PolyMeta>& meta) const
 {
-    for (unsigned int iPoly = iPolyLower; iPoly <= iPolyUpper; iPoly++) {
-        polys.currentObject().setPolyDataReal(iPoly, "is_upper", 0.);
-        polys.currentObject().setPolyDataReal(iPoly, "segment_index", 0.);
-        polys.currentObject().setPolyDataReal(iPoly, "eta", 0.);
-        polys.currentObject().setPolyDataReal(iPoly, "xsi", 0.);
-
-        polys.currentObject().setPolyMetadata(iPoly,"\"\" 0 0.0 0.0 0");
+    for (PolyMeta& polyMeta : meta) {
+        polyMeta = PolyMeta();
+        polyMeta.metadata = "\"\" 0 0.0 0.0 0";
     }
 }
 
-bool CTiglTriangularizer::writeWingMeta(ITiglGeometricComponent& wingComponent, const CFaceTraits& traits, gp_Pnt centralP, unsigned long iPolyLower, unsigned long iPolyUpper)
+bool CTiglTriangularizer::computeWingMeta(ITiglGeometricComponent& wingComponent, const CFaceTraits& traits, gp_Pnt centralP, unsigned long iPolyLower, std::vector<PolyMeta>& meta) const
 {
     if (wingComponent.GetComponentType() == TIGL_COMPONENT_WING) {
         CCPACSWing& wing = dynamic_cast<CCPACSWing&>(wingComponent);
         for (int iSegment = 1 ; iSegment <= wing.GetSegmentCount(); ++iSegment) {
             CCPACSWingSegment& segment = (CCPACSWingSegment&) wing.GetSegment(iSegment);
-            if (writeWingSegmentMeta(segment, traits, centralP, iPolyLower, iPolyUpper)) {
+            if (computeWingSegmentMeta(segment, traits, centralP, iPolyLower, meta)) {
                 return true;
             }
         }
@@ -127,15 +155,16 @@ bool CTiglTriangularizer::writeWingMeta(ITiglGeometricComponent& wingComponent,
     return false;
 }
 
-void CTiglTriangularizer::writeFaceMeta(const CTiglUIDManager* uidMgr,  const CFaceTraits& traits, const std::string& componentUID,
-                                        TopoDS_Face face, unsigned long iPolyLower, unsigned long iPolyUpper)
+void CTiglTriangularizer::computeFaceMeta(const CTiglUIDManager* uidMgr,  const CFaceTraits& traits, const std::string& componentUID,
+                                          const TopoDS_Face& face, unsigned long iPolyLower, std::vector<PolyMeta>& meta) const
 {
     if (!uidMgr) {
+        meta.clear();
         return;
     }
 
     if (componentUID.empty()) {
-        writeFaceDummyMeta(iPolyLower, iPolyUpper);
+        computeFaceDummyMeta(meta);
         return;
     }
 
@@ -152,18 +181,31 @@ void CTiglTriangularizer::writeFaceMeta(const CTiglUIDManager* uidMgr,  const CF
 
     try {
         ITiglGeometricComponent& component = uidMgr->GetGeometricComponent(componentUID);
-        if (writeWingMeta(component, traits, centralP, iPolyLower, iPolyUpper)) {
+        if (computeWingMeta(component, traits, centralP, iPolyLower, meta)) {
             return;
         }
         
-        if (writeWingSegmentMeta(component, traits, centralP, iPolyLower, iPolyUpper)) {
+        if (computeWingSegmentMeta(component, traits, centralP, iPolyLower, meta)) {
             return;
         }
     }
     catch(CTiglError&) {
         // uid is not a component. do nothing
     }
-    writeFaceDummyMeta(iPolyLower, iPolyUpper);
+    computeFaceDummyMeta(meta);
+}
+
+void CTiglTriangularizer::writeMeta(unsigned long iPolyLower, const std::vector<PolyMeta>& meta)
+{
+    CTiglPolyObject& object = polys.currentObject();
+    for (unsigned long i = 0; i < meta.size(); ++i) {
+        unsigned long iPoly = iPolyLower + i;
+        object.setPolyDataReal(iPoly, "is_upper", meta[i].isUpper);
+        object.setPolyDataReal(iPoly, "segment_index", meta[i].segmentIndex);
+        object.setPolyDataReal(iPoly, "eta", meta[i].eta);
+        object.setPolyDataReal(iPoly, "xsi", meta[i].xsi);
+        object.setPolyMetadata(iPoly, meta[i].metadata.c_str());
+    }
 }
 
 int CTiglTriangularizer::triangularizeComponent(const CTiglUIDManager* uidMgr, PNamedShape pshape, double deflection, ComponentTraingMode mode)
@@ -174,39 +216,91 @@ int CTiglTriangularizer::triangularizeComponent(const CTiglUIDManager* uidMgr, P
 
     TopoDS_Shape shape = pshape->Shape();
     BRepTools::Clean (shape);
-    BRepMesh_IncrementalMesh(shape, deflection);
+
+    IMeshTools_Parameters meshParams;
+    meshParams.Deflection = deflection;
+    meshParams.Angle = 0.5;
+    meshParams.InParallel = m_parallel;
+    BRepMesh_IncrementalMesh(shape, meshParams);
     LOG(INFO) << "Done meshing";
 
     polys.currentObject().enableNormals(m_computeNormals);
 
     TopTools_IndexedMapOfShape faceMap;
     TopExp::MapShapes(shape, TopAbs_FACE, faceMap);
-    for (int iface = 1; iface <= faceMap.Extent(); ++iface) {
-        TopoDS_Face face = TopoDS::Face(faceMap(iface));
-        std::string componentUID = pshape->GetFaceTraits(iface-1).ComponentUID();
-        unsigned long nVertices, iPolyLower, iPolyUpper;
-        CFaceTraits faceTraits = pshape->GetFaceTraits(iface-1);
-        triangularizeFace(face, nVertices, iPolyLower, iPolyUpper);
-
-        if (nVertices > 0 && mode ==  SEGMENT_INFO) {
-            // write face metadata
-            writeFaceMeta(uidMgr, faceTraits, componentUID, face, iPolyLower, iPolyUpper);
+    const int nFaces = faceMap.Extent();
+
+    // the faces are extracted concurrently, but merged in face order
+    // to get the same vertex and polygon numbering as in a serial run
+    std::vector<FaceMesh> faceMeshes(nFaces);
+    ParallelFor(0, nFaces, [&](int i) {
+        triangularizeFace(TopoDS::Face(faceMap(i + 1)), faceMeshes[i]);
+    }, m_parallel);
+
+    std::vector<unsigned long> nVertices(nFaces), iPolyLower(nFaces), iPolyUpper(nFaces);
+    for (int i = 0; i < nFaces; ++i) {
+        mergeFace(faceMeshes[i], nVertices[i], iPolyLower[i], iPolyUpper[i]);
+        m_polygonFaces.resize(polys.currentObject().getNPolygons(), static_cast<unsigned int>(i));
+        // free the memory early
+        faceMeshes[i] = FaceMesh();
+    }
+
+    if (mode != SEGMENT_INFO) {
+        return TIGL_SUCCESS;
+    }
+
+    // the polygon data are only read here, the metadata are written afterwards
+    std::vector<std::vector<PolyMeta> > faceMeta(nFaces);
+    ParallelFor(0, nFaces, [&](int i) {
+        if (nVertices[i] == 0 || iPolyLower[i] > iPolyUpper[i]) {
+            return;
         }
+        std::string componentUID = pshape->GetFaceTraits(i).ComponentUID();
+        faceMeta[i].resize(iPolyUpper[i] - iPolyLower[i] + 1);
+        computeFaceMeta(uidMgr, pshape->GetFaceTraits(i), componentUID, TopoDS::Face(faceMap(i + 1)), iPolyLower[i], faceMeta[i]);
+    }, m_parallel);
+
+    for (int i = 0; i < nFaces; ++i) {
+        writeMeta(iPolyLower[i], faceMeta[i]);
     }
 
     return TIGL_SUCCESS;
 }
 
 
+std::vector<std::shared_ptr<CTiglPolyData> > CTiglTriangularizer::computeLevelsOfDetail(const std::vector<double>& deflections) const
+{
+    if (!std::is_sorted(deflections.begin(), deflections.end())) {
+        throw CTiglError("The deflections of the levels of detail must be in ascending order", TIGL_ERROR);
+    }
+
+    const CTiglPolyObject& mesh = polys.getObject(1);
+    CTiglMeshSimplifier simplifier(mesh, m_polygonFaces);
+
+    std::vector<std::shared_ptr<CTiglPolyData> > levels;
+    for (double deflection : deflections) {
+        // the triangulation already deviates up to m_deflection from the shape
+        simplifier.Simplify(std::max(0., deflection - m_deflection));
+
+        std::shared_ptr<CTiglPolyData> level = std::make_shared<CTiglPolyData>();
+        simplifier.GetMesh(level->currentObject());
+        levels.push_back(level);
+
+        LOG(INFO) << "Level of detail with deflection " << deflection << ": "
+                  << simplifier.GetNTriangles() << " of " << mesh.getNPolygons() << " triangles";
+    }
+    return levels;
+}
+
 /**
- * @brief CTiglTriangularizer::annotateWingSegment Determines for polys in range iPolyLower...iPolyUpper the segment information, including segment index,
+ * @brief CTiglTriangularizer::computeWingSegmentMeta Determines for the polys starting at iPolyLower the segment information, including segment index,
  * eta/xsi coordinates and if the point is on the upper or lower side of the wing segment.
  * @param segment All polygons must lie on the specified segment, else we will get wrong data.
  * @param centralP A point on the face of the segment. Is used to determine if the face in an upper or lower face.
  * @param iPolyLower Lower index of the polygons to annotate.
- * @param iPolyUpper Upper index of the polygons to annotate.
+ * @param meta Receives the data of the polygons iPolyLower ... iPolyLower + meta.size() - 1
  */
-bool CTiglTriangularizer::writeWingSegmentMeta(tigl::ITiglGeometricComponent &segmentComponent, const CFaceTraits& traits,  gp_Pnt pointOnSegmentFace, unsigned long iPolyLower, unsigned long iPolyUpper)
+bool CTiglTriangularizer::computeWingSegmentMeta(tigl::ITiglGeometricComponent &segmentComponent, const CFaceTraits& traits,  gp_Pnt pointOnSegmentFace, unsigned long iPolyLower, std::vector<PolyMeta>& meta) const
 {
     if (!(segmentComponent.GetComponentType() == TIGL_COMPONENT_WINGSEGMENT)) {
         return false;
@@ -237,16 +331,18 @@ bool CTiglTriangularizer::writeWingSegmentMeta(tigl::ITiglGeometricComponent &se
     // GetIsOnTop is very slow, therefore we do it only once per face 
     bool isUpperFace = segment.GetIsOnTop(pointOnSegmentFace);
     
-    for (unsigned long iPoly = iPolyLower; iPoly <= iPolyUpper; iPoly++) {
-        polys.currentObject().setPolyDataReal(iPoly, "is_upper", (double) isUpperFace);
-        polys.currentObject().setPolyDataReal(iPoly, "segment_index", (double) segment.GetSegmentIndex());
+    const CTiglPolyObject& object = polys.currentObject();
+    for (unsigned long i = 0; i < meta.size(); i++) {
+        unsigned long iPoly = iPolyLower + i;
+        meta[i].isUpper = (double) isUpperFace;
+        meta[i].segmentIndex = (double) segment.GetSegmentIndex();
         
-        unsigned long npoints = polys.currentObject().getNPointsOfPolygon(iPoly);
+        unsigned long npoints = object.getNPointsOfPolygon(iPoly);
         
         CTiglPoint baryCenter(0.,0.,0.);
         for (unsigned long jPoint = 0; jPoint < npoints; ++jPoint) {
-            unsigned long index = polys.currentObject().getVertexIndexOfPolygon(jPoint, iPoly);
-            baryCenter += polys.currentObject().getVertexPoint(index);
+            unsigned long index = object.getVertexIndexOfPolygon(jPoint, iPoly);
+            baryCenter += object.getVertexPoint(index);
         }
         baryCenter = baryCenter*(double)(1./(double)npoints);
         baryCenter = CTiglPoint(inverseTrafo.Transform(baryCenter.Get_gp_Pnt()).XYZ());
@@ -257,8 +353,8 @@ bool CTiglTriangularizer::writeWingSegmentMeta(tigl::ITiglGeometricComponent &se
         double eta = 0., xsi = 0.;
         gp_Pnt pDummy;
         segment.GetEtaXsi(baryCenter.Get_gp_Pnt(), eta, xsi, pDummy, onLinearLoft);
-        polys.currentObject().setPolyDataReal(iPoly, "eta", eta);
-        polys.currentObject().setPolyDataReal(iPoly, "xsi", xsi);
+        meta[i].eta = eta;
+        meta[i].xsi = xsi;
         
         // create metadata string
         std::stringstream stream;
@@ -267,36 +363,31 @@ bool CTiglTriangularizer::writeWingSegmentMeta(tigl::ITiglGeometricComponent &se
             symm = "_sym";
         }
         stream << "\"" << segment.GetUID() << symm << "\" " << segment.GetSegmentIndex() << " " << eta << " " << xsi << " " << isUpperFace;
-        polys.currentObject().setPolyMetadata(iPoly, stream.str().c_str());
+        meta[i].metadata = stream.str();
     }
     
     return true;
 }
 
-int CTiglTriangularizer::triangularizeFace(const TopoDS_Face & face, unsigned long &nVertices, unsigned long &iPolyLower, unsigned long &iPolyUpper)
+void CTiglTriangularizer::triangularizeFace(const TopoDS_Face & face, FaceMesh& mesh) const
 {
     TopLoc_Location location;
-    std::vector<unsigned long> indexBuffer;
-    nVertices = 0;
 
     const Handle(Poly_Triangulation) triangulation = BRep_Tool::Triangulation(face, location);
     if (triangulation.IsNull()) {
-        return 0;
+        return;
     }
+    mesh.hasTriangulation = true;
 
     gp_Trsf nodeTransformation = location;
 
-    unsigned long ilower = 0;
-    unsigned long iBufferSize = 0;
-    
+    mesh.points.reserve(triangulation->NbNodes());
+    mesh.normals.reserve(triangulation->NbNodes());
     if (triangulation->HasUVNodes() && m_computeNormals) {
         // we use the uv nodes to compute normal vectors for each point
         
         BRepGProp_Face prop(face);
         
-        ilower = 1;
-        iBufferSize = triangulation->NbNodes();
-        indexBuffer.reserve(iBufferSize);
         for (int inode = 1; inode <= triangulation->NbNodes(); ++inode) {
             const gp_Pnt2d& uv_pnt = triangulation->UVNode(inode);
             gp_Pnt p; gp_Vec n;
@@ -307,41 +398,60 @@ int CTiglTriangularizer::triangularizeFace(const TopoDS_Face & face, unsigned lo
             if (face.Orientation() == TopAbs_INTERNAL) {
                 n.Reverse();
             }
-            indexBuffer.push_back(polys.currentObject().addPointNormal(p.XYZ(), n.XYZ()));
+            mesh.points.push_back(p.XYZ());
+            mesh.normals.push_back(n.XYZ());
         }
     } 
     else {
         // we cannot compute normals
         
-        ilower = 1;
-        iBufferSize = triangulation->NbNodes();
-        indexBuffer.reserve(iBufferSize);
         for (int inode = 1; inode <= triangulation->NbNodes(); inode++) {
             const gp_Pnt& p = triangulation->Node(inode).Transformed(nodeTransformation);
-            indexBuffer.push_back(polys.currentObject().addPointNormal(p.XYZ(), CTiglPoint(1,0,0)));
+            mesh.points.push_back(p.XYZ());
+            mesh.normals.push_back(CTiglPoint(1,0,0));
         }
     }
 
-    iPolyLower = ULONG_MAX;
-    iPolyUpper = 0;
-    // iterate over triangles in the array
+    const bool reversed = face.Orientation() == TopAbs_REVERSED || face.Orientation() == TopAbs_INTERNAL;
+    mesh.triangles.reserve(3 * triangulation->NbTriangles());
     for (int j = 1; j <= triangulation->NbTriangles(); j++) {
         const Poly_Triangle& triangle = triangulation->Triangle(j);
         int occindex1, occindex2, occindex3;
         triangle.Get(occindex1, occindex2, occindex3); // get indices into index1..3
-        unsigned long index1, index2, index3;
-        index1 = indexBuffer[occindex1-ilower];
-        index2 = indexBuffer[occindex2-ilower];
-        index3 = indexBuffer[occindex3-ilower];
+        if (reversed) {
+            std::swap(occindex2, occindex3);
+        }
+        mesh.triangles.push_back(occindex1 - 1);
+        mesh.triangles.push_back(occindex2 - 1);
+        mesh.triangles.push_back(occindex3 - 1);
+    }
+}
+
+void CTiglTriangularizer::mergeFace(const FaceMesh& mesh, unsigned long &nVertices, unsigned long &iPolyLower, unsigned long &iPolyUpper)
+{
+    nVertices = 0;
+    iPolyLower = ULONG_MAX;
+    iPolyUpper = 0;
+    if (!mesh.hasTriangulation) {
+        return;
+    }
 
-        unsigned long iPolyIndex = 0;
+    CTiglPolyObject& object = polys.currentObject();
 
-        if (face.Orientation() != TopAbs_REVERSED && face.Orientation() != TopAbs_INTERNAL) {
-            iPolyIndex = polys.currentObject().addTriangleByVertexIndex(index1, index2, index3);
-        }
-        else {
-            iPolyIndex = polys.currentObject().addTriangleByVertexIndex(index1, index3, index2);
-        }
+    std::vector<unsigned long> indexBuffer;
+    indexBuffer.reserve(mesh.points.size());
+    for (size_t inode = 0; inode < mesh.points.size(); ++inode) {
+        indexBuffer.push_back(object.addPointNormal(mesh.points[inode], mesh.normals[inode]));
+    }
+
+    // iterate over triangles in the array
+    for (size_t j = 0; j + 2 < mesh.triangles.size(); j += 3) {
+        unsigned long index1, index2, index3;
+        index1 = indexBuffer[mesh.triangles[j]];
+        index2 = indexBuffer[mesh.triangles[j+1]];
+        index3 = indexBuffer[mesh.triangles[j+2]];
+
+        unsigned long iPolyIndex = object.addTriangleByVertexIndex(index1, index2, index3);
 
         // In some rare cases, 2 indices are the same
         // which means, that we dont have a true triangle.
@@ -359,8 +469,7 @@ int CTiglTriangularizer::triangularizeFace(const TopoDS_Face & face, unsigned lo
         
     } // for triangles
 
-    nVertices = iBufferSize;
-    return 0;
+    nVertices = static_cast<unsigned long>(mesh.points.size());
 }
 
 } // namespace tigl
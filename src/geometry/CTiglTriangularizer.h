@@ -22,6 +22,7 @@
 #ifndef CTIGLTRIANGULARIZER_H
 #define CTIGLTRIANGULARIZER_H
 
+#include <memory>
 #include <vector>
 #include "tigl_internal.h"
 #include "CTiglPolyData.h"
@@ -50,28 +51,63 @@ enum ComponentTraingMode
 class CTiglTriangularizer
 {
 public:
-    TIGL_EXPORT CTiglTriangularizer(PNamedShape shape, double deflection, bool computeNormals = true);
+    /**
+     * @brief Triangulates the shape and stores the triangles in a CTiglPolyData object.
+     *
+     * If parallel is true, the faces are meshed and extracted concurrently. The result is
+     * identical to the serial run, as the face triangulations are merged in face order.
+     */
+    TIGL_EXPORT CTiglTriangularizer(PNamedShape shape, double deflection, bool computeNormals = true, bool parallel = true);
 
     TIGL_EXPORT CTiglTriangularizer(const CTiglUIDManager* uidMgr, PNamedShape shape, double deflection,
-                                    ComponentTraingMode mode = NO_INFO, bool computeNormals = true);
+                                    ComponentTraingMode mode = NO_INFO, bool computeNormals = true, bool parallel = true);
 
     const CTiglPolyData& getTriangulation() const
     {
         return polys;
     }
 
+    /**
+     * @brief Derives coarser levels of detail from the triangulation by edge collapses,
+     * instead of meshing the shape again.
+     *
+     * The face boundaries of the shape are preserved in all levels.
+     *
+     * @param deflections The deflections of the levels in ascending order. Levels with
+     * a deflection below the deflection of the triangulation equal the triangulation.
+     */
+    TIGL_EXPORT std::vector<std::shared_ptr<CTiglPolyData> > computeLevelsOfDetail(const std::vector<double>& deflections) const;
+
+    /// Returns the index of the face of each polygon in the triangulation
+    const std::vector<unsigned int>& getPolygonFaces() const
+    {
+        return m_polygonFaces;
+    }
+
 private:
+    // triangulation of a single face, before it is merged into the polygon data
+    struct FaceMesh;
+
+    // data of a single polygon, that are computed in SEGMENT_INFO mode
+    struct PolyMeta;
+
     int triangularizeComponent(const CTiglUIDManager* uidMgr, PNamedShape shape, double deflection, ComponentTraingMode = NO_INFO);
-    int triangularizeFace(const TopoDS_Face&, unsigned long& nVertices, unsigned long& iPolyLow, unsigned long& iPolyUp);
+    void triangularizeFace(const TopoDS_Face&, FaceMesh& mesh) const;
+    void mergeFace(const FaceMesh& mesh, unsigned long& nVertices, unsigned long& iPolyLow, unsigned long& iPolyUp);
 
-    void writeFaceDummyMeta(unsigned long iPolyLower, unsigned long iPolyUpper);
-    bool writeWingMeta(ITiglGeometricComponent& wing, const CFaceTraits &traits, gp_Pnt centralP, unsigned long iPolyLower, unsigned long iPolyUpper);
-    bool writeWingSegmentMeta(ITiglGeometricComponent& segment, const CFaceTraits &traits, gp_Pnt centralP, unsigned long iPolyLower, unsigned long iPolyUpper);
+    void computeFaceDummyMeta(std::vector<PolyMeta>& meta) const;
+    bool computeWingMeta(ITiglGeometricComponent& wing, const CFaceTraits &traits, gp_Pnt centralP, unsigned long iPolyLower, std::vector<PolyMeta>& meta) const;
+    bool computeWingSegmentMeta(ITiglGeometricComponent& segment, const CFaceTraits &traits, gp_Pnt centralP, unsigned long iPolyLower, std::vector<PolyMeta>& meta) const;
+    void computeFaceMeta(const CTiglUIDManager* uidMgr, const CFaceTraits& traits, const std::string& componentUID, const TopoDS_Face& face,
+                         unsigned long iPolyLower, std::vector<PolyMeta>& meta) const;
+    void writeMeta(unsigned long iPolyLower, const std::vector<PolyMeta>& meta);
 
     // some options
     bool m_computeNormals;
+    bool m_parallel;
+    double m_deflection;
     CTiglPolyData polys;
-    void writeFaceMeta(const CTiglUIDManager* uidMgr, const CFaceTraits& traits, const std::string& componentUID, TopoDS_Face face, unsigned long iPolyLower, unsigned long iPolyUpper);
+    std::vector<unsigned int> m_polygonFaces;
 };
 
 }
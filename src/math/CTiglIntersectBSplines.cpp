@@ -22,10 +22,14 @@
 
 #include <math_MultipleVarFunctionWithGradient.hxx>
 #include <math_FRPR.hxx>
+#include <GeomConvert_BSplineCurveToBezierCurve.hxx>
+#include <Geom_BezierCurve.hxx>
+#include <TColStd_Array1OfReal.hxx>
 
 #include <limits>
 #include <list>
 #include <algorithm>
+#include <cmath>
 
 #include <cassert>
 
@@ -97,6 +101,10 @@ namespace
             }
         }
         
+        BoundingBox(const tigl::CTiglPoint& l, const tigl::CTiglPoint& h, const Intervall& r)
+            : low(l), high(h), range(r)
+        {}
+
         bool Intersects(const BoundingBox& other, double eps) const
         {
             tigl::CTiglPoint min = maxCoords(low, other.low);
@@ -218,6 +226,304 @@ namespace
         return {};
     }
 
+    /// Rational Bezier segment of a B-spline in homogeneous coordinates (x*w, y*w, z*w, w)
+    class BezierSegment
+    {
+    public:
+        BezierSegment(const Handle(Geom_BezierCurve)& arc, double umin, double umax)
+            : m_degree(arc->Degree())
+            , m_poles(static_cast<size_t>(4 * (arc->Degree() + 1)))
+            , m_range(umin, umax)
+        {
+            for (int i = 0; i <= m_degree; ++i) {
+                double w = arc->Weight(i + 1);
+                gp_XYZ p = arc->Pole(i + 1).XYZ();
+                m_poles[4*i + 0] = p.X() * w;
+                m_poles[4*i + 1] = p.Y() * w;
+                m_poles[4*i + 2] = p.Z() * w;
+                m_poles[4*i + 3] = w;
+            }
+            ComputeBox();
+        }
+
+        int Degree() const
+        {
+            return m_degree;
+        }
+
+        const Intervall& Range() const
+        {
+            return m_range;
+        }
+
+        // The box coordinates are stored as (xmin, ymin, zmin, -xmax, -ymax, -zmax),
+        // such that the overlap test is a single loop over contiguous memory
+        const double* Box() const
+        {
+            return m_box;
+        }
+
+        gp_XYZ Pole(int i) const
+        {
+            const double* p = &m_poles[static_cast<size_t>(4*i)];
+            return gp_XYZ(p[0] / p[3], p[1] / p[3], p[2] / p[3]);
+        }
+
+        BoundingBox Hull() const
+        {
+            return BoundingBox(tigl::CTiglPoint(m_box[0], m_box[1], m_box[2]),
+                               tigl::CTiglPoint(-m_box[3], -m_box[4], -m_box[5]),
+                               m_range);
+        }
+
+        // Same measure as curvature(): length of the control polygon relative to the chord
+        double Curvature() const
+        {
+            double total = 0.;
+            for (int i = 0; i < m_degree; ++i) {
+                total += (Pole(i + 1) - Pole(i)).Modulus();
+            }
+            double len = (Pole(m_degree) - Pole(0)).Modulus();
+            if (len <= std::numeric_limits<double>::min()) {
+                // degenerated to a point or a closed loop
+                return total <= std::numeric_limits<double>::min() ? 1. : std::numeric_limits<double>::max();
+            }
+            return total / len;
+        }
+
+        /// Splits the segment at the parametric center using de Casteljau's algorithm
+        void Split(BezierSegment& left, BezierSegment& right) const
+        {
+            double mid = 0.5*(m_range.min + m_range.max);
+            left.m_degree = right.m_degree = m_degree;
+            left.m_range = Intervall(m_range.min, mid);
+            right.m_range = Intervall(mid, m_range.max);
+
+            std::vector<double> work(m_poles);
+            left.m_poles.resize(m_poles.size());
+            right.m_poles.resize(m_poles.size());
+            for (int k = 0; k <= m_degree; ++k) {
+                for (int c = 0; c < 4; ++c) {
+                    left.m_poles[4*k + c] = work[4*0 + c];
+                    right.m_poles[4*(m_degree - k) + c] = work[4*(m_degree - k) + c];
+                }
+                for (int i = 0; i < m_degree - k; ++i) {
+                    for (int c = 0; c < 4; ++c) {
+                        work[4*i + c] = 0.5*(work[4*i + c] + work[4*(i + 1) + c]);
+                    }
+                }
+            }
+            left.ComputeBox();
+            right.ComputeBox();
+        }
+
+        BezierSegment()
+            : m_degree(0)
+            , m_range(0., 0.)
+        {}
+
+    private:
+        void ComputeBox()
+        {
+            for (int c = 0; c < 6; ++c) {
+                m_box[c] = std::numeric_limits<double>::max();
+            }
+            for (int i = 0; i <= m_degree; ++i) {
+                gp_XYZ p = Pole(i);
+                m_box[0] = std::min(m_box[0], p.X());
+                m_box[1] = std::min(m_box[1], p.Y());
+                m_box[2] = std::min(m_box[2], p.Z());
+                m_box[3] = std::min(m_box[3], -p.X());
+                m_box[4] = std::min(m_box[4], -p.Y());
+                m_box[5] = std::min(m_box[5], -p.Z());
+            }
+        }
+
+        int m_degree;
+        std::vector<double> m_poles;
+        Intervall m_range;
+        double m_box[6];
+    };
+
+    // Same test as BoundingBox::Intersects. The loop is free of branches
+    // and can be vectorized by the compiler.
+    bool BoxesIntersect(const double* box1, const double* box2, double eps)
+    {
+        // overlap[k] = min(high1, high2) - max(low1, low2)
+        double overlap[3];
+        for (int k = 0; k < 3; ++k) {
+            overlap[k] = -std::max(box1[k + 3], box2[k + 3]) - std::max(box1[k], box2[k]);
+        }
+        return (overlap[0] > -eps) & (overlap[1] > -eps) & (overlap[2] > -eps);
+    }
+
+    void MergeBox(const double* box, double* result)
+    {
+        for (int k = 0; k < 6; ++k) {
+            result[k] = std::min(result[k], box[k]);
+        }
+    }
+
+    /// Bezier segments of a B-spline and a bounding box tree over their control polygons
+    class SegmentTree
+    {
+    public:
+        struct Node
+        {
+            double box[6];
+            int first, last;  // segments [first, last)
+            int left, right;  // child nodes, -1 for leaves
+        };
+
+        explicit SegmentTree(const Handle(Geom_BSplineCurve)& curve)
+        {
+            GeomConvert_BSplineCurveToBezierCurve converter(curve);
+            TColStd_Array1OfReal knots(1, converter.NbArcs() + 1);
+            converter.Knots(knots);
+            for (int i = 1; i <= converter.NbArcs(); ++i) {
+                m_segments.push_back(BezierSegment(converter.Arc(i), knots(i), knots(i + 1)));
+            }
+            m_nodes.reserve(2 * m_segments.size());
+            Build(0, static_cast<int>(m_segments.size()));
+        }
+
+        const Node& Root() const
+        {
+            return m_nodes[0];
+        }
+
+        const Node& Child(int index) const
+        {
+            return m_nodes[static_cast<size_t>(index)];
+        }
+
+        const BezierSegment& Segment(int index) const
+        {
+            return m_segments[static_cast<size_t>(index)];
+        }
+
+    private:
+        int Build(int first, int last)
+        {
+            int index = static_cast<int>(m_nodes.size());
+            m_nodes.push_back(Node());
+            Node node;
+            node.first = first;
+            node.last = last;
+            node.left = node.right = -1;
+            for (int k = 0; k < 6; ++k) {
+                node.box[k] = std::numeric_limits<double>::max();
+            }
+            for (int i = first; i < last; ++i) {
+                MergeBox(m_segments[static_cast<size_t>(i)].Box(), node.box);
+            }
+            if (last - first > 1) {
+                int mid = (first + last) / 2;
+                node.left = Build(first, mid);
+                node.right = Build(mid, last);
+            }
+            m_nodes[static_cast<size_t>(index)] = node;
+            return index;
+        }
+
+        std::vector<BezierSegment> m_segments;
+        std::vector<Node> m_nodes;
+    };
+
+    /// Pair of nearly linear segments, that might intersect each other
+    struct SegmentPair
+    {
+        SegmentPair(const BezierSegment& s1, const BezierSegment& s2)
+            : hulls(s1.Hull(), s2.Hull())
+        {
+            // closest points of the chords as initial guess for the Newton iteration
+            gp_XYZ p0 = s1.Pole(0), q0 = s2.Pole(0);
+            gp_XYZ d1 = s1.Pole(s1.Degree()) - p0;
+            gp_XYZ d2 = s2.Pole(s2.Degree()) - q0;
+            gp_XYZ r = p0 - q0;
+            double a = d1.SquareModulus(), b = d1.Dot(d2), c = d2.SquareModulus();
+            double d = d1.Dot(r), e = d2.Dot(r);
+            double denom = a*c - b*b;
+            double s = denom > 1e-14*a*c ? (b*e - c*d) / denom : 0.;
+            s = std::min(1., std::max(0., s));
+            double t = c > 0. ? (b*s + e) / c : 0.;
+            if (t < 0. || t > 1.) {
+                t = std::min(1., std::max(0., t));
+                s = a > 0. ? std::min(1., std::max(0., (b*t - d) / a)) : 0.;
+            }
+            u = s1.Range().min + s*(s1.Range().max - s1.Range().min);
+            v = s2.Range().min + t*(s2.Range().max - s2.Range().min);
+            chordDistance = (r + d1*s - d2*t).Modulus();
+        }
+
+        BoundingBoxPair hulls;
+        double u, v;
+        double chordDistance;
+    };
+
+    const int maxSubdivisionDepth = 60;
+
+    /// Subdivides two Bezier segments until they are almost linear, analogous to getRangesOfIntersection
+    void subdivideSegments(const BezierSegment& s1, const BezierSegment& s2, double tolerance, int depth, std::vector<SegmentPair>& result)
+    {
+        if (!BoxesIntersect(s1.Box(), s2.Box(), tolerance)) {
+            return;
+        }
+
+        const double max_curvature = 1.0005;
+        bool refine1 = s1.Curvature() > max_curvature && depth < maxSubdivisionDepth;
+        bool refine2 = s2.Curvature() > max_curvature && depth < maxSubdivisionDepth;
+
+        if (!refine1 && !refine2) {
+            result.push_back(SegmentPair(s1, s2));
+            return;
+        }
+
+        BezierSegment s11, s12, s21, s22;
+        if (refine1 && refine2) {
+            s1.Split(s11, s12);
+            s2.Split(s21, s22);
+            subdivideSegments(s11, s21, tolerance, depth + 1, result);
+            subdivideSegments(s11, s22, tolerance, depth + 1, result);
+            subdivideSegments(s12, s21, tolerance, depth + 1, result);
+            subdivideSegments(s12, s22, tolerance, depth + 1, result);
+        }
+        else if (refine1) {
+            s1.Split(s11, s12);
+            subdivideSegments(s11, s2, tolerance, depth + 1, result);
+            subdivideSegments(s12, s2, tolerance, depth + 1, result);
+        }
+        else {
+            s2.Split(s21, s22);
+            subdivideSegments(s1, s21, tolerance, depth + 1, result);
+            subdivideSegments(s1, s22, tolerance, depth + 1, result);
+        }
+    }
+
+    /// Traverses both segment trees and subdivides the pairs of segments with overlapping boxes
+    void intersectTrees(const SegmentTree& tree1, const SegmentTree::Node& n1,
+                        const SegmentTree& tree2, const SegmentTree::Node& n2,
+                        double tolerance, std::vector<SegmentPair>& result)
+    {
+        if (!BoxesIntersect(n1.box, n2.box, tolerance)) {
+            return;
+        }
+
+        bool leaf1 = n1.left < 0;
+        bool leaf2 = n2.left < 0;
+        if (leaf1 && leaf2) {
+            subdivideSegments(tree1.Segment(n1.first), tree2.Segment(n2.first), tolerance, 0, result);
+        }
+        else if (leaf2 || (!leaf1 && n1.last - n1.first >= n2.last - n2.first)) {
+            intersectTrees(tree1, tree1.Child(n1.left), tree2, n2, tolerance, result);
+            intersectTrees(tree1, tree1.Child(n1.right), tree2, n2, tolerance, result);
+        }
+        else {
+            intersectTrees(tree1, n1, tree2, tree2.Child(n2.left), tolerance, result);
+            intersectTrees(tree1, n1, tree2, tree2.Child(n2.right), tolerance, result);
+        }
+    }
+
     class CurveCurveDistanceObjective : public math_MultipleVarFunctionWithGradient
     {
     public:
@@ -311,65 +617,60 @@ namespace
     };
    
 
-} // namespace
 
-namespace tigl
-{
+    /// Merges the adjacent ranges of the hull pairs and combines them to intersection candidates
+    std::vector<BoundingBoxPair> intersectionCandidates(const std::list<BoundingBoxPair>& hulls, double tolerance)
+    {
+        std::list<BoundingBox> curve1_ints, curve2_ints;
+        for (const auto& hull : hulls) {
+            curve1_ints.push_back(hull.b1);
+            curve2_ints.push_back(hull.b2);
+        }
 
+        auto compare = [](const BoundingBox& b1, const BoundingBox& b2) {
+            return b1.range.min < b2.range.min;
+        };
 
-std::vector<tigl::CurveIntersectionResult> IntersectBSplines(const Handle(Geom_BSplineCurve) curve1, const Handle(Geom_BSplineCurve) curve2, double tolerance)
-{
-    auto hulls = getRangesOfIntersection(curve1, curve2, tolerance);
-    
-    std::list<BoundingBox> curve1_ints, curve2_ints;
-    for (const auto& hull : hulls) {
-        curve1_ints.push_back(hull.b1);
-        curve2_ints.push_back(hull.b2);
-    }
-    
-    auto compare = [](const BoundingBox& b1, const BoundingBox& b2) {
-        return b1.range.min < b2.range.min;
-    };
-    
-    // sort ascending parameter
-    curve1_ints.sort(compare);
-    curve2_ints.sort(compare);
+        // sort ascending parameter
+        curve1_ints.sort(compare);
+        curve2_ints.sort(compare);
 
-    // Remove duplicates
-    curve1_ints.unique();
-    curve2_ints.unique();
-    
-    auto is_adjacent = [](const BoundingBox& b1, const BoundingBox& b2) {
-        const double EPS = 1e-15;
-        return fabs(b1.range.max - b2.range.min) < EPS;
-    };
-    
-    auto merge_boxes = [](const BoundingBox& b1, const BoundingBox& b2) {
-        BoundingBox result(b1);
-        return result.Merge(b2);
-    };
-    
-    // merge neighboring intervals
-    ReplaceAdjacentWithMerged(curve1_ints, is_adjacent, merge_boxes);
-    ReplaceAdjacentWithMerged(curve2_ints, is_adjacent, merge_boxes);
-    
-    // combine intersection intervals
-    std::vector<BoundingBoxPair> intersectionCandidates;
-    for (const BoundingBox& b1 : curve1_ints) {
-        for (const BoundingBox& b2 : curve2_ints) {
-            if (b1.Intersects(b2, tolerance)) {
-                intersectionCandidates.push_back(BoundingBoxPair(b1, b2));
+        // Remove duplicates
+        curve1_ints.unique();
+        curve2_ints.unique();
+
+        auto is_adjacent = [](const BoundingBox& b1, const BoundingBox& b2) {
+            const double EPS = 1e-15;
+            return fabs(b1.range.max - b2.range.min) < EPS;
+        };
+
+        auto merge_boxes = [](const BoundingBox& b1, const BoundingBox& b2) {
+            BoundingBox result(b1);
+            return result.Merge(b2);
+        };
+
+        // merge neighboring intervals
+        ReplaceAdjacentWithMerged(curve1_ints, is_adjacent, merge_boxes);
+        ReplaceAdjacentWithMerged(curve2_ints, is_adjacent, merge_boxes);
+
+        // combine intersection intervals
+        std::vector<BoundingBoxPair> candidates;
+        for (const BoundingBox& b1 : curve1_ints) {
+            for (const BoundingBox& b2 : curve2_ints) {
+                if (b1.Intersects(b2, tolerance)) {
+                    candidates.push_back(BoundingBoxPair(b1, b2));
+                }
             }
         }
+        return candidates;
     }
 
-
-    std::vector<tigl::CurveIntersectionResult> results;
-
-    for (const BoundingBoxPair& boxes : intersectionCandidates) {
-
-        auto c1 = CTiglBSplineAlgorithms::trimCurve(curve1, boxes.b1.range.min,boxes.b1.range.max);
-        auto c2 = CTiglBSplineAlgorithms::trimCurve(curve2, boxes.b2.range.min,boxes.b2.range.max);
+    /// Minimizes the distance of the curves inside the candidate ranges with a conjugate gradient method
+    bool minimizeDistance(const Handle(Geom_BSplineCurve)& curve1, const Handle(Geom_BSplineCurve)& curve2,
+                          const BoundingBoxPair& boxes, double& u, double& v)
+    {
+        auto c1 = tigl::CTiglBSplineAlgorithms::trimCurve(curve1, boxes.b1.range.min,boxes.b1.range.max);
+        auto c2 = tigl::CTiglBSplineAlgorithms::trimCurve(curve2, boxes.b2.range.min,boxes.b2.range.max);
 
         CurveCurveDistanceObjective obj(c1, c2);
 
@@ -378,32 +679,145 @@ std::vector<tigl::CurveIntersectionResult> IntersectBSplines(const Handle(Geom_B
         guess(1) = 0.;
         guess(2) = 0.;
 
-
         math_FRPR optimizer(obj, 1e-10, 200);
         optimizer.Perform(obj, guess);
 
         if (!optimizer.IsDone()) {
             LOG(ERROR) << "Unable to compute exact intersection in `IntersectBSplines` due to failure in minimization. Please file a report";
-            continue;
+            return false;
         }
 
         // convert parameter space of optimized into u/v curve parameters
-        double u = obj.getUParam(optimizer.Location().Value(1));
-        double v = obj.getVParam(optimizer.Location().Value(2));
+        u = obj.getUParam(optimizer.Location().Value(1));
+        v = obj.getVParam(optimizer.Location().Value(2));
+        return true;
+    }
 
-        double distance = c1->Value(u).Distance(c2->Value(v));
-        if (distance < std::max(1e-10, tolerance)) {
-            CurveIntersectionResult result;
-            result.parmOnCurve1 = u;
-            result.parmOnCurve2 = v;
-            result.point = (CTiglPoint(curve1->Value(u).XYZ()) + CTiglPoint(curve2->Value(v).XYZ()))*0.5;
-            results.push_back(result);
+    /**
+     * Minimizes the squared distance of the curves with Newton's method, starting at (u, v).
+     * The parameters are clamped to the candidate ranges. Returns false, if the Hessian
+     * is not positive definite (e.g. for tangential curves) or the iteration does not converge.
+     */
+    bool newtonDistance(const Handle(Geom_BSplineCurve)& curve1, const Handle(Geom_BSplineCurve)& curve2,
+                        const BoundingBoxPair& boxes, double& u, double& v)
+    {
+        const Intervall& r1 = boxes.b1.range;
+        const Intervall& r2 = boxes.b2.range;
+        const double eps = 1e-14;
+
+        for (int iter = 0; iter < 30; ++iter) {
+            gp_Pnt p1, p2;
+            gp_Vec d1, d2, dd1, dd2;
+            curve1->D2(u, p1, d1, dd1);
+            curve2->D2(v, p2, d2, dd2);
+            gp_Vec diff(p2, p1);
+
+            // gradient and Hessian of 0.5*|c1(u) - c2(v)|^2
+            double g1 = diff.Dot(d1);
+            double g2 = -diff.Dot(d2);
+            double h11 = d1.Dot(d1) + diff.Dot(dd1);
+            double h22 = d2.Dot(d2) - diff.Dot(dd2);
+            double h12 = -d1.Dot(d2);
+            double det = h11*h22 - h12*h12;
+            if (h11 <= 0. || det <= eps*h11*h22) {
+                return false;
+            }
+
+            double unew = std::min(r1.max, std::max(r1.min, u - (h22*g1 - h12*g2) / det));
+            double vnew = std::min(r2.max, std::max(r2.min, v - (h11*g2 - h12*g1) / det));
+            bool converged = fabs(unew - u) <= eps*maxval(1., r1.max - r1.min) &&
+                             fabs(vnew - v) <= eps*maxval(1., r2.max - r2.min);
+            u = unew;
+            v = vnew;
+            if (converged) {
+                return true;
+            }
         }
+        return false;
     }
-    
+
+    tigl::CurveIntersectionResult makeResult(const Handle(Geom_BSplineCurve)& curve1, const Handle(Geom_BSplineCurve)& curve2, double u, double v)
+    {
+        tigl::CurveIntersectionResult result;
+        result.parmOnCurve1 = u;
+        result.parmOnCurve2 = v;
+        result.point = (tigl::CTiglPoint(curve1->Value(u).XYZ()) + tigl::CTiglPoint(curve2->Value(v).XYZ()))*0.5;
+        return result;
+    }
+
+} // namespace
+
+namespace tigl
+{
+
+
+std::vector<tigl::CurveIntersectionResult> IntersectBSplines(const Handle(Geom_BSplineCurve) curve1, const Handle(Geom_BSplineCurve) curve2, double tolerance)
+{
+    // subdivide the Bezier segments of both curves, pairs with disjoint
+    // control polygon boxes are pruned by the segment trees
+    SegmentTree tree1(curve1);
+    SegmentTree tree2(curve2);
+
+    std::vector<SegmentPair> segmentPairs;
+    intersectTrees(tree1, tree1.Root(), tree2, tree2.Root(), tolerance, segmentPairs);
+
+    std::list<BoundingBoxPair> hulls;
+    for (const SegmentPair& pair : segmentPairs) {
+        hulls.push_back(pair.hulls);
+    }
+
+    std::vector<tigl::CurveIntersectionResult> results;
+    for (const BoundingBoxPair& boxes : intersectionCandidates(hulls, tolerance)) {
+        const Intervall& r1 = boxes.b1.range;
+        const Intervall& r2 = boxes.b2.range;
+
+        // start at the closest chord points of the segments inside the candidate ranges
+        double u = 0.5*(r1.min + r1.max);
+        double v = 0.5*(r2.min + r2.max);
+        double bestDistance = std::numeric_limits<double>::max();
+        for (const SegmentPair& pair : segmentPairs) {
+            if (pair.chordDistance < bestDistance &&
+                pair.u >= r1.min && pair.u <= r1.max && pair.v >= r2.min && pair.v <= r2.max) {
+                bestDistance = pair.chordDistance;
+                u = pair.u;
+                v = pair.v;
+            }
+        }
+
+        bool found = newtonDistance(curve1, curve2, boxes, u, v) &&
+                     curve1->Value(u).Distance(curve2->Value(v)) < std::max(1e-10, tolerance);
+
+        // fall back to the global minimization inside the candidate ranges
+        if (!found && minimizeDistance(curve1, curve2, boxes, u, v)) {
+            found = curve1->Value(u).Distance(curve2->Value(v)) < std::max(1e-10, tolerance);
+        }
+
+        if (found) {
+            results.push_back(makeResult(curve1, curve2, u, v));
+        }
+    }
+
     return results;
 }
 
+std::vector<tigl::CurveIntersectionResult> IntersectBSplinesByTrimming(const Handle(Geom_BSplineCurve) curve1, const Handle(Geom_BSplineCurve) curve2, double tolerance)
+{
+    auto hulls = getRangesOfIntersection(curve1, curve2, tolerance);
+
+    std::vector<tigl::CurveIntersectionResult> results;
+    for (const BoundingBoxPair& boxes : intersectionCandidates(hulls, tolerance)) {
+        double u = 0., v = 0.;
+        if (!minimizeDistance(curve1, curve2, boxes, u, v)) {
+            continue;
+        }
 
+        double distance = curve1->Value(u).Distance(curve2->Value(v));
+        if (distance < std::max(1e-10, tolerance)) {
+            results.push_back(makeResult(curve1, curve2, u, v));
+        }
+    }
+
+    return results;
+}
 
 } // namespace tigl
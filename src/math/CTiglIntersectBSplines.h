@@ -40,12 +40,22 @@ struct CurveIntersectionResult
  * An intersection is counted, whenever the two curves come closer than tolerance.
  * If a whole interval is closes than tolerance, the nearest point in the interval is searched.
  *
- * The function divides the input curves and checks, if their bounding boxes (convex hulls)
- * intersect each other. If so, this process is repeated until the curve segment is almost a line segment.
- * This result is used to locally optimize into a true minimum.
+ * The function splits the input curves into Bezier segments and checks, if their bounding boxes (convex hulls)
+ * intersect each other. A bounding box tree over the segments prunes the pairs of segments far away from each other.
+ * The remaining segments are subdivided until they are almost line segments.
+ * This result is used to locally optimize into a true minimum using Newton's method.
  */
 TIGL_EXPORT std::vector<CurveIntersectionResult> IntersectBSplines(const Handle(Geom_BSplineCurve) curve1, const Handle(Geom_BSplineCurve) curve2, double tolerance=1e-5);
 
+/**
+ * @brief Computes all intersections of 2 B-Splines curves like IntersectBSplines
+ *
+ * This is the former implementation, which subdivides the curves by trimming copies of the
+ * B-splines and minimizes the distance with a conjugate gradient method. It is much slower
+ * and mainly kept as reference for the tests.
+ */
+TIGL_EXPORT std::vector<CurveIntersectionResult> IntersectBSplinesByTrimming(const Handle(Geom_BSplineCurve) curve1, const Handle(Geom_BSplineCurve) curve2, double tolerance=1e-5);
+
 } // namespace tigl
 
 #endif // CTIGLINTERSECTBSPLINES_H
@@ -0,0 +1,346 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "CTiglSparseMatrix.h"
+
+#include "CTiglError.h"
+
+#include <math_Gauss.hxx>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+namespace
+{
+
+// Band matrix with lower and upper bandwidth w, factorized without pivoting
+class BandLU
+{
+public:
+    BandLU(int size, int bandwidth)
+        : m_size(size)
+        , m_bandwidth(bandwidth)
+        , m_band(static_cast<size_t>(size) * static_cast<size_t>(2 * bandwidth + 1), 0.)
+    {}
+
+    double& Entry(int i, int j)
+    {
+        return m_band[static_cast<size_t>(i) * static_cast<size_t>(2 * m_bandwidth + 1) + static_cast<size_t>(j - i + m_bandwidth)];
+    }
+
+    double Entry(int i, int j) const
+    {
+        return m_band[static_cast<size_t>(i) * static_cast<size_t>(2 * m_bandwidth + 1) + static_cast<size_t>(j - i + m_bandwidth)];
+    }
+
+    bool Factorize()
+    {
+        double maxEntry = 0.;
+        for (size_t i = 0; i < m_band.size(); ++i) {
+            maxEntry = std::max(maxEntry, std::fabs(m_band[i]));
+        }
+        const double tolerance = 1e-12 * maxEntry;
+
+        for (int k = 0; k < m_size; ++k) {
+            const double pivot = Entry(k, k);
+            if (std::fabs(pivot) <= tolerance) {
+                return false;
+            }
+            const int last = std::min(m_size - 1, k + m_bandwidth);
+            for (int i = k + 1; i <= last; ++i) {
+                const double factor = Entry(i, k) / pivot;
+                Entry(i, k) = factor;
+                if (factor == 0.) {
+                    continue;
+                }
+                for (int j = k + 1; j <= last; ++j) {
+                    Entry(i, j) -= factor * Entry(k, j);
+                }
+            }
+        }
+        return true;
+    }
+
+    // solves L*U*x = b in place
+    void Solve(double* x, int stride) const
+    {
+        for (int i = 0; i < m_size; ++i) {
+            double sum = x[i * stride];
+            for (int k = std::max(0, i - m_bandwidth); k < i; ++k) {
+                sum -= Entry(i, k) * x[k * stride];
+            }
+            x[i * stride] = sum;
+        }
+        for (int i = m_size - 1; i >= 0; --i) {
+            double sum = x[i * stride];
+            for (int k = i + 1; k <= std::min(m_size - 1, i + m_bandwidth); ++k) {
+                sum -= Entry(i, k) * x[k * stride];
+            }
+            x[i * stride] = sum / Entry(i, i);
+        }
+    }
+
+private:
+    int m_size;
+    int m_bandwidth;
+    std::vector<double> m_band;
+};
+
+} // namespace
+
+namespace tigl
+{
+
+CTiglSparseMatrix::CTiglSparseMatrix(int nRows, int nCols)
+    : m_nRows(nRows)
+    , m_nCols(nCols)
+{
+    if (nRows <= 0 || nCols <= 0) {
+        throw CTiglError("Invalid size of sparse matrix", TIGL_MATH_ERROR);
+    }
+    m_rowStart.push_back(0);
+}
+
+int CTiglSparseMatrix::RowNumber() const
+{
+    return m_nRows;
+}
+
+int CTiglSparseMatrix::ColNumber() const
+{
+    return m_nCols;
+}
+
+int CTiglSparseMatrix::NonZeros() const
+{
+    return static_cast<int>(m_values.size());
+}
+
+void CTiglSparseMatrix::Add(int row, int col, double value)
+{
+    if (row < 0 || row >= m_nRows || col < 0 || col >= m_nCols) {
+        throw CTiglError("Index out of range in CTiglSparseMatrix::Add", TIGL_INDEX_ERROR);
+    }
+    if (row + 1 < static_cast<int>(m_rowStart.size())) {
+        throw CTiglError("The rows of CTiglSparseMatrix must be filled in ascending order", TIGL_MATH_ERROR);
+    }
+
+    // open the row and all empty rows before
+    while (static_cast<int>(m_rowStart.size()) <= row) {
+        m_rowStart.push_back(static_cast<int>(m_values.size()));
+    }
+
+    // keep the columns of the row sorted
+    int pos = static_cast<int>(m_values.size());
+    while (pos > m_rowStart[row] && m_colIndex[pos - 1] > col) {
+        pos--;
+    }
+    if (pos > m_rowStart[row] && m_colIndex[pos - 1] == col) {
+        m_values[pos - 1] += value;
+        return;
+    }
+    m_colIndex.insert(m_colIndex.begin() + pos, col);
+    m_values.insert(m_values.begin() + pos, value);
+}
+
+double CTiglSparseMatrix::Value(int row, int col) const
+{
+    if (row < 0 || row >= m_nRows || col < 0 || col >= m_nCols) {
+        throw CTiglError("Index out of range in CTiglSparseMatrix::Value", TIGL_INDEX_ERROR);
+    }
+    for (int k = RowBegin(row); k < RowEnd(row); ++k) {
+        if (m_colIndex[k] == col) {
+            return m_values[k];
+        }
+    }
+    return 0.;
+}
+
+int CTiglSparseMatrix::RowSpread() const
+{
+    int spread = 0;
+    for (int row = 0; row < m_nRows; ++row) {
+        int begin = RowBegin(row);
+        int end = RowEnd(row);
+        if (end > begin) {
+            spread = std::max(spread, m_colIndex[end - 1] - m_colIndex[begin]);
+        }
+    }
+    return spread;
+}
+
+tiglMatrix CTiglSparseMatrix::ToDense() const
+{
+    tiglMatrix result(1, m_nRows, 1, m_nCols, 0.);
+    for (int row = 0; row < m_nRows; ++row) {
+        for (int k = RowBegin(row); k < RowEnd(row); ++k) {
+            result(row + 1, m_colIndex[k] + 1) = m_values[k];
+        }
+    }
+    return result;
+}
+
+tiglMatrix CTiglSparseMatrix::Multiplied(const tiglMatrix& x) const
+{
+    if (x.RowNumber() != m_nCols) {
+        throw CTiglError("Dimension mismatch in CTiglSparseMatrix::Multiplied", TIGL_MATH_ERROR);
+    }
+
+    tiglMatrix result(1, m_nRows, 1, x.ColNumber(), 0.);
+    for (int row = 0; row < m_nRows; ++row) {
+        for (int k = RowBegin(row); k < RowEnd(row); ++k) {
+            for (int icol = 0; icol < x.ColNumber(); ++icol) {
+                result(row + 1, icol + 1) += m_values[k] * x(x.LowerRow() + m_colIndex[k], x.LowerCol() + icol);
+            }
+        }
+    }
+    return result;
+}
+
+tiglMatrix CTiglSparseMatrix::TransposeMultiplied(const tiglMatrix& b) const
+{
+    if (b.RowNumber() != m_nRows) {
+        throw CTiglError("Dimension mismatch in CTiglSparseMatrix::TransposeMultiplied", TIGL_MATH_ERROR);
+    }
+
+    tiglMatrix result(1, m_nCols, 1, b.ColNumber(), 0.);
+    for (int row = 0; row < m_nRows; ++row) {
+        for (int k = RowBegin(row); k < RowEnd(row); ++k) {
+            for (int icol = 0; icol < b.ColNumber(); ++icol) {
+                result(m_colIndex[k] + 1, icol + 1) += m_values[k] * b(b.LowerRow() + row, b.LowerCol() + icol);
+            }
+        }
+    }
+    return result;
+}
+
+CTiglSymmetricBandMatrix CTiglSparseMatrix::TransposeMultipliedSelf() const
+{
+    CTiglSymmetricBandMatrix result(m_nCols, RowSpread());
+    for (int row = 0; row < m_nRows; ++row) {
+        for (int k = RowBegin(row); k < RowEnd(row); ++k) {
+            for (int l = RowBegin(row); l <= k; ++l) {
+                result.Add(m_colIndex[k], m_colIndex[l], m_values[k] * m_values[l]);
+            }
+        }
+    }
+    return result;
+}
+
+bool CTiglSparseMatrix::SolveBanded(int bandwidth, tiglMatrix& b) const
+{
+    if (m_nRows != m_nCols) {
+        throw CTiglError("CTiglSparseMatrix::SolveBanded requires a square matrix", TIGL_MATH_ERROR);
+    }
+    if (b.RowNumber() != m_nRows) {
+        throw CTiglError("Dimension mismatch in CTiglSparseMatrix::SolveBanded", TIGL_MATH_ERROR);
+    }
+
+    const int n = m_nRows;
+    bandwidth = std::max(0, std::min(bandwidth, n - 1));
+
+    // split into the band and the columns with entries outside of the band
+    BandLU band(n, bandwidth);
+    std::vector<int> outerCols;
+    for (int row = 0; row < m_nRows; ++row) {
+        for (int k = RowBegin(row); k < RowEnd(row); ++k) {
+            int col = m_colIndex[k];
+            if (std::abs(col - row) <= bandwidth) {
+                band.Entry(row, col) = m_values[k];
+            }
+            else if (std::find(outerCols.begin(), outerCols.end(), col) == outerCols.end()) {
+                outerCols.push_back(col);
+            }
+        }
+    }
+
+    const int nOuter = static_cast<int>(outerCols.size());
+    if (nOuter > 2 * bandwidth + 1 || !band.Factorize()) {
+        return false;
+    }
+
+    // A = B + U*V^T, where U holds the entries of the outer columns outside of the band
+    // and V^T selects the outer columns. Then, A^-1*b = y - Z*(I + V^T*Z)^-1*V^T*y
+    // with y = B^-1*b and Z = B^-1*U.
+    tiglMatrix Z(1, n, 1, std::max(nOuter, 1), 0.);
+    tiglMatrix capacitance(1, std::max(nOuter, 1), 1, std::max(nOuter, 1), 0.);
+    capacitance(1, 1) = 1.;
+    if (nOuter > 0) {
+        for (int row = 0; row < m_nRows; ++row) {
+            for (int k = RowBegin(row); k < RowEnd(row); ++k) {
+                int col = m_colIndex[k];
+                if (std::abs(col - row) > bandwidth) {
+                    int iOuter = static_cast<int>(std::find(outerCols.begin(), outerCols.end(), col) - outerCols.begin());
+                    Z(row + 1, iOuter + 1) = m_values[k];
+                }
+            }
+        }
+        for (int iOuter = 0; iOuter < nOuter; ++iOuter) {
+            band.Solve(&Z(1, 1) + iOuter, nOuter);
+        }
+
+        for (int i = 0; i < nOuter; ++i) {
+            capacitance(i + 1, i + 1) = 1.;
+            for (int j = 0; j < nOuter; ++j) {
+                capacitance(i + 1, j + 1) += Z(outerCols[i] + 1, j + 1);
+            }
+        }
+    }
+
+    math_Gauss capacitanceSolver(capacitance);
+    if (!capacitanceSolver.IsDone()) {
+        return false;
+    }
+
+    // applies A^-1 to each column of x in place
+    tiglVector selected(1, std::max(nOuter, 1));
+    tiglVector correction(1, std::max(nOuter, 1));
+    auto applyInverse = [&](tiglMatrix& x) {
+        const int nrhs = x.ColNumber();
+        double* data = &x(x.LowerRow(), x.LowerCol());
+        for (int icol = 0; icol < nrhs; ++icol) {
+            band.Solve(data + icol, nrhs);
+            if (nOuter == 0) {
+                continue;
+            }
+
+            for (int i = 0; i < nOuter; ++i) {
+                selected(i + 1) = data[outerCols[i] * nrhs + icol];
+            }
+            capacitanceSolver.Solve(selected, correction);
+            for (int row = 0; row < n; ++row) {
+                double sum = 0.;
+                for (int i = 0; i < nOuter; ++i) {
+                    sum += Z(row + 1, i + 1) * correction(i + 1);
+                }
+                data[row * nrhs + icol] -= sum;
+            }
+        }
+    };
+
+    tiglMatrix x(1, n, 1, b.ColNumber());
+    x = b;
+    applyInverse(x);
+
+    // one step of iterative refinement recovers the accuracy of a pivoted dense solver
+    tiglMatrix residual = b - Multiplied(x);
+    applyInverse(residual);
+    b = x + residual;
+    return true;
+}
+
+} // namespace tigl
@@ -0,0 +1,125 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @brief Sparse matrix in compressed row storage (CSR).
+ *
+ * B-spline basis matrices have only degree + 1 nonzero entries per row. Storing
+ * only these entries avoids the dense (params x control points) matrices and
+ * allows products like A^T*A and A^T*b in O(nonzeros * degree).
+ *
+ * The matrix is filled row by row. Indices of the matrix are zero-based, while the
+ * dense tiglMatrix and tiglVector objects used for products start at their lower index.
+ */
+
+#ifndef CTIGLSPARSEMATRIX_H
+#define CTIGLSPARSEMATRIX_H
+
+#include "tigl_internal.h"
+#include "tiglMatrix.h"
+#include "CTiglSymmetricBandMatrix.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace tigl
+{
+
+class CTiglSparseMatrix
+{
+public:
+    /// Creates an empty matrix of nRows x nCols entries
+    TIGL_EXPORT CTiglSparseMatrix(int nRows, int nCols);
+
+    TIGL_EXPORT int RowNumber() const;
+    TIGL_EXPORT int ColNumber() const;
+    TIGL_EXPORT int NonZeros() const;
+
+    /**
+     * @brief Adds the value to the entry (row, col).
+     *
+     * The rows must be filled in ascending order, i.e. row must not be
+     * smaller than the row of a previous call.
+     */
+    TIGL_EXPORT void Add(int row, int col, double value);
+
+    /// Returns the entry (row, col)
+    TIGL_EXPORT double Value(int row, int col) const;
+
+    /// Returns the maximum distance between two column indices of a row
+    TIGL_EXPORT int RowSpread() const;
+
+    /// Returns the matrix as dense matrix with indices starting at 1
+    TIGL_EXPORT tiglMatrix ToDense() const;
+
+    /// Computes A*x for each column of x
+    TIGL_EXPORT tiglMatrix Multiplied(const tiglMatrix& x) const;
+
+    /// Computes A^T*b for each column of b
+    TIGL_EXPORT tiglMatrix TransposeMultiplied(const tiglMatrix& b) const;
+
+    /// Computes A^T*A, whose bandwidth is the row spread of A
+    TIGL_EXPORT CTiglSymmetricBandMatrix TransposeMultipliedSelf() const;
+
+    /**
+     * @brief Solves the square system A*x = b for each column of b in place.
+     *
+     * The entries with |row - col| <= bandwidth are factorized by Gaussian elimination
+     * without pivoting, which is stable for B-spline collocation matrices. The few
+     * columns with entries outside of the band, e.g. of wrapped control points of
+     * closed curves, are handled as low-rank update (Sherman-Morrison-Woodbury).
+     *
+     * Returns false, if the banded part is (nearly) singular or if too many columns
+     * have entries outside of the band. The caller should use a dense solver then.
+     */
+    TIGL_EXPORT bool SolveBanded(int bandwidth, tiglMatrix& b) const;
+
+    /// The entries k of a row are RowBegin(row) <= k < RowEnd(row)
+    int RowBegin(int row) const
+    {
+        return row < static_cast<int>(m_rowStart.size()) ? m_rowStart[static_cast<size_t>(row)] : static_cast<int>(m_values.size());
+    }
+
+    int RowEnd(int row) const
+    {
+        return row + 1 < static_cast<int>(m_rowStart.size()) ? m_rowStart[static_cast<size_t>(row) + 1] : static_cast<int>(m_values.size());
+    }
+
+    /// Returns the column index of the k-th entry
+    int ColIndex(int k) const
+    {
+        return m_colIndex[static_cast<size_t>(k)];
+    }
+
+    /// Returns the value of the k-th entry
+    double EntryValue(int k) const
+    {
+        return m_values[static_cast<size_t>(k)];
+    }
+
+private:
+    int m_nRows;
+    int m_nCols;
+
+    // the entries of row i are m_values[m_rowStart[i]], ..., m_values[m_rowStart[i+1] - 1]
+    std::vector<int> m_rowStart;
+    std::vector<int> m_colIndex;
+    std::vector<double> m_values;
+};
+
+} // namespace tigl
+
+#endif // CTIGLSPARSEMATRIX_H
@@ -0,0 +1,173 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "CTiglSymmetricBandMatrix.h"
+
+#include "CTiglError.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace tigl
+{
+
+CTiglSymmetricBandMatrix::CTiglSymmetricBandMatrix(int size, int bandwidth)
+    : m_size(size)
+    , m_bandwidth(std::max(0, std::min(bandwidth, size - 1)))
+    , m_isFactorized(false)
+{
+    if (size <= 0 || bandwidth < 0) {
+        throw CTiglError("Invalid size of band matrix", TIGL_MATH_ERROR);
+    }
+    m_band.assign(static_cast<size_t>(m_size) * static_cast<size_t>(m_bandwidth + 1), 0.);
+}
+
+int CTiglSymmetricBandMatrix::Size() const
+{
+    return m_size;
+}
+
+int CTiglSymmetricBandMatrix::Bandwidth() const
+{
+    return m_bandwidth;
+}
+
+void CTiglSymmetricBandMatrix::Add(int i, int j, double value)
+{
+    if (i < j) {
+        std::swap(i, j);
+    }
+    if (j < 0 || i >= m_size || i - j > m_bandwidth) {
+        throw CTiglError("Index out of band in CTiglSymmetricBandMatrix::Add", TIGL_INDEX_ERROR);
+    }
+    if (m_isFactorized) {
+        throw CTiglError("CTiglSymmetricBandMatrix is already factorized", TIGL_MATH_ERROR);
+    }
+    Entry(i, j) += value;
+}
+
+double CTiglSymmetricBandMatrix::Value(int i, int j) const
+{
+    if (i < j) {
+        std::swap(i, j);
+    }
+    if (j < 0 || i >= m_size) {
+        throw CTiglError("Index out of range in CTiglSymmetricBandMatrix::Value", TIGL_INDEX_ERROR);
+    }
+    return i - j > m_bandwidth ? 0. : Entry(i, j);
+}
+
+tiglMatrix CTiglSymmetricBandMatrix::ToDense() const
+{
+    tiglMatrix result(1, m_size, 1, m_size, 0.);
+    for (int i = 0; i < m_size; ++i) {
+        for (int j = std::max(0, i - m_bandwidth); j <= i; ++j) {
+            result(i + 1, j + 1) = Entry(i, j);
+            result(j + 1, i + 1) = Entry(i, j);
+        }
+    }
+    return result;
+}
+
+bool CTiglSymmetricBandMatrix::Factorize()
+{
+    if (m_isFactorized) {
+        return true;
+    }
+
+    double maxDiagonal = 0.;
+    for (int i = 0; i < m_size; ++i) {
+        maxDiagonal = std::max(maxDiagonal, std::fabs(Entry(i, i)));
+    }
+    const double tolerance = maxDiagonal * m_size * std::numeric_limits<double>::epsilon();
+
+    for (int i = 0; i < m_size; ++i) {
+        const int jstart = std::max(0, i - m_bandwidth);
+        for (int j = jstart; j <= i; ++j) {
+            double sum = Entry(i, j);
+            // L(i,k) and L(j,k) are both inside the band for k >= i - bandwidth
+            for (int k = jstart; k < j; ++k) {
+                sum -= Entry(i, k) * Entry(j, k);
+            }
+
+            if (j < i) {
+                Entry(i, j) = sum / Entry(j, j);
+            }
+            else if (sum > tolerance) {
+                Entry(i, i) = std::sqrt(sum);
+            }
+            else {
+                return false;
+            }
+        }
+    }
+
+    m_isFactorized = true;
+    return true;
+}
+
+void CTiglSymmetricBandMatrix::SolveInPlace(double* x, int stride) const
+{
+    // forward substitution L*y = b
+    for (int i = 0; i < m_size; ++i) {
+        double sum = x[i * stride];
+        for (int k = std::max(0, i - m_bandwidth); k < i; ++k) {
+            sum -= Entry(i, k) * x[k * stride];
+        }
+        x[i * stride] = sum / Entry(i, i);
+    }
+
+    // backward substitution L^T*x = y
+    for (int i = m_size - 1; i >= 0; --i) {
+        double sum = x[i * stride];
+        for (int k = i + 1; k <= std::min(m_size - 1, i + m_bandwidth); ++k) {
+            sum -= Entry(k, i) * x[k * stride];
+        }
+        x[i * stride] = sum / Entry(i, i);
+    }
+}
+
+void CTiglSymmetricBandMatrix::Solve(tiglMatrix& rhs) const
+{
+    if (!m_isFactorized) {
+        throw CTiglError("CTiglSymmetricBandMatrix must be factorized before solving", TIGL_MATH_ERROR);
+    }
+    if (rhs.RowNumber() != m_size) {
+        throw CTiglError("Dimension mismatch in CTiglSymmetricBandMatrix::Solve", TIGL_MATH_ERROR);
+    }
+
+    // math_Matrix stores its entries row by row
+    const int ncols = rhs.ColNumber();
+    double* data = &rhs(rhs.LowerRow(), rhs.LowerCol());
+    for (int icol = 0; icol < ncols; ++icol) {
+        SolveInPlace(data + icol, ncols);
+    }
+}
+
+void CTiglSymmetricBandMatrix::Solve(tiglVector& rhs) const
+{
+    if (!m_isFactorized) {
+        throw CTiglError("CTiglSymmetricBandMatrix must be factorized before solving", TIGL_MATH_ERROR);
+    }
+    if (rhs.Length() != m_size) {
+        throw CTiglError("Dimension mismatch in CTiglSymmetricBandMatrix::Solve", TIGL_MATH_ERROR);
+    }
+
+    SolveInPlace(&rhs(rhs.Lower()), 1);
+}
+
+} // namespace tigl
@@ -0,0 +1,94 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @brief Symmetric band matrix with a Cholesky solver.
+ *
+ * Only the entries (i, j) with 0 <= i - j <= bandwidth are stored. Normal equations
+ * of B-spline least squares problems have this structure with bandwidth = degree, since
+ * each parameter has only degree + 1 nonzero basis functions. The factorization then
+ * takes O(n * bandwidth^2) instead of O(n^3) operations.
+ */
+
+#ifndef CTIGLSYMMETRICBANDMATRIX_H
+#define CTIGLSYMMETRICBANDMATRIX_H
+
+#include "tigl_internal.h"
+#include "tiglMatrix.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace tigl
+{
+
+class CTiglSymmetricBandMatrix
+{
+public:
+    /// Creates a zero matrix of size x size entries
+    TIGL_EXPORT CTiglSymmetricBandMatrix(int size, int bandwidth);
+
+    TIGL_EXPORT int Size() const;
+    TIGL_EXPORT int Bandwidth() const;
+
+    /// Adds the value to the entries (i, j) and (j, i). The indices are zero-based.
+    TIGL_EXPORT void Add(int i, int j, double value);
+
+    /// Returns the entry (i, j), which is zero outside of the band
+    TIGL_EXPORT double Value(int i, int j) const;
+
+    /// Returns the matrix as dense matrix with indices starting at 1
+    TIGL_EXPORT tiglMatrix ToDense() const;
+
+    /**
+     * @brief Computes the Cholesky factorization A = L*L^T in place.
+     *
+     * Returns false, if the matrix is not positive definite (up to round-off).
+     * In this case, the matrix is left partially factorized and must not be used anymore.
+     * The matrix must not be modified after the factorization.
+     */
+    TIGL_EXPORT bool Factorize();
+
+    /// Solves A*x = b for each column of the matrix in place. Requires the factorization.
+    TIGL_EXPORT void Solve(tiglMatrix& rhs) const;
+
+    /// Solves A*x = b in place. Requires the factorization.
+    TIGL_EXPORT void Solve(tiglVector& rhs) const;
+
+private:
+    double& Entry(int i, int j)
+    {
+        return m_band[static_cast<size_t>(i) * static_cast<size_t>(m_bandwidth + 1) + static_cast<size_t>(i - j)];
+    }
+
+    double Entry(int i, int j) const
+    {
+        return m_band[static_cast<size_t>(i) * static_cast<size_t>(m_bandwidth + 1) + static_cast<size_t>(i - j)];
+    }
+
+    void SolveInPlace(double* x, int stride) const;
+
+    int m_size;
+    int m_bandwidth;
+    bool m_isFactorized;
+
+    // row i holds the entries (i, i), (i, i-1), ..., (i, i-bandwidth)
+    std::vector<double> m_band;
+};
+
+} // namespace tigl
+
+#endif // CTIGLSYMMETRICBANDMATRIX_H
@@ -249,6 +249,51 @@ double cstcurve(const double& N1, const double& N2, const std::vector<double>& B
 {
         return class_function(N1, N2, x) * shape_function(B, x) + x*T;
 }
+/** @brief Evaluates the shape function S(psi) at all positions x
+ */
+std::vector<double> shape_function(const std::vector<double>& B, const std::vector<double>& x)
+{
+    const size_t m = x.size();
+    std::vector<double> result(m, 0.);
+    if (B.empty()) {
+        return result;
+    }
+    const int order = static_cast<int>(B.size()) - 1;
+
+    // table of (1-x)^j for j = 0 ... order
+    std::vector<double> oneMinusXPow(static_cast<size_t>(order + 1) * m, 1.);
+    for (int j = 1; j <= order; ++j) {
+        const double* prev = &oneMinusXPow[static_cast<size_t>(j - 1) * m];
+        double* current = &oneMinusXPow[static_cast<size_t>(j) * m];
+        for (size_t k = 0; k < m; ++k) {
+            current[k] = prev[k] * (1. - x[k]);
+        }
+    }
+
+    // sum_i B_i * binom(order, i) * x^i * (1-x)^(order-i)
+    std::vector<double> xPow(m, 1.);
+    for (int i = 0; i <= order; ++i) {
+        const double coefficient = B[static_cast<size_t>(i)] * binom(order, i);
+        const double* oneMinusX = &oneMinusXPow[static_cast<size_t>(order - i) * m];
+        for (size_t k = 0; k < m; ++k) {
+            result[k] += coefficient * xPow[k] * oneMinusX[k];
+            xPow[k] *= x[k];
+        }
+    }
+    return result;
+}
+
+/** @brief Evaluates the CST air profile curve at all positions x
+ */
+std::vector<double> cstcurve(const double& N1, const double& N2, const std::vector<double>& B, const double& T, const std::vector<double>& x)
+{
+    std::vector<double> result = shape_function(B, x);
+    for (size_t k = 0; k < x.size(); ++k) {
+        result[k] = class_function(N1, N2, x[k]) * result[k] + x[k]*T;
+    }
+    return result;
+}
+
 /** @brief defines the derivative of the CST air profile curve 
  * CST(psi)=C(psi)*S(psi)
  */
@@ -282,30 +327,67 @@ math_Vector cheb_approx(MathFunc1d& func, int N, double a, double b)
     if (N <= 0) {
         throw CTiglError("N <= 0 in cheb_approx", TIGL_MATH_ERROR);
     }
-    math_Vector c(0, N-1);
-    
-    double * fx = new double[N];
+
+    std::vector<double> fx = cheb_nodes(N, a, b);
+    for (size_t k = 0; k < fx.size(); ++k) {
+        // evaluate function at x
+        fx[k] = func.value(fx[k]);
+    }
+
+    return cheb_coefficients(fx);
+}
+
+/// returns the Chebycheff nodes in [a,b]
+std::vector<double> cheb_nodes(int N, double a, double b)
+{
+    std::vector<double> nodes(static_cast<size_t>(std::max(N, 0)));
     for (int k = 1; k <= N; ++k) {
         double x = cos(M_PI * ((double)k - 0.5) / (double)N);
         // shift to correct intervall
-        x = (x + 1.) / 2. *(b-a) + a;
-        
-        // evaluate function at x
-        fx[k-1] = func.value(x);
+        nodes[static_cast<size_t>(k-1)] = (x + 1.) / 2. *(b-a) + a;
     }
-    
-    for (int j = 0; j < N; ++j) {
-        double cj = 0;
-        for (int k = 1; k <= N; ++k) {
-            double v = fx[k-1] * cos(M_PI * (double)j * ((double)k - 0.5)/ (double)N);
-            cj += 2./(double) N * v;
+    return nodes;
+}
+
+/// computes the Chebycheff coefficients from the function values at the Chebycheff nodes
+math_Vector cheb_coefficients(const std::vector<double>& fx)
+{
+    const int N = static_cast<int>(fx.size());
+    if (N <= 0) {
+        throw CTiglError("No function values in cheb_coefficients", TIGL_MATH_ERROR);
+    }
+    math_Vector c(0, N-1);
+
+    // The Chebycheff polynomials T_j at the nodes are computed for all nodes at once
+    // using the recurrence T_j = 2x*T_(j-1) - T_(j-2) instead of N*N cosine evaluations.
+    std::vector<double> x(static_cast<size_t>(N)), tPrev(static_cast<size_t>(N), 1.), tCurrent(static_cast<size_t>(N));
+    for (int k = 0; k < N; ++k) {
+        x[k] = cos(M_PI * ((double)k + 0.5) / (double)N);
+        tCurrent[k] = x[k];
+    }
+
+    double c0 = 0.;
+    for (int k = 0; k < N; ++k) {
+        c0 += fx[k];
+    }
+    c(0) = 2./(double) N * c0;
+
+    for (int j = 1; j < N; ++j) {
+        double cj = 0.;
+        for (int k = 0; k < N; ++k) {
+            cj += fx[k] * tCurrent[k];
+        }
+        c(j) = 2./(double) N * cj;
+
+        for (int k = 0; k < N; ++k) {
+            double tNext = 2. * x[k] * tCurrent[k] - tPrev[k];
+            tPrev[k] = tCurrent[k];
+            tCurrent[k] = tNext;
         }
-        c(j) = cj;
     }
-    delete[] fx;
-    
+
     c(0) *= 0.5;
-    
+
     return c;
 }
 
@@ -123,6 +123,18 @@ TIGL_EXPORT double shape_function_deriv(const std::vector<double>& B, const int&
  */
 TIGL_EXPORT double cstcurve(const double& N1, const double& N2, const std::vector<double>& B, const double& T, const double& x);
 
+/** @brief Evaluates the shape function S(psi) at all positions x
+ *
+ * The Bernstein polynomials are evaluated for all positions at once in loops
+ * over contiguous arrays, which is much faster than calling shape_function for
+ * each position.
+ */
+TIGL_EXPORT std::vector<double> shape_function(const std::vector<double>& B, const std::vector<double>& x);
+
+/** @brief Evaluates the CST air profile curve at all positions x (see cstcurve)
+ */
+TIGL_EXPORT std::vector<double> cstcurve(const double& N1, const double& N2, const std::vector<double>& B, const double& T, const std::vector<double>& x);
+
 /** @brief defines the derivative of the CST air profile curve 
  * CST(psi)=C(psi)*S(psi)
  */
@@ -159,6 +171,22 @@ public:
     virtual double valueX(double t) = 0;
     virtual double valueY(double t) = 0;
     virtual double valueZ(double t) = 0;
+
+    /**
+     * Evaluates the function at all parameters t. Implementations may override this
+     * to evaluate all parameters at once. The default calls valueX, valueY and valueZ.
+     */
+    virtual void values(const std::vector<double>& t, std::vector<double>& x, std::vector<double>& y, std::vector<double>& z)
+    {
+        x.resize(t.size());
+        y.resize(t.size());
+        z.resize(t.size());
+        for (size_t i = 0; i < t.size(); ++i) {
+            x[i] = valueX(t[i]);
+            y[i] = valueY(t[i]);
+            z[i] = valueZ(t[i]);
+        }
+    }
 };
 
 /**
@@ -174,6 +202,20 @@ public:
  */
 TIGL_EXPORT math_Vector cheb_approx(MathFunc1d& func, int N, double a, double b);
 
+/**
+ * @brief Returns the N Chebycheff nodes in [a,b], at which the function
+ * values for cheb_coefficients must be computed
+ */
+TIGL_EXPORT std::vector<double> cheb_nodes(int N, double a, double b);
+
+/**
+ * @brief Computes the Chebycheff coefficients from the function values at the nodes
+ * returned by cheb_nodes
+ *
+ * @throws CTiglError (TIGL_MATH_ERROR) if fx is empty
+ */
+TIGL_EXPORT math_Vector cheb_coefficients(const std::vector<double>& fx);
+
 
 /** 
  * @brief Computes the chebycheff to monomial transformation matrix
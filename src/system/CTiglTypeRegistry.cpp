@@ -33,6 +33,7 @@ REGISTER_TYPE(CTiglExportVtk)
 REGISTER_TYPE(CTiglExportCollada)
 REGISTER_TYPE(CTiglExportStl)
 REGISTER_TYPE(CTiglExportBrep)
+REGISTER_TYPE(CTiglExportGltf)
 
 
 void CTiglTypeRegistry::Init()
@@ -58,6 +58,7 @@
 #include "ShapeFix_Wire.hxx"
 #include "CTiglMakeLoft.h"
 #include "CCutShape.h"
+#include "CTiglPersistentShapeCache.h"
 #include "CGroupShapes.h"
 #include <TopExp.hxx>
 #include <TopTools_IndexedMapOfShape.hxx>
@@ -405,6 +406,20 @@ PNamedShape CCPACSWing::BuildLoft() const
     return ret;
 }
 
+std::string CCPACSWing::GetPersistentCacheKey() const
+{
+    // the flap deflections are not part of the CPACS document
+    if (buildFlaps) {
+        return "";
+    }
+
+    std::vector<std::string> dependencies;
+    if (GetConfiguration().HasDucts()) {
+        dependencies = GetConfiguration().GetDucts()->GetCutoutAssemblyUIDs(GetUID());
+    }
+    return CTiglPersistentShapeCache::ComputeKey(GetConfiguration().GetTixiDocumentHandle(), GetUID(), "CCPACSWing", dependencies);
+}
+
 TopoDS_Shape CCPACSWing::GetLoftWithCutouts()
 {
     if (NumberOfControlSurfaces(*this) == 0) {
@@ -544,6 +559,18 @@ gp_Pnt CCPACSWing::GetLowerPoint(int segmentIndex, double eta, double xsi)
     return ((CCPACSWingSegment&)GetSegment(segmentIndex)).GetLowerPoint(eta, xsi, getPointBehavior);
 }
 
+// Gets the upper points in absolute (world) coordinates for a given segment and arrays of eta, xsi
+std::vector<gp_Pnt> CCPACSWing::GetUpperPoints(int segmentIndex, const std::vector<double>& etas, const std::vector<double>& xsis)
+{
+    return ((CCPACSWingSegment&)GetSegment(segmentIndex)).GetPoints(etas, xsis, true, GLOBAL_COORDINATE_SYSTEM, getPointBehavior);
+}
+
+// Gets the lower points in absolute (world) coordinates for a given segment and arrays of eta, xsi
+std::vector<gp_Pnt> CCPACSWing::GetLowerPoints(int segmentIndex, const std::vector<double>& etas, const std::vector<double>& xsis)
+{
+    return ((CCPACSWingSegment&)GetSegment(segmentIndex)).GetPoints(etas, xsis, false, GLOBAL_COORDINATE_SYSTEM, getPointBehavior);
+}
+
 // Gets a point on the chord surface in absolute (world) coordinates for a given segment, eta, xsi
 gp_Pnt CCPACSWing::GetChordPoint(int segmentIndex, double eta, double xsi, TiglCoordinateSystem referenceCS)
 {
@@ -23,6 +23,7 @@
 #define CCPACSWING_H
 
 #include <string>
+#include <vector>
 
 #include "generated/CPACSWing.h"
 #include "tigl_config.h"
@@ -209,6 +210,28 @@ public:
      */
     TIGL_EXPORT gp_Pnt GetLowerPoint(int segmentIndex, double eta, double xsi);
 
+    /**
+     * @brief Returns the upper points in absolute (world) coordinates for a given segment and arrays of eta, xsi
+     * coordinates. The points are evaluated in parallel.
+     * (calculated output may be influenced by setting different value for Enum getPointBehavior)
+     * @param segmentIndex
+     * @param etas
+     * @param xsis
+     * @returns the points in the order of the input coordinates
+     */
+    TIGL_EXPORT std::vector<gp_Pnt> GetUpperPoints(int segmentIndex, const std::vector<double>& etas, const std::vector<double>& xsis);
+
+    /**
+     * @brief Returns the lower points in absolute (world) coordinates for a given segment and arrays of eta, xsi
+     * coordinates. The points are evaluated in parallel.
+     * (calculated output may be influenced by setting different value for Enum getPointBehavior)
+     * @param segmentIndex
+     * @param etas
+     * @param xsis
+     * @returns the points in the order of the input coordinates
+     */
+    TIGL_EXPORT std::vector<gp_Pnt> GetLowerPoints(int segmentIndex, const std::vector<double>& etas, const std::vector<double>& xsis);
+
     /**
      * @brief Returns a point on the chord surface in absolute (world) coordinates for a given segment, eta, xsi,
      * if fourth parameter is ommited, otherwise it will give you the point in the chosen coordinate system (e.g.  WING_COORDINATE_SYSTEM)
@@ -611,6 +634,8 @@ protected:
     void BuildFusedSegments(PNamedShape& ) const;
         
     PNamedShape BuildLoft() const override;
+
+    std::string GetPersistentCacheKey() const override;
         
     void BuildUpperLowerShells();
 
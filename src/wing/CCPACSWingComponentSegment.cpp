@@ -43,6 +43,7 @@
 #include "CTiglShapeGeomComponentAdaptor.h"
 #include "CNamedShape.h"
 #include "Debugging.h"
+#include "tiglparallel.h"
 
 #include "BRepOffsetAPI_ThruSections.hxx"
 #include "TopoDS_Edge.hxx"
@@ -73,6 +74,8 @@
 
 #include <BRepAdaptor_CompCurve.hxx>
 #include <BRepBndLib.hxx>
+#include <BndLib_AddSurface.hxx>
+#include <GeomAdaptor_Surface.hxx>
 #include <BRepBuilderAPI_MakeSolid.hxx>
 #include <BRepBuilderAPI_Sewing.hxx>
 #include <GC_MakeSegment.hxx>
@@ -143,6 +146,7 @@ CCPACSWingComponentSegment::CCPACSWingComponentSegment(CCPACSWingComponentSegmen
     , wingSegments(*this, &CCPACSWingComponentSegment::BuildWingSegments)
     , geomCache(*this, &CCPACSWingComponentSegment::BuildGeometry)
     , linesCache(*this, &CCPACSWingComponentSegment::BuildLines)
+    , segmentIndexCache(*this, &CCPACSWingComponentSegment::BuildSegmentIndex)
 {
     assert(wing != NULL);
     Cleanup();
@@ -162,6 +166,7 @@ void CCPACSWingComponentSegment::InvalidateImpl(const boost::optional<std::strin
     wingSegments.clear();
     geomCache.clear();
     linesCache.clear();
+    segmentIndexCache.clear();
 
     // TODO: replace by caches
     chordFace->Reset();
@@ -180,6 +185,7 @@ void CCPACSWingComponentSegment::Cleanup()
     m_toElementUID   = "";
     geomCache.clear();
     linesCache.clear();
+    segmentIndexCache.clear();
     CTiglAbstractSegment<CCPACSWingComponentSegment>::Reset();
     wingSegments.clear();
 }
@@ -933,6 +939,40 @@ double CCPACSWingComponentSegment::GetSurfaceArea()
     return geomCache->mySurfaceArea;
 }
 
+void CCPACSWingComponentSegment::BuildSegmentIndex(SegmentIndexCache& cache) const
+{
+    const SegmentList& segments = GetSegmentList();
+
+    std::vector<Bnd_Box> boxes;
+    boxes.reserve(segments.size());
+    for (const CCPACSWingSegment* segment : segments) {
+        Bnd_Box box;
+        BndLib_AddSurface::Add(GeomAdaptor_Surface(segment->GetUpperSurface()), Precision::Confusion(), box);
+        BndLib_AddSurface::Add(GeomAdaptor_Surface(segment->GetLowerSurface()), Precision::Confusion(), box);
+        // the chord face might leave the wing surfaces e.g. for strongly cambered profiles
+        box.Add(segment->GetChordPoint(0., 0.));
+        box.Add(segment->GetChordPoint(0., 1.));
+        box.Add(segment->GetChordPoint(1., 0.));
+        box.Add(segment->GetChordPoint(1., 1.));
+        boxes.push_back(box);
+    }
+
+    cache.bvh.Build(boxes, 2);
+}
+
+bool CCPACSWingComponentSegment::ComputeSegmentDeviation(const CCPACSWingSegment& segment, const gp_Pnt& pnt, gp_Pnt& nearestPoint, double& deviation)
+{
+    double eta, xsi;
+    if (!segment.ProjectOnChordFace(pnt, eta, xsi)) {
+        return false;
+    }
+
+    // distance between the projection onto the extended chord face and the segment's chord face
+    nearestPoint = segment.GetChordPoint(Clamp(eta, 0., 1.), Clamp(xsi, 0., 1.));
+    deviation = nearestPoint.Distance(segment.GetChordPoint(eta, xsi));
+    return true;
+}
+
 // Returns the segment to a given point on the componentSegment. 
 // Returns null if the point is not an that wing!
 const CCPACSWingSegment* CCPACSWingComponentSegment::findSegment(double x, double y, double z, gp_Pnt& nearestPoint, double& deviation, double maxDeviation) const
@@ -940,29 +980,37 @@ const CCPACSWingSegment* CCPACSWingComponentSegment::findSegment(double x, doubl
     CCPACSWingSegment* result = NULL;
     gp_Pnt pnt(x, y, z);
 
-
     const SegmentList& segments = GetSegmentList();
 
     deviation = std::numeric_limits<double>::max();
-    // now discover to which segment the point belongs
-    for (SegmentList::const_iterator segit = segments.begin(); segit != segments.end(); ++segit) {
-        try {
-            double eta, xsi;
-            gp_Pnt currentPoint;
-            (*segit)->GetEtaXsi(pnt, eta, xsi, currentPoint, onLinearLoft);
 
-            gp_Pnt pointProjected = (*segit)->GetChordPoint(eta, xsi);
+    // only check the segments, whose bounding boxes are close to the point
+    std::vector<size_t> candidates = segmentIndexCache->bvh.FindNear(pnt, maxDeviation);
+    for (size_t index : candidates) {
+        gp_Pnt currentPoint;
+        double currentDist;
+        if (ComputeSegmentDeviation(*segments[index], pnt, currentPoint, currentDist) && currentDist < deviation) {
+            deviation    = currentDist;
+            nearestPoint = currentPoint;
+            result       = segments[index];
+        }
+    }
 
-            double currentDist = currentPoint.Distance(pointProjected);
-            if (currentDist < deviation) {
+    if (deviation > maxDeviation) {
+        // The point is not close to any segment. As the deviation is measured
+        // in the chord plane, check all segments to find its nearest segment.
+        for (size_t index = 0; index < segments.size(); ++index) {
+            if (std::find(candidates.begin(), candidates.end(), index) != candidates.end()) {
+                continue;
+            }
+            gp_Pnt currentPoint;
+            double currentDist;
+            if (ComputeSegmentDeviation(*segments[index], pnt, currentPoint, currentDist) && currentDist < deviation) {
                 deviation    = currentDist;
                 nearestPoint = currentPoint;
-                result       = *segit;
+                result       = segments[index];
             }
         }
-        catch (...) {
-            // do nothing
-        }
     }
 
     // check if pnt lies on component segment shape with maxDeviation tolerance (default 1cm)
@@ -973,6 +1021,24 @@ const CCPACSWingSegment* CCPACSWingComponentSegment::findSegment(double x, doubl
     return result;
 }
 
+std::vector<const CCPACSWingSegment*> CCPACSWingComponentSegment::findSegments(const std::vector<gp_Pnt>& points, std::vector<gp_Pnt>& nearestPoints,
+                                                                               std::vector<double>& deviations, double maxDeviation) const
+{
+    std::vector<const CCPACSWingSegment*> result(points.size(), nullptr);
+    nearestPoints.assign(points.size(), gp_Pnt());
+    deviations.assign(points.size(), std::numeric_limits<double>::max());
+
+    // build the caches before entering the parallel loop
+    segmentIndexCache->bvh.Size();
+
+    ParallelFor(0, static_cast<int>(points.size()), [&](int i) {
+        const gp_Pnt& p = points[i];
+        result[i] = findSegment(p.X(), p.Y(), p.Z(), nearestPoints[i], deviations[i], maxDeviation);
+    });
+
+    return result;
+}
+
 MaterialList CCPACSWingComponentSegment::GetMaterials(double eta, double xsi, TiglStructureType type) const
 {
     MaterialList list;
@@ -42,6 +42,7 @@
 #include "CTiglPointTranslator.h"
 #include "CCPACSTransformation.h"
 #include "CTiglShapeGeomComponentAdaptor.h"
+#include "CTiglBoundingVolumeHierarchy.h"
 #include "Cache.h"
 
 namespace tigl
@@ -129,6 +130,12 @@ public:
     // Returns null if the point is not an that wing, i.e. deviates more than 1 cm from the wing
     TIGL_EXPORT const CCPACSWingSegment* findSegment(double x, double y, double z, gp_Pnt& nearestPoint, double& deviation, double maxDeviation = 1.e-2) const;
 
+    // Batched version of findSegment for point clouds. The points are processed in parallel.
+    // For each point, the segment (or null), the nearest point and the deviation are returned
+    // at the same index as the input point.
+    TIGL_EXPORT std::vector<const CCPACSWingSegment*> findSegments(const std::vector<gp_Pnt>& points, std::vector<gp_Pnt>& nearestPoints,
+                                                                   std::vector<double>& deviations, double maxDeviation = 1.e-2) const;
+
     TIGL_EXPORT TiglGeometricComponentType GetComponentType() const override { return TIGL_COMPONENT_WINGCOMPSEGMENT; }
     TIGL_EXPORT TiglGeometricComponentIntent GetComponentIntent() const override {return TIGL_INTENT_LOGICAL; }
 
@@ -197,6 +204,10 @@ private:
         double      mySurfaceArea; ///< Surface area of this segment
     };
 
+    struct SegmentIndexCache {
+        CTiglBoundingVolumeHierarchy bvh; ///< bounding volume hierarchy over the segments, same order as the segment list
+    };
+
     struct LinesCache {
         TopoDS_Wire  etaLine;                  // 2d version (in YZ plane) of leadingEdgeLine
         TopoDS_Wire  leadingEdgeLine;          // leading edge as wire
@@ -218,6 +229,10 @@ private:
     void BuildWingSegments(SegmentList& cache) const;
     void BuildGeometry(GeometryCache& cache) const;
     void BuildLines(LinesCache& cache) const; // Method for building wires for eta-, leading edge-, trailing edge-lines
+    void BuildSegmentIndex(SegmentIndexCache& cache) const;
+
+    // Computes the deviation of pnt from the chord face of the segment. Returns false, if the projection failed
+    static bool ComputeSegmentDeviation(const CCPACSWingSegment& segment, const gp_Pnt& pnt, gp_Pnt& nearestPoint, double& deviation);
 
 private:
 
@@ -239,6 +254,7 @@ private:
     Cache<SegmentList, CCPACSWingComponentSegment> wingSegments; ///< List of segments belonging to the component segment
     Cache<GeometryCache, CCPACSWingComponentSegment> geomCache;
     Cache<LinesCache, CCPACSWingComponentSegment> linesCache;
+    Cache<SegmentIndexCache, CCPACSWingComponentSegment> segmentIndexCache;
 };
 
 inline std::vector<tigl::CCPACSWingSegment*> getSortedSegments(const CCPACSWingComponentSegment& cs)
@@ -19,6 +19,8 @@
 * @brief  Implementation of CPACS wing profile handling routines.
 */
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <sstream>
 #include <vector>
@@ -106,6 +108,7 @@ CCPACSWingProfile::CCPACSWingProfile(CCPACSWingProfiles* parent, CTiglUIDManager
     , isRotorProfile(false)
     , pointListAlgo(*this, &CCPACSWingProfile::buildPointListAlgo)
     , NACAAlgo(*this, &CCPACSWingProfile::buildNACAAlgo)
+    , xsiParameterMaps(*this, &CCPACSWingProfile::buildXsiParameterMaps)
 {
 }
 
@@ -114,6 +117,7 @@ CCPACSWingProfile::CCPACSWingProfile(CCPACSRotorProfiles* parent, CTiglUIDManage
     , isRotorProfile(false)
     , pointListAlgo(*this, &CCPACSWingProfile::buildPointListAlgo)
     , NACAAlgo(*this, &CCPACSWingProfile::buildNACAAlgo)
+    , xsiParameterMaps(*this, &CCPACSWingProfile::buildXsiParameterMaps)
 {
 }
 
@@ -125,6 +129,7 @@ void CCPACSWingProfile::Cleanup()
     isRotorProfile = false;
     pointListAlgo.clear();
     NACAAlgo.clear();
+    xsiParameterMaps.clear();
 }
 
 // Read wing profile file
@@ -155,6 +160,7 @@ bool CCPACSWingProfile::IsRotorProfile() const
 void CCPACSWingProfile::InvalidateImpl(const boost::optional<std::string>& source) const
 {
     GetProfileAlgo()->Invalidate();
+    xsiParameterMaps.clear();
 }
 
 // Returns the wing profile upper wire
@@ -294,6 +300,13 @@ gp_Pnt CCPACSWingProfile::GetPoint(double xsi, bool fromUpper) const
         return GetTEPoint();
     }
 
+    // fast path: the precomputed xsi lookup table
+    gp_Pnt tablePoint;
+    if (LookupPoint(fromUpper ? xsiParameterMaps->upper : xsiParameterMaps->lower, xsi, tablePoint)) {
+        return tablePoint;
+    }
+
+    // fallback: intersect the profile curve with the chord normal
     gp_Pnt   chordPoint3d = GetChordPoint(xsi);
     gp_Pnt2d chordPoint2d(chordPoint3d.X(), chordPoint3d.Z());
 
@@ -379,6 +392,115 @@ Handle(Geom2d_TrimmedCurve) CCPACSWingProfile::GetChordLine() const
 }
 
 
+void CCPACSWingProfile::buildXsiParameterMaps(XsiParameterMaps& cache) const
+{
+    buildXsiParameterTable(GetUpperWire(), cache.upper);
+    buildXsiParameterTable(GetLowerWire(), cache.lower);
+}
+
+void CCPACSWingProfile::buildXsiParameterTable(const TopoDS_Edge& edge, XsiParameterTable& table) const
+{
+    // the number of samples only affects the start values of the newton iteration
+    const int nSamples = 201;
+
+    table = XsiParameterTable();
+
+    gp_Pnt le3d = GetLEPoint();
+    gp_Pnt te3d = GetTEPoint();
+    table.le = gp_Pnt2d(le3d.X(), le3d.Z());
+    table.te = gp_Pnt2d(te3d.X(), te3d.Z());
+
+    gp_Vec2d chord(table.le, table.te);
+    const double chordLength2 = chord.SquareMagnitude();
+    if (chordLength2 < Precision::SquareConfusion()) {
+        return;
+    }
+
+    Standard_Real firstParam;
+    Standard_Real lastParam;
+    table.curve = BRep_Tool::Curve(edge, firstParam, lastParam);
+    if (table.curve.IsNull()) {
+        return;
+    }
+
+    table.xsis.reserve(nSamples);
+    table.params.reserve(nSamples);
+    for (int i = 0; i < nSamples; ++i) {
+        // cosine spacing to resolve leading and trailing edge
+        double s = 0.5 * (1. - cos(M_PI * static_cast<double>(i) / static_cast<double>(nSamples - 1)));
+        double t = firstParam + (lastParam - firstParam) * s;
+        gp_Pnt p = table.curve->Value(t);
+        gp_Vec2d lp(table.le, gp_Pnt2d(p.X(), p.Z()));
+        table.xsis.push_back(lp.Dot(chord) / chordLength2);
+        table.params.push_back(t);
+    }
+
+    if (table.xsis.front() > table.xsis.back()) {
+        std::reverse(table.xsis.begin(), table.xsis.end());
+        std::reverse(table.params.begin(), table.params.end());
+    }
+
+    // the lookup is only unique, if xsi is monotone along the curve
+    for (size_t i = 1; i < table.xsis.size(); ++i) {
+        if (table.xsis[i] <= table.xsis[i-1]) {
+            return;
+        }
+    }
+    table.valid = true;
+}
+
+bool CCPACSWingProfile::LookupPoint(const XsiParameterTable& table, double xsi, gp_Pnt& point)
+{
+    if (!table.valid || xsi < table.xsis.front() || xsi > table.xsis.back()) {
+        return false;
+    }
+
+    size_t k = std::upper_bound(table.xsis.begin(), table.xsis.end(), xsi) - table.xsis.begin();
+    k = std::min(std::max(k, size_t(1)), table.xsis.size() - 1);
+
+    // bracket [ta, tb] with xsi(ta) <= xsi <= xsi(tb)
+    double ta = table.params[k-1];
+    double tb = table.params[k];
+    double fa = table.xsis[k-1] - xsi;
+    double fb = table.xsis[k] - xsi;
+
+    gp_Vec2d chord(table.le, table.te);
+    const double chordLength2 = chord.SquareMagnitude();
+
+    // safeguarded newton iteration, starting from the linear interpolation
+    double t = ta - fa * (tb - ta) / (fb - fa);
+    gp_Pnt p;
+    gp_Vec d;
+    for (int iter = 0; iter < 50; ++iter) {
+        table.curve->D1(t, p, d);
+        double f = gp_Vec2d(table.le, gp_Pnt2d(p.X(), p.Z())).Dot(chord) / chordLength2 - xsi;
+        if (fabs(f) < 1e-14) {
+            break;
+        }
+        if (f < 0.) {
+            ta = t;
+        }
+        else {
+            tb = t;
+        }
+
+        double df = (d.X() * chord.X() + d.Z() * chord.Y()) / chordLength2;
+        double tnew = df != 0. ? t - f / df : 0.5 * (ta + tb);
+        if (tnew <= std::min(ta, tb) || tnew >= std::max(ta, tb)) {
+            // newton step leaves the bracket, bisect instead
+            tnew = 0.5 * (ta + tb);
+        }
+        if (fabs(tnew - t) < 1e-15 * std::max(1., fabs(t))) {
+            break;
+        }
+        t = tnew;
+    }
+    table.curve->D0(t, p);
+
+    point = gp_Pnt(p.X(), 0.0, p.Z());
+    return true;
+}
+
 void CCPACSWingProfile::buildPointListAlgo(std::unique_ptr<CTiglWingProfilePointList>& cache) const
 {
     cache.reset(new CTiglWingProfilePointList(*this, *m_pointList_choice1));
@@ -27,6 +27,7 @@
 #define CCPACSWINGPROFILE_H
 
 #include <memory>
+#include <vector>
 #include "generated/CPACSProfileGeometry.h"
 #include "tigl_internal.h"
 #include "TopoDS_Wire.hxx"
@@ -43,6 +44,8 @@
 #include "TopAbs_ShapeEnum.hxx"
 
 #include <Geom2d_TrimmedCurve.hxx>
+#include <Geom_Curve.hxx>
+#include <gp_Pnt2d.hxx>
 
 namespace tigl 
 {
@@ -124,6 +127,31 @@ protected:
     // Helper function to determine the chord line between leading and trailing edge in the profile plane
     Handle(Geom2d_TrimmedCurve) GetChordLine() const;
 
+    // Monotone lookup table of the chord coordinate xsi over the curve parameter
+    // of the upper or lower profile curve
+    struct XsiParameterTable
+    {
+        Handle(Geom_Curve) curve;
+        gp_Pnt2d le;
+        gp_Pnt2d te;
+        std::vector<double> xsis;   // strictly increasing
+        std::vector<double> params; // curve parameters at xsis
+        bool valid = false;         // false, if xsi is not monotone along the curve
+    };
+
+    struct XsiParameterMaps
+    {
+        XsiParameterTable upper;
+        XsiParameterTable lower;
+    };
+
+    void buildXsiParameterMaps(XsiParameterMaps& cache) const;
+    void buildXsiParameterTable(const TopoDS_Edge& edge, XsiParameterTable& table) const;
+
+    // Computes the profile point at xsi using the lookup table. Returns false, if
+    // xsi is outside the table range or the table is not valid.
+    static bool LookupPoint(const XsiParameterTable& table, double xsi, gp_Pnt& point);
+
     void buildPointListAlgo(std::unique_ptr<CTiglWingProfilePointList>& cache) const;
 
     /**
@@ -146,6 +174,7 @@ private:
     bool                                  isRotorProfile; /**< Indicates if this profile is a rotor profile */
     Cache<std::unique_ptr<CTiglWingProfilePointList>, CCPACSWingProfile> pointListAlgo;  // is created in case the wing profile alg is a point list, otherwise cst2d constructed in the base class is used
     Cache<std::unique_ptr<CTiglWingProfileNACA>, CCPACSWingProfile> NACAAlgo; 
+    Cache<XsiParameterMaps, CCPACSWingProfile> xsiParameterMaps;
 }; // class CCPACSWingProfile
 
 } // end namespace tigl
@@ -42,6 +42,7 @@
 #include "CTiglMakeLoft.h"
 #include "CTiglPatchShell.h"
 #include "tiglcommonfunctions.h"
+#include "tiglparallel.h"
 #include "tigl_config.h"
 #include "math/tiglmathfunctions.h"
 #include "CNamedShape.h"
@@ -99,7 +100,6 @@
 #include "GeomFill_BSplineCurves.hxx"
 #include "GeomFill_FillingStyle.hxx"
 #include "Geom_BSplineSurface.hxx"
-#include "GeomAPI_ProjectPointOnSurf.hxx"
 #include "GeomAPI_ProjectPointOnCurve.hxx"
 #include "BRepExtrema_DistShapeShape.hxx"
 #include "BRepIntCurveSurface_Inter.hxx"
@@ -820,6 +820,86 @@ gp_Pnt CCPACSWingSegment::GetPoint(double eta, double xsi,
     return profilePoint;
 }
 
+std::vector<gp_Pnt> CCPACSWingSegment::GetPoints(const std::vector<double>& etas, const std::vector<double>& xsis,
+                                                 bool fromUpper, TiglCoordinateSystem referenceCS,
+                                                 TiglGetPointBehavior behavior) const
+{
+    if (etas.size() != xsis.size()) {
+        throw CTiglError("Number of eta and xsi coordinates differ in CCPACSWingSegment::GetPoints", TIGL_ERROR);
+    }
+
+    for (size_t i = 0; i < etas.size(); ++i) {
+        if (etas[i] < 0.0 || etas[i] > 1.0) {
+            throw CTiglError("Parameter eta not in the range 0.0 <= eta <= 1.0 in CCPACSWingSegment::GetPoints", TIGL_ERROR);
+        }
+        if (behavior == asParameterOnSurface && (xsis[i] < 0.0 || xsis[i] > 1.0)) {
+            throw CTiglError("Parameter xsi not in the range 0.0 <= xsi <= 1.0 in CCPACSWingSegment::GetPoints", TIGL_ERROR);
+        }
+    }
+
+    const int nPoints = static_cast<int>(etas.size());
+    std::vector<gp_Pnt> points(etas.size());
+
+    if (behavior == onLinearLoft) {
+        CTiglTransformation wingTransform;
+        switch (referenceCS) {
+        case WING_COORDINATE_SYSTEM:
+            break;
+        case GLOBAL_COORDINATE_SYSTEM:
+            wingTransform = GetParentTransformation();
+            break;
+        default:
+            throw CTiglError("Invalid coordinate system passed to CCPACSWingSegment::GetPoints");
+        }
+
+        // the profile transformations are the same for all points
+        auto profileTransform = [&wingTransform](const CTiglWingConnection& connection) {
+            CTiglTransformation trafo = connection.GetSectionElementTransformation();
+            trafo.PreMultiply(connection.GetSectionTransformation());
+            trafo.PreMultiply(connection.GetPositioningTransformation());
+            trafo.PreMultiply(wingTransform);
+            return trafo;
+        };
+        const CTiglTransformation innerTransform = profileTransform(innerConnection);
+        const CTiglTransformation outerTransform = profileTransform(outerConnection);
+
+        const CCPACSWingProfile& innerProfile = innerConnection.GetProfile();
+        const CCPACSWingProfile& outerProfile = outerConnection.GetProfile();
+
+        auto evaluate = [&](int i) {
+            gp_Pnt innerProfilePoint = fromUpper ? innerProfile.GetUpperPoint(xsis[i]) : innerProfile.GetLowerPoint(xsis[i]);
+            gp_Pnt outerProfilePoint = fromUpper ? outerProfile.GetUpperPoint(xsis[i]) : outerProfile.GetLowerPoint(xsis[i]);
+            innerProfilePoint = innerTransform.Transform(innerProfilePoint);
+            outerProfilePoint = outerTransform.Transform(outerProfilePoint);
+            points[i] = innerProfilePoint.XYZ()*(1. - etas[i]) + outerProfilePoint.XYZ() * etas[i];
+        };
+
+        if (nPoints > 0) {
+            // the first evaluation builds the lazy profile caches
+            evaluate(0);
+            ParallelFor(1, nPoints, evaluate);
+        }
+    }
+    else if (behavior == asParameterOnSurface) {
+        Handle(Geom_Surface) surface = fromUpper ? GetUpperSurface(referenceCS) : GetLowerSurface(referenceCS);
+
+        double umin, umax, vmin, vmax;
+        surface->Bounds(umin, umax, vmin, vmax);
+
+        ParallelFor(0, nPoints, [&](int i) {
+            const double xsi = xsis[i];
+            const double u = fromUpper ? umin*(1-xsi) + umax*xsi : umin*xsi + umax*(1-xsi);
+            const double v = vmin*(1-etas[i]) + vmax*etas[i];
+            surface->D0(u, v, points[i]);
+        });
+    }
+    else {
+        throw CTiglError("CCPACSWingSegment::GetPoints: Unknown TiglGetPointBehavior passed as argument.", TIGL_INDEX_ERROR);
+    }
+
+    return points;
+}
+
 gp_Pnt CCPACSWingSegment::GetPointDirection(double eta, double xsi, double dirx, double diry, double dirz, bool fromUpper, double& deviation) const
 {
     if (!GetParent()->IsParent<CCPACSWing>()) {
@@ -918,32 +998,27 @@ void CCPACSWingSegment::GetEtaXsi(gp_Pnt pnt, double& eta, double& xsi, gp_Pnt&
 
     }
     else  {
-       // GetUpperSurface()
         double maxdist = 10000;
         double dist = maxdist;
         double u,v;
 
         bool onUpper;
 
-        GeomAPI_ProjectPointOnSurf projUpper(pnt, GetUpperSurface());
-
-
-        if (projUpper.NbPoints() > 0 && projUpper.LowerDistance() < dist) {
-            dist = projUpper.LowerDistance();
-            projUpper.LowerDistanceParameters(u, v);
+        double uProj, vProj, distProj;
+        if (surfaceCache->upperProjector.Project(pnt, uProj, vProj, distProj) && distProj < dist) {
+            dist = distProj;
+            u = uProj;
+            v = vProj;
             uvToEtaXsi(true, u, v, eta, xsi);
             onUpper = true;
         }
 
-
-        GeomAPI_ProjectPointOnSurf projLower(pnt, GetLowerSurface());
-
-        if (projLower.NbPoints() > 0 && projLower.LowerDistance() < dist) {
-            dist = projLower.LowerDistance();
-            projLower.LowerDistanceParameters(u, v);
+        if (surfaceCache->lowerProjector.Project(pnt, uProj, vProj, distProj) && distProj < dist) {
+            dist = distProj;
+            u = uProj;
+            v = vProj;
             uvToEtaXsi(false, u, v, eta, xsi);
             onUpper = false;
-
         }
 
         if (dist == maxdist) {
@@ -969,18 +1044,19 @@ void CCPACSWingSegment::GetEtaXsi(gp_Pnt pnt, double& eta, double& xsi, gp_Pnt&
     }
 }
 
+bool CCPACSWingSegment::ProjectOnChordFace(const gp_Pnt& pnt, double& eta, double& xsi) const
+{
+    CTiglPoint tmpPnt(pnt.XYZ());
+    return ChordFace().translate(tmpPnt, &eta, &xsi) == TIGL_SUCCESS;
+}
+
 // Returns if the given point is ont the Top of the wing or on the lower side.
 bool CCPACSWingSegment::GetIsOnTop(gp_Pnt pnt) const
 {
     double tolerance = 0.03; // 3cm
 
-    GeomAPI_ProjectPointOnSurf Proj(pnt, GetUpperSurface());
-    if (Proj.NbPoints() > 0 && Proj.LowerDistance() < tolerance) {
-        return true;
-    }
-    else {
-        return false;
-    }
+    double u, v, dist;
+    return surfaceCache->upperProjector.Project(pnt, u, v, dist) && dist < tolerance;
 }
 
 
@@ -994,13 +1070,8 @@ bool CCPACSWingSegment::GetIsOn(const gp_Pnt& pnt) const
 
     // check if point on chord surface
     double tolerance = 0.03;
-    GeomAPI_ProjectPointOnSurf Proj(pnt, chordSurfaceCache->cordFace);
-    if (Proj.NbPoints() > 0 && Proj.LowerDistance() < tolerance) {
-        return true;
-    }
-    else {
-        return false;
-    }
+    double u, v, dist;
+    return chordSurfaceCache->cordFaceProjector.Project(pnt, u, v, dist) && dist < tolerance;
 }
 
 gp_Pnt CCPACSWingSegment::GetInnerProfilePoint(double xsi)  const
@@ -1080,6 +1151,10 @@ void CCPACSWingSegment::MakeSurfaces(SurfaceCache& cache) const
     cache.lowerSurfaceLocal = globalToLocalTrsf.Transform(cache.lowerSurface);
     cache.upperSurfaceLocal = globalToLocalTrsf.Transform(cache.upperSurface);
 
+    // the projectors sample the surfaces once for all subsequent projections
+    cache.upperProjector.Init(cache.upperSurface);
+    cache.lowerProjector.Init(cache.lowerSurface);
+
 }
 
 void CCPACSWingSegment::MakeChordSurfaces(ChordSurfaceCache& cache) const
@@ -1106,6 +1181,7 @@ void CCPACSWingSegment::MakeChordSurfaces(ChordSurfaceCache& cache) const
     Handle(Geom_TrimmedCurve) innerEdge = GC_MakeSegment(inner_lep_gl , inner_tep_gl ).Value();
     Handle(Geom_TrimmedCurve) outerEdge = GC_MakeSegment(outer_lep_gl , outer_tep_gl ).Value();
     cache.cordFace = GeomFill::Surface(innerEdge, outerEdge);
+    cache.cordFaceProjector.Init(cache.cordFace, 4, 4);
 
     // Do section element transformation on points
     CTiglTransformation identity;
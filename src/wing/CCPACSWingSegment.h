@@ -24,6 +24,7 @@
 #define CCPACSWINGSEGMENT_H
 
 #include <string>
+#include <vector>
 
 #include "generated/CPACSWingSegment.h"
 #include "tigl_config.h"
@@ -37,6 +38,7 @@
 #include "Cache.h"
 #include "CCPACSTransformation.h"
 #include "math/CTiglPointTranslator.h"
+#include "CTiglSurfaceProjector.h"
 
 #include <TopoDS_Face.hxx>
 #include "TopoDS_Shape.hxx"
@@ -159,6 +161,11 @@ public:
     // projects a point unto the wing and returns its coordinates
     TIGL_EXPORT void GetEtaXsi(gp_Pnt pnt, double& eta, double& xsi, gp_Pnt& projectedPoint, TiglGetPointBehavior behavior) const;
 
+    // Projects the point onto the (extended) chord face and returns the eta/xsi coordinates
+    // of the projection. In contrast to GetEtaXsi, eta and xsi are not clamped to [0,1] and
+    // no exception is thrown. Returns false, if the projection failed.
+    TIGL_EXPORT bool ProjectOnChordFace(const gp_Pnt& pnt, double& eta, double& xsi) const;
+
 
     // Returns if the given point is ont the Top of the wing or on the lower side.
     TIGL_EXPORT bool GetIsOnTop(gp_Pnt pnt) const;
@@ -199,6 +206,14 @@ public:
                                 TiglCoordinateSystem referenceCS = GLOBAL_COORDINATE_SYSTEM,
                                 TiglGetPointBehavior behavior = asParameterOnSurface) const;
 
+    // Returns the upper or lower points on the segment surface for arrays of eta and xsi
+    // coordinates. The result is the same as calling GetPoint for each coordinate pair,
+    // but the transformations and surfaces are computed only once and the points
+    // are evaluated in parallel.
+    TIGL_EXPORT std::vector<gp_Pnt> GetPoints(const std::vector<double>& etas, const std::vector<double>& xsis, bool fromUpper,
+                                              TiglCoordinateSystem referenceCS = GLOBAL_COORDINATE_SYSTEM,
+                                              TiglGetPointBehavior behavior = asParameterOnSurface) const;
+
     // Returns an upper or lower point on the segment surface in
     // dependence of parameters eta and xsi, which range from 0.0 to 1.0.
     // For eta = 0.0, xsi = 0.0 point is equal to leading edge on the
@@ -233,6 +248,8 @@ private:
         Handle(Geom_Surface) lowerSurface;
         Handle(Geom_Surface) upperSurfaceLocal;
         Handle(Geom_Surface) lowerSurfaceLocal;
+        CTiglSurfaceProjector upperProjector;
+        CTiglSurfaceProjector lowerProjector;
     };
 
     struct ChordSurfaceCache
@@ -240,6 +257,7 @@ private:
         CTiglPointTranslator cordSurface;
         CTiglPointTranslator cordSurfaceLocal;
         Handle(Geom_Surface) cordFace;
+        CTiglSurfaceProjector cordFaceProjector;
     };
 
     // Invalidates internal state
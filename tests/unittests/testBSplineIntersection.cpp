@@ -19,6 +19,8 @@
 #include "test.h"
 
 #include <Geom_BSplineCurve.hxx>
+#include <Geom_Circle.hxx>
+#include <GeomConvert.hxx>
 #include <TColStd_HArray1OfReal.hxx>
 #include <TColStd_HArray1OfInteger.hxx>
 #include <TColgp_HArray1OfPnt.hxx>
@@ -118,3 +120,59 @@ TEST(BSplineIntersection, ex2)
     results = tigl::IntersectBSplines(c1, c2, 0.07071);
     EXPECT_EQ(0, results.size());
 }
+
+TEST(BSplineIntersection, matchesTrimming)
+{
+    auto knots = OccFArray({0., 1.25, 2.5, 3.75, 5.});
+    auto mults = OccIArray({3, 1, 1, 1, 3});
+
+    auto cp = OccArray({
+        gp_Pnt(0., 0., 0.),
+        gp_Pnt(1., 5., 0.),
+        gp_Pnt(2., 0., 0.),
+        gp_Pnt(3., 5., 0.),
+        gp_Pnt(4., 0., 0.),
+        gp_Pnt(5., 5., 0.)
+    });
+
+    auto cp2 = OccArray({
+        gp_Pnt(0., 0., 0.),
+        gp_Pnt(10., 1., 0.),
+        gp_Pnt(-1.62, 2., 0.),
+        gp_Pnt(4.78, 3., 0.),
+        gp_Pnt(0., 4., 0.),
+        gp_Pnt(5., 5., 0.)
+    });
+
+    Handle(Geom_BSplineCurve) c1 = new Geom_BSplineCurve(cp->Array1(), knots->Array1(), mults->Array1(), 2);
+    Handle(Geom_BSplineCurve) c2 = new Geom_BSplineCurve(cp2->Array1(), knots->Array1(), mults->Array1(), 2);
+
+    const double tolerance = 1e-3;
+    auto results = tigl::IntersectBSplines(c1, c2, tolerance);
+    auto reference = tigl::IntersectBSplinesByTrimming(c1, c2, tolerance);
+
+    ASSERT_EQ(reference.size(), results.size());
+    for (size_t i = 0; i < results.size(); ++i) {
+        EXPECT_NEAR(0.0, reference[i].point.distance2(results[i].point), 1e-8);
+    }
+}
+
+TEST(BSplineIntersection, rationalCircles)
+{
+    Handle(Geom_Circle) circle1 = new Geom_Circle(gp_Ax2(gp_Pnt(0., 0., 0.), gp_Dir(0., 0., 1.)), 1.);
+    Handle(Geom_Circle) circle2 = new Geom_Circle(gp_Ax2(gp_Pnt(1., 0., 0.), gp_Dir(0., 0., 1.)), 1.);
+
+    Handle(Geom_BSplineCurve) c1 = GeomConvert::CurveToBSplineCurve(circle1);
+    Handle(Geom_BSplineCurve) c2 = GeomConvert::CurveToBSplineCurve(circle2);
+    ASSERT_TRUE(c1->IsRational());
+
+    const double tolerance = 1e-5;
+    auto results = tigl::IntersectBSplines(c1, c2, tolerance);
+
+    ASSERT_EQ(2, results.size());
+    for (auto result : results) {
+        EXPECT_NEAR(0.5, result.point.x, 1e-8);
+        EXPECT_NEAR(sqrt(3.)/2., fabs(result.point.y), 1e-8);
+        EXPECT_LE(c1->Value(result.parmOnCurve1).Distance(c2->Value(result.parmOnCurve2)), tolerance);
+    }
+}
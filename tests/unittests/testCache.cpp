@@ -0,0 +1,135 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "test.h"
+
+#include "Cache.h"
+#include "CTiglError.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+class MockCachedClass
+{
+public:
+    struct Data
+    {
+        int value;
+    };
+
+    MockCachedClass()
+        : cache(*this, &MockCachedClass::BuildCache)
+    {
+    }
+
+    tigl::Cache<Data, MockCachedClass> cache;
+    mutable std::atomic<int> nBuilds{0};
+    bool throwOnBuild = false;
+    bool recursiveBuild = false;
+
+private:
+    void BuildCache(Data& data) const
+    {
+        nBuilds++;
+        if (throwOnBuild) {
+            throw tigl::CTiglError("Build failed");
+        }
+        if (recursiveBuild) {
+            cache.value();
+        }
+        // give concurrent readers the chance to run into the build
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        data.value = 42;
+    }
+};
+
+} // namespace
+
+TEST(Cache, BuildOnce)
+{
+    MockCachedClass obj;
+    EXPECT_FALSE(obj.cache.isBuilt());
+    EXPECT_EQ(42, obj.cache->value);
+    EXPECT_EQ(42, obj.cache.value().value);
+    EXPECT_TRUE(obj.cache.isBuilt());
+    EXPECT_EQ(1, obj.nBuilds);
+
+    obj.cache.clear();
+    EXPECT_FALSE(obj.cache.isBuilt());
+    EXPECT_EQ(42, obj.cache->value);
+    EXPECT_EQ(2, obj.nBuilds);
+}
+
+TEST(Cache, ConcurrentBuildOnce)
+{
+    MockCachedClass obj;
+
+    std::atomic<int> nWrongValues{0};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 8; ++i) {
+        threads.emplace_back([&obj, &nWrongValues]() {
+            for (int j = 0; j < 1000; ++j) {
+                if (obj.cache->value != 42) {
+                    nWrongValues++;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(0, nWrongValues);
+    EXPECT_EQ(1, obj.nBuilds);
+}
+
+TEST(Cache, WriteAccess)
+{
+    MockCachedClass obj;
+    {
+        auto data = obj.cache.writeAccess();
+        data->value = 5;
+    }
+    EXPECT_TRUE(obj.cache.isBuilt());
+    EXPECT_EQ(5, obj.cache->value);
+    EXPECT_EQ(0, obj.nBuilds);
+}
+
+TEST(Cache, BuildThrows)
+{
+    MockCachedClass obj;
+    obj.throwOnBuild = true;
+    EXPECT_THROW(obj.cache.value(), tigl::CTiglError);
+    EXPECT_FALSE(obj.cache.isBuilt());
+
+    // the next access must try to build again
+    obj.throwOnBuild = false;
+    EXPECT_EQ(42, obj.cache->value);
+    EXPECT_EQ(2, obj.nBuilds);
+}
+
+TEST(Cache, RecursiveBuild)
+{
+    MockCachedClass obj;
+    obj.recursiveBuild = true;
+    EXPECT_THROW(obj.cache.value(), tigl::CTiglError);
+    EXPECT_FALSE(obj.cache.isBuilt());
+}
@@ -1564,6 +1564,30 @@ TEST_P(GordonSurface, testFromBRep)
     BRepTools::Write(BRepBuilderAPI_MakeFace(gordonSurface, Precision::Confusion()), path_output.c_str());
 }
 
+TEST_P(GordonSurface, parallelIntersectionsDeterministic)
+{
+    CTiglInterpolateCurveNetwork serialNetwork(splines_u_vector, splines_v_vector, 3e-4);
+    serialNetwork.SetParallel(false);
+    Handle(Geom_BSplineSurface) serial = serialNetwork.Surface();
+
+    CTiglInterpolateCurveNetwork parallelNetwork(splines_u_vector, splines_v_vector, 3e-4);
+    parallelNetwork.SetParallel(true);
+    Handle(Geom_BSplineSurface) parallel = parallelNetwork.Surface();
+
+    // the intersection matrix doesn't depend on the evaluation order
+    ASSERT_EQ(serial->NbUPoles(), parallel->NbUPoles());
+    ASSERT_EQ(serial->NbVPoles(), parallel->NbVPoles());
+    for (int i = 1; i <= serial->NbUPoles(); ++i) {
+        for (int j = 1; j <= serial->NbVPoles(); ++j) {
+            EXPECT_EQ(0., serial->Pole(i, j).Distance(parallel->Pole(i, j)));
+        }
+    }
+
+    std::vector<double> serialParams = serialNetwork.ParametersProfiles();
+    std::vector<double> parallelParams = parallelNetwork.ParametersProfiles();
+    EXPECT_TRUE(serialParams == parallelParams);
+}
+
 TEST_P(GordonSurface, testIntersectionRegressions)
 {
     math_Matrix intersection_params_u(0, splines_u_vector.size() - 1,
@@ -26,11 +26,43 @@
 #include "CCPACSConfigurationManager.h"
 
 #include "CCPACSWingCell.h"
+#include "CCPACSWing.h"
+#include "CCPACSWingSegment.h"
 
 #include <string.h>
+#include <algorithm>
+#include <cmath>
 #include <ctime>
+#include <chrono>
+#include <thread>
+#include <vector>
 
 #include "CTiglFusePlane.h"
+#include "CTiglTriangularizer.h"
+#include "CTiglBSplineApproxInterp.h"
+#include "CTiglBSplineFit.h"
+#include "CTiglBSplineAlgorithms.h"
+#include "CCSTCurveBuilder.h"
+#include "CTiglInterpolateCurveNetwork.h"
+#include "CTiglIntersectBSplines.h"
+#include "CTiglPointsToBSplineInterpolation.h"
+#include "CTiglSparseMatrix.h"
+#include "tiglcommonfunctions.h"
+#include "tiglmathfunctions.h"
+
+#include <GeomAPI_ProjectPointOnSurf.hxx>
+#include <GeomConvert.hxx>
+#include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepTools.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TColgp_Array2OfPnt.hxx>
+#include <math_Gauss.hxx>
+#include <TopExp.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <OSD_Parallel.hxx>
+#include <OSD_ThreadPool.hxx>
 /******************************************************************************/
 
 class TestPerformance : public ::testing::Test
@@ -97,6 +129,35 @@ TEST_F(TestPerformance, wingGetPoint)
     }
 }
 
+TEST_F(TestPerformance, wingGetPoints)
+{
+    const int nPoints = 10000;
+    std::vector<double> etas(nPoints), xsis(nPoints);
+    for (int i = 0; i < nPoints; ++i) {
+        etas[i] = static_cast <double> (rand()) / static_cast <double> (RAND_MAX);
+        xsis[i] = static_cast <double> (rand()) / static_cast <double> (RAND_MAX);
+    }
+    std::vector<double> x(nPoints), y(nPoints), z(nPoints);
+
+    // make sure, the surfaces are built
+    ASSERT_EQ(TIGL_SUCCESS, tiglWingGetUpperPoints(tiglHandle, 1, 1, 1, etas.data(), xsis.data(), x.data(), y.data(), z.data()));
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < nPoints; ++i) {
+        ASSERT_EQ(TIGL_SUCCESS, tiglWingGetUpperPoint(tiglHandle, 1, 1, etas[i], xsis[i], &x[i], &y[i], &z[i]));
+    }
+    auto stop = std::chrono::steady_clock::now();
+    double time_single = std::chrono::duration<double, std::micro>(stop - start).count() / nPoints;
+
+    start = std::chrono::steady_clock::now();
+    ASSERT_EQ(TIGL_SUCCESS, tiglWingGetUpperPoints(tiglHandle, 1, 1, nPoints, etas.data(), xsis.data(), x.data(), y.data(), z.data()));
+    stop = std::chrono::steady_clock::now();
+    double time_batch = std::chrono::duration<double, std::micro>(stop - start).count() / nPoints;
+
+    std::cout << "Time wingGetPoint single [us]: " << time_single << std::endl;
+    std::cout << "Time wingGetPoint batched [us]: " << time_batch << std::endl;
+}
+
 TEST_F(TestPerformance, fuselageGetPoint)
 {
     int nruns = 100;
@@ -130,6 +191,37 @@ TEST_F(TestPerformance, fuselageGetPoint)
     }
 }
 
+TEST_F(TestPerformance, cacheContention)
+{
+    tigl::CCPACSConfiguration& config = tigl::CCPACSConfigurationManager::GetInstance().GetConfiguration(tiglHandle);
+    tigl::CCPACSWing& wing = config.GetWing(1);
+
+    // build the loft once, we only want to measure the access of the built cache
+    ASSERT_TRUE(wing.GetLoft() != nullptr);
+
+    const int nruns = 200000;
+    for (unsigned int nthreads = 1; nthreads <= 8; nthreads *= 2) {
+        std::vector<std::thread> threads;
+
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned int ithread = 0; ithread < nthreads; ++ithread) {
+            threads.emplace_back([&wing, nruns]() {
+                for (int irun = 0; irun < nruns; ++irun) {
+                    PNamedShape loft = wing.GetLoft();
+                    ASSERT_TRUE(loft != nullptr);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        auto stop = std::chrono::steady_clock::now();
+
+        double time_elapsed = std::chrono::duration<double, std::micro>(stop - start).count() / nruns;
+        std::cout << "Time cached GetLoft with " << nthreads << " threads [us]: " << time_elapsed << std::endl;
+    }
+}
+
 TEST_F(TestPerformance, pointTranslator)
 {
     int nruns = 10000;
@@ -227,6 +319,504 @@ TEST_F(TestPerformance, tiglCheckPointInside_false)
     std::cout << "Time tiglCheckPointInside fuselage [us]: " << time_elapsed << std::endl;
 }
 
+TEST_F(TestPerformance, wingSegmentProjection)
+{
+    tigl::CCPACSConfiguration& config = tigl::CCPACSConfigurationManager::GetInstance().GetConfiguration(tiglHandle);
+    tigl::CCPACSWingSegment& segment = static_cast<tigl::CCPACSWingSegment&>(config.GetWing(1).GetSegment(1));
+
+    const int nPoints = 1000;
+    std::vector<gp_Pnt> points;
+    for (int i = 0; i < nPoints; ++i) {
+        double eta = static_cast <double> (rand()) / static_cast <double> (RAND_MAX);
+        double xsi = static_cast <double> (rand()) / static_cast <double> (RAND_MAX);
+        points.push_back(segment.GetPoint(eta, xsi, i % 2 == 0));
+    }
+
+    // reference: a new projection object for each point
+    Handle(Geom_Surface) upperSurface = segment.GetUpperSurface();
+    int nOnTop = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (const gp_Pnt& p : points) {
+        GeomAPI_ProjectPointOnSurf proj(p, upperSurface);
+        if (proj.NbPoints() > 0 && proj.LowerDistance() < 0.03) {
+            nOnTop++;
+        }
+    }
+    auto stop = std::chrono::steady_clock::now();
+    std::cout << "Time GeomAPI_ProjectPointOnSurf [us]: " << std::chrono::duration<double, std::micro>(stop - start).count() / nPoints << std::endl;
+
+    int nOnTopCached = 0;
+    start = std::chrono::steady_clock::now();
+    for (const gp_Pnt& p : points) {
+        if (segment.GetIsOnTop(p)) {
+            nOnTopCached++;
+        }
+    }
+    stop = std::chrono::steady_clock::now();
+    std::cout << "Time GetIsOnTop [us]: " << std::chrono::duration<double, std::micro>(stop - start).count() / nPoints << std::endl;
+    EXPECT_EQ(nOnTop, nOnTopCached);
+
+    double eta, xsi;
+    gp_Pnt projected;
+    start = std::chrono::steady_clock::now();
+    for (const gp_Pnt& p : points) {
+        segment.GetEtaXsi(p, eta, xsi, projected, asParameterOnSurface);
+    }
+    stop = std::chrono::steady_clock::now();
+    std::cout << "Time GetEtaXsi asParameterOnSurface [us]: " << std::chrono::duration<double, std::micro>(stop - start).count() / nPoints << std::endl;
+}
+
+TEST_F(TestPerformance, fuselageGetPointsAngle)
+{
+    const int nAngles = 360;
+    std::vector<double> alpha(nAngles);
+    for (int i = 0; i < nAngles; ++i) {
+        alpha[i] = static_cast<double>(i);
+    }
+    std::vector<double> x(nAngles), y(nAngles), z(nAngles);
+
+    // the first call builds the loft and the cross section
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_EQ(TIGL_SUCCESS, tiglFuselageGetPointAngle(tiglHandle, 1, 10, 0.5, alpha[0], &x[0], &y[0], &z[0]));
+    auto stop = std::chrono::steady_clock::now();
+    std::cout << "Time tiglFuselageGetPointAngle first call [ms]: " << std::chrono::duration<double, std::milli>(stop - start).count() << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < nAngles; ++i) {
+        ASSERT_EQ(TIGL_SUCCESS, tiglFuselageGetPointAngle(tiglHandle, 1, 10, 0.5, alpha[i], &x[i], &y[i], &z[i]));
+    }
+    stop = std::chrono::steady_clock::now();
+    std::cout << "Time tiglFuselageGetPointAngle [us]: " << std::chrono::duration<double, std::micro>(stop - start).count() / nAngles << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    ASSERT_EQ(TIGL_SUCCESS, tiglFuselageGetPointsAngle(tiglHandle, 1, 10, 0.5, nAngles, alpha.data(), x.data(), y.data(), z.data()));
+    stop = std::chrono::steady_clock::now();
+    std::cout << "Time tiglFuselageGetPointsAngle [us]: " << std::chrono::duration<double, std::micro>(stop - start).count() / nAngles << std::endl;
+}
+
+TEST_F(TestPerformance, fuselageGetPointsOnYPlanes)
+{
+    const int nPlanes = 50;
+    std::vector<double> ypos(nPlanes);
+    for (int i = 0; i < nPlanes; ++i) {
+        ypos[i] = -1.5 + 3. * i / (nPlanes - 1.);
+    }
+
+    // make sure, the loft is built
+    int numPoints = 0;
+    ASSERT_EQ(TIGL_SUCCESS, tiglFuselageGetNumPointsOnYPlane(tiglHandle, 1, 10, 0.5, ypos[0], &numPoints));
+
+    // one call for the number of points and one for each point
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < nPlanes; ++i) {
+        ASSERT_EQ(TIGL_SUCCESS, tiglFuselageGetNumPointsOnYPlane(tiglHandle, 1, 10, 0.5, ypos[i], &numPoints));
+        for (int ipoint = 1; ipoint <= numPoints; ++ipoint) {
+            double x, y, z;
+            ASSERT_EQ(TIGL_SUCCESS, tiglFuselageGetPointOnYPlane(tiglHandle, 1, 10, 0.5, ypos[i], ipoint, &x, &y, &z));
+        }
+    }
+    auto stop = std::chrono::steady_clock::now();
+    std::cout << "Time tiglFuselageGetPointOnYPlane per plane [us]: " << std::chrono::duration<double, std::micro>(stop - start).count() / nPlanes << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    std::vector<int> nums(nPlanes);
+    ASSERT_EQ(TIGL_SUCCESS, tiglFuselageGetNumPointsOnYPlanes(tiglHandle, 1, 10, 0.5, nPlanes, ypos.data(), nums.data()));
+    int nPoints = 0;
+    for (int n : nums) {
+        nPoints += n;
+    }
+    std::vector<double> x(nPoints), y(nPoints), z(nPoints);
+    ASSERT_EQ(TIGL_SUCCESS, tiglFuselageGetPointsOnYPlanes(tiglHandle, 1, 10, 0.5, nPlanes, ypos.data(), nPoints, x.data(), y.data(), z.data()));
+    stop = std::chrono::steady_clock::now();
+    std::cout << "Time tiglFuselageGetPointsOnYPlanes per plane [us]: " << std::chrono::duration<double, std::micro>(stop - start).count() / nPlanes << std::endl;
+}
+
+TEST_F(TestPerformance, tiglCheckPointsInside)
+{
+    const int nPoints = 100000;
+    std::vector<double> px(nPoints), py(nPoints), pz(nPoints);
+    std::vector<TiglBoolean> isInside(nPoints);
+
+    // random points in the bounding box of the wing root
+    for (int i = 0; i < nPoints; ++i) {
+        px[i] = 10.  + 10. * static_cast <double> (rand()) / static_cast <double> (RAND_MAX);
+        py[i] = 0.   + 5.  * static_cast <double> (rand()) / static_cast <double> (RAND_MAX);
+        pz[i] = -3.  + 4.  * static_cast <double> (rand()) / static_cast <double> (RAND_MAX);
+    }
+
+    // builds the classifier
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_EQ(TIGL_SUCCESS, tiglCheckPointsInside(tiglHandle, "D150_VAMP_W1", 1, px.data(), py.data(), pz.data(), isInside.data()));
+    auto stop = std::chrono::steady_clock::now();
+    std::cout << "Time tiglCheckPointsInside setup [ms]: " << std::chrono::duration<double, std::milli>(stop - start).count() << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    ASSERT_EQ(TIGL_SUCCESS, tiglCheckPointsInside(tiglHandle, "D150_VAMP_W1", nPoints, px.data(), py.data(), pz.data(), isInside.data()));
+    stop = std::chrono::steady_clock::now();
+    std::cout << "Time tiglCheckPointsInside wing [us]: " << std::chrono::duration<double, std::micro>(stop - start).count() / nPoints << std::endl;
+}
+
+TEST_F(TestPerformance, triangularizeFullPlane)
+{
+    tigl::CCPACSConfiguration& config = tigl::CCPACSConfigurationManager::GetInstance().GetConfiguration(tiglHandle);
+    tigl::PTiglFusePlane fuser = config.AircraftFusingAlgo();
+    fuser->SetResultMode(tigl::FULL_PLANE);
+    PNamedShape airplane = fuser->FusedPlane();
+    ASSERT_TRUE(airplane != nullptr);
+
+    auto start = std::chrono::steady_clock::now();
+    tigl::CTiglTriangularizer serial(&config.GetUIDManager(), airplane, 0.01, tigl::SEGMENT_INFO, true, false);
+    auto stop = std::chrono::steady_clock::now();
+    const tigl::CTiglPolyObject& serialObject = serial.getTriangulation().currentObject();
+    std::cout << "Triangles of the full plane: " << serialObject.getNPolygons() << std::endl;
+    std::cout << "Time triangularize full plane serial [ms]: " << std::chrono::duration<double, std::milli>(stop - start).count() << std::endl;
+
+    // the thread count is controlled by the OpenCASCADE thread pool
+    const bool useOcctThreads = OSD_Parallel::ToUseOcctThreads();
+    OSD_Parallel::SetUseOcctThreads(true);
+    const Handle(OSD_ThreadPool)& pool = OSD_ThreadPool::DefaultPool();
+    const int defaultNbThreads = pool->NbThreads();
+    const int maxThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+
+    for (int nthreads = 1; nthreads <= maxThreads; nthreads *= 2) {
+        pool->Init(nthreads);
+
+        start = std::chrono::steady_clock::now();
+        tigl::CTiglTriangularizer parallel(&config.GetUIDManager(), airplane, 0.01, tigl::SEGMENT_INFO, true, true);
+        stop = std::chrono::steady_clock::now();
+        std::cout << "Time triangularize full plane with " << nthreads << " threads [ms]: "
+                  << std::chrono::duration<double, std::milli>(stop - start).count() << std::endl;
+
+        const tigl::CTiglPolyObject& parallelObject = parallel.getTriangulation().currentObject();
+        EXPECT_EQ(serialObject.getNVertices(), parallelObject.getNVertices());
+        EXPECT_EQ(serialObject.getNPolygons(), parallelObject.getNPolygons());
+    }
+
+    pool->Init(defaultNbThreads);
+    OSD_Parallel::SetUseOcctThreads(useOcctThreads);
+}
+
+TEST_F(TestPerformance, fuseFullPlane)
+{
+    tigl::CCPACSConfiguration& config = tigl::CCPACSConfigurationManager::GetInstance().GetConfiguration(tiglHandle);
+    tigl::PTiglFusePlane fuser = config.AircraftFusingAlgo();
+    fuser->SetResultMode(tigl::FULL_PLANE);
+
+    // build the lofts first, we only want to measure the boolean operation
+    fuser->Invalidate();
+    fuser->SetRunParallel(false);
+    PNamedShape serial = fuser->FusedPlane();
+    ASSERT_TRUE(serial != nullptr);
+
+    fuser->Invalidate();
+    auto start = std::chrono::steady_clock::now();
+    serial = fuser->FusedPlane();
+    auto stop = std::chrono::steady_clock::now();
+    std::cout << "Time fuse full plane serial [ms]: " << std::chrono::duration<double, std::milli>(stop - start).count() << std::endl;
+
+    TopTools_IndexedMapOfShape serialFaces;
+    TopExp::MapShapes(serial->Shape(), TopAbs_FACE, serialFaces);
+
+    // the thread count is controlled by the OpenCASCADE thread pool
+    const bool useOcctThreads = OSD_Parallel::ToUseOcctThreads();
+    OSD_Parallel::SetUseOcctThreads(true);
+    const Handle(OSD_ThreadPool)& pool = OSD_ThreadPool::DefaultPool();
+    const int defaultNbThreads = pool->NbThreads();
+    const int maxThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+
+    fuser->SetRunParallel(true);
+    for (int nthreads = 1; nthreads <= maxThreads; nthreads *= 2) {
+        pool->Init(nthreads);
+
+        int nProgressCalls = 0;
+        fuser->SetProgressCallback([&nProgressCalls](double) {
+            nProgressCalls++;
+            return true;
+        });
+
+        fuser->Invalidate();
+        start = std::chrono::steady_clock::now();
+        PNamedShape parallel = fuser->FusedPlane();
+        stop = std::chrono::steady_clock::now();
+        std::cout << "Time fuse full plane with " << nthreads << " threads [ms]: "
+                  << std::chrono::duration<double, std::milli>(stop - start).count()
+                  << " (" << nProgressCalls << " progress reports)" << std::endl;
+
+        ASSERT_TRUE(parallel != nullptr);
+        TopTools_IndexedMapOfShape parallelFaces;
+        TopExp::MapShapes(parallel->Shape(), TopAbs_FACE, parallelFaces);
+        EXPECT_EQ(serialFaces.Extent(), parallelFaces.Extent());
+    }
+
+    fuser->SetProgressCallback(tigl::CTiglFusePlane::ProgressCallback());
+    pool->Init(defaultNbThreads);
+    OSD_Parallel::SetUseOcctThreads(useOcctThreads);
+}
+
+TEST_F(TestPerformance, bsplineApproxDenseProfile)
+{
+    // densely sampled airfoil-like point list
+    const int nPoints = 2001;
+    TColgp_Array1OfPnt profile(1, nPoints);
+    for (int i = 0; i < nPoints; ++i) {
+        double phi = 2. * M_PI * i / static_cast<double>(nPoints - 1);
+        double x = 0.5 * (1. + cos(phi));
+        double z = 0.6 * (0.2969*sqrt(x) - 0.126*x - 0.3516*x*x + 0.2843*x*x*x - 0.1036*x*x*x*x);
+        profile.SetValue(i + 1, gp_Pnt(x, 0., sin(phi) >= 0. ? z : -z));
+    }
+
+    for (int ncp : {50, 200, 400}) {
+        tigl::CTiglBSplineApproxInterp app(profile, ncp, 3);
+        app.InterpolatePoint(0);
+        app.InterpolatePoint(nPoints - 1);
+
+        auto start = std::chrono::steady_clock::now();
+        tigl::CTiglApproxResult banded = app.FitCurveOptimal();
+        auto stop = std::chrono::steady_clock::now();
+        double bandedTime = std::chrono::duration<double, std::milli>(stop - start).count();
+
+        app.SetUseDenseSolver(true);
+        start = std::chrono::steady_clock::now();
+        tigl::CTiglApproxResult dense = app.FitCurveOptimal();
+        stop = std::chrono::steady_clock::now();
+        double denseTime = std::chrono::duration<double, std::milli>(stop - start).count();
+
+        std::cout << "Time approximating " << nPoints << " points with " << ncp << " control points [ms]: "
+                  << "banded " << bandedTime << ", dense " << denseTime << std::endl;
+        EXPECT_NEAR(dense.error, banded.error, 1e-8);
+
+        BSplineFit fit(3, ncp);
+        start = std::chrono::steady_clock::now();
+        ASSERT_EQ(BSplineFit::NoError, fit.FitOptimal(profile, 0.5, 1e-6, 10));
+        stop = std::chrono::steady_clock::now();
+        bandedTime = std::chrono::duration<double, std::milli>(stop - start).count();
+
+        fit.SetUseDenseSolver(true);
+        start = std::chrono::steady_clock::now();
+        ASSERT_EQ(BSplineFit::NoError, fit.FitOptimal(profile, 0.5, 1e-6, 10));
+        stop = std::chrono::steady_clock::now();
+        denseTime = std::chrono::duration<double, std::milli>(stop - start).count();
+
+        std::cout << "Time fitting " << nPoints << " points with " << ncp << " control points [ms]: "
+                  << "banded " << bandedTime << ", dense " << denseTime << std::endl;
+    }
+}
+
+TEST_F(TestPerformance, pointsToSurfaceLargeGrid)
+{
+    for (int n : {50, 100, 200, 400}) {
+        TColgp_Array2OfPnt points(1, n, 1, n);
+        std::vector<double> params(n);
+        for (int i = 1; i <= n; ++i) {
+            params[i - 1] = static_cast<double>(i - 1) / (n - 1);
+        }
+        for (int i = 1; i <= n; ++i) {
+            for (int j = 1; j <= n; ++j) {
+                double u = params[i - 1], v = params[j - 1];
+                points.SetValue(i, j, gp_Pnt(u, v, 0.1 * sin(6. * u) * cos(4. * v)));
+            }
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        Handle(Geom_BSplineSurface) surface = tigl::CTiglBSplineAlgorithms::pointsToSurface(points, params, params, false, false);
+        auto stop = std::chrono::steady_clock::now();
+        ASSERT_FALSE(surface.IsNull());
+
+        // reference: one dense solve of the collocation matrix, as done before for each curve of the surface
+        std::vector<double> knots = tigl::CTiglBSplineAlgorithms::knotsFromCurveParameters(params, 3, false);
+        tigl::CTiglSparseMatrix collocation = tigl::CTiglBSplineAlgorithms::bsplineBasisMatSparse(3, OccFArray(knots)->Array1(), OccFArray(params)->Array1());
+        tigl::tiglMatrix rhs(1, n, 1, 3, 1.);
+
+        auto denseStart = std::chrono::steady_clock::now();
+        math_Gauss dense(collocation.ToDense());
+        auto denseStop = std::chrono::steady_clock::now();
+
+        tigl::tiglMatrix x = rhs;
+        auto sparseStart = std::chrono::steady_clock::now();
+        ASSERT_TRUE(collocation.SolveBanded(3, x));
+        auto sparseStop = std::chrono::steady_clock::now();
+
+        std::cout << "Time pointsToSurface " << n << "x" << n << " points [ms]: "
+                  << std::chrono::duration<double, std::milli>(stop - start).count()
+                  << ", collocation matrix factorization dense "
+                  << std::chrono::duration<double, std::milli>(denseStop - denseStart).count()
+                  << ", sparse " << std::chrono::duration<double, std::milli>(sparseStop - sparseStart).count()
+                  << " (" << collocation.NonZeros() << " of " << n * n << " entries)" << std::endl;
+    }
+}
+
+TEST_F(TestPerformance, curveNetworkManyGuides)
+{
+    // half cylinder with many profiles and guides, the guides pass through the profile points
+    const int nProfiles = 40;
+    const int nGuides = 40;
+
+    std::vector<Handle(Geom_Curve)> profiles, guides;
+    for (int i = 0; i < nProfiles; ++i) {
+        double x = 10. * i / (nProfiles - 1);
+        std::vector<gp_Pnt> points;
+        for (int k = 0; k < nGuides; ++k) {
+            double phi = M_PI * k / (nGuides - 1);
+            points.push_back(gp_Pnt(x, cos(phi), sin(phi)));
+        }
+        profiles.push_back(tigl::CTiglPointsToBSplineInterpolation(OccArray(points)).Curve());
+    }
+    for (int k = 0; k < nGuides; ++k) {
+        double phi = M_PI * k / (nGuides - 1);
+        std::vector<gp_Pnt> points;
+        for (int i = 0; i < nProfiles; ++i) {
+            points.push_back(gp_Pnt(10. * i / (nProfiles - 1), cos(phi), sin(phi)));
+        }
+        guides.push_back(tigl::CTiglPointsToBSplineInterpolation(OccArray(points)).Curve());
+    }
+
+    tigl::CTiglInterpolateCurveNetwork serialNetwork(profiles, guides, 3e-4);
+    serialNetwork.SetParallel(false);
+    auto start = std::chrono::steady_clock::now();
+    Handle(Geom_BSplineSurface) serial = serialNetwork.Surface();
+    auto stop = std::chrono::steady_clock::now();
+    std::cout << "Time curve network " << nProfiles << "x" << nGuides << " serial [ms]: "
+              << std::chrono::duration<double, std::milli>(stop - start).count() << std::endl;
+
+    // the thread count is controlled by the OpenCASCADE thread pool
+    const bool useOcctThreads = OSD_Parallel::ToUseOcctThreads();
+    OSD_Parallel::SetUseOcctThreads(true);
+    const Handle(OSD_ThreadPool)& pool = OSD_ThreadPool::DefaultPool();
+    const int defaultNbThreads = pool->NbThreads();
+    const int maxThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+
+    for (int nthreads = 1; nthreads <= maxThreads; nthreads *= 2) {
+        pool->Init(nthreads);
+
+        start = std::chrono::steady_clock::now();
+        Handle(Geom_BSplineSurface) parallel = tigl::CTiglInterpolateCurveNetwork(profiles, guides, 3e-4).Surface();
+        stop = std::chrono::steady_clock::now();
+        std::cout << "Time curve network " << nProfiles << "x" << nGuides << " with " << nthreads << " threads [ms]: "
+                  << std::chrono::duration<double, std::milli>(stop - start).count() << std::endl;
+
+        ASSERT_EQ(serial->NbUPoles(), parallel->NbUPoles());
+        ASSERT_EQ(serial->NbVPoles(), parallel->NbVPoles());
+        for (int i = 1; i <= serial->NbUPoles(); ++i) {
+            for (int j = 1; j <= serial->NbVPoles(); ++j) {
+                EXPECT_EQ(0., serial->Pole(i, j).Distance(parallel->Pole(i, j)));
+            }
+        }
+    }
+
+    pool->Init(defaultNbThreads);
+    OSD_Parallel::SetUseOcctThreads(useOcctThreads);
+}
+
+TEST_F(TestPerformance, intersectBSplinesCurveNetworks)
+{
+    auto readCurves = [](const std::string& filename) {
+        TopoDS_Shape shape;
+        BRep_Builder builder;
+        BRepTools::Read(shape, filename.c_str(), builder);
+
+        std::vector<Handle(Geom_BSplineCurve)> curves;
+        for (TopExp_Explorer explorer(shape, TopAbs_EDGE); explorer.More(); explorer.Next()) {
+            double first = 0., last = 1.;
+            Handle(Geom_Curve) curve = BRep_Tool::Curve(TopoDS::Edge(explorer.Current()), first, last);
+            curves.push_back(GeomConvert::CurveToBSplineCurve(curve));
+        }
+        return curves;
+    };
+
+    const char* networks[] = {"nacelle", "full_nacelle", "wing2", "spiralwing", "test_surface4", "wing3",
+                              "bellyfairing", "helibody", "fuselage1", "fuselage2", "ffd"};
+
+    double timeSubdivision = 0., timeTrimming = 0.;
+    int nPairs = 0, nDifferent = 0;
+    for (const char* network : networks) {
+        std::string path = std::string("TestData/CurveNetworks/") + network;
+        auto profiles = readCurves(path + "/profiles.brep");
+        auto guides = readCurves(path + "/guides.brep");
+
+        for (const auto& profile : profiles) {
+            for (const auto& guide : guides) {
+                // same tolerance as in CTiglBSplineAlgorithms::intersections
+                double tolerance = 3e-4 * 0.5 * (tigl::CTiglBSplineAlgorithms::scale(profile) + tigl::CTiglBSplineAlgorithms::scale(guide));
+
+                auto start = std::chrono::steady_clock::now();
+                auto results = tigl::IntersectBSplines(profile, guide, tolerance);
+                auto stop = std::chrono::steady_clock::now();
+                timeSubdivision += std::chrono::duration<double, std::milli>(stop - start).count();
+
+                start = std::chrono::steady_clock::now();
+                auto reference = tigl::IntersectBSplinesByTrimming(profile, guide, tolerance);
+                stop = std::chrono::steady_clock::now();
+                timeTrimming += std::chrono::duration<double, std::milli>(stop - start).count();
+
+                nPairs++;
+                if (reference.size() != results.size()) {
+                    nDifferent++;
+                }
+                for (const auto& result : results) {
+                    EXPECT_LE(profile->Value(result.parmOnCurve1).Distance(guide->Value(result.parmOnCurve2)), tolerance) << network;
+                }
+            }
+        }
+    }
+
+    std::cout << "Time intersect curve networks [ms]: Bezier subdivision " << timeSubdivision
+              << ", trimming " << timeTrimming
+              << " (" << nDifferent << " of " << nPairs << " pairs with a different number of intersections)" << std::endl;
+}
+
+TEST_F(TestPerformance, cstCurveBuilder)
+{
+    std::vector<double> B = {0.15, 0.2, 0.18, 0.25, 0.1, 0.12, 0.2, 0.15};
+    const int nProfiles = 50;
+
+    // different coefficients, each curve is approximated
+    tigl::CCSTCurveBuilder::ClearCache();
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < nProfiles; ++i) {
+        tigl::CCSTCurveBuilder(0.5, 1.0, B, 0.001 * i).Curve();
+    }
+    auto stop = std::chrono::steady_clock::now();
+    std::cout << "Time build " << nProfiles << " CST curves [ms]: "
+              << std::chrono::duration<double, std::milli>(stop - start).count() << std::endl;
+
+    // same coefficients again, the curves are taken from the cache
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < nProfiles; ++i) {
+        tigl::CCSTCurveBuilder(0.5, 1.0, B, 0.001 * i).Curve();
+    }
+    stop = std::chrono::steady_clock::now();
+    std::cout << "Time build " << nProfiles << " cached CST curves [ms]: "
+              << std::chrono::duration<double, std::milli>(stop - start).count() << std::endl;
+    EXPECT_EQ(static_cast<size_t>(nProfiles), tigl::CCSTCurveBuilder::CacheSize());
+
+    // evaluation of the CST function
+    std::vector<double> x;
+    for (int i = 0; i <= 100000; ++i) {
+        x.push_back(i / 100000.);
+    }
+    double sum = 0.;
+    start = std::chrono::steady_clock::now();
+    for (double xi : x) {
+        sum += tigl::cstcurve(0.5, 1.0, B, 0., xi);
+    }
+    stop = std::chrono::steady_clock::now();
+    double timeScalar = std::chrono::duration<double, std::milli>(stop - start).count();
+
+    start = std::chrono::steady_clock::now();
+    std::vector<double> values = tigl::cstcurve(0.5, 1.0, B, 0., x);
+    stop = std::chrono::steady_clock::now();
+    std::cout << "Time evaluate CST function at " << x.size() << " points [ms]: scalar " << timeScalar
+              << ", vectorized " << std::chrono::duration<double, std::milli>(stop - start).count() << std::endl;
+
+    double sumVectorized = 0.;
+    for (double v : values) {
+        sumVectorized += v;
+    }
+    EXPECT_NEAR(sum, sumVectorized, 1e-8 * std::fabs(sum));
+
+    tigl::CCSTCurveBuilder::ClearCache();
+}
+
 // diesen Block in testperformance.cpp schieben
 TEST_F(TestPerformance, area_computations_fused_airplane_performance )
 {
@@ -35,6 +35,7 @@
 #include <cmath>
 #include <math_Matrix.hxx>
 #include "CTiglBSplineFit.h"
+#include "CTiglSparseMatrix.h"
 #include "CTiglPointsToBSplineInterpolation.h"
 #include "CTiglInterpolatePointsWithKinks.h"
 #include "tiglcommonfunctions.h"
@@ -859,3 +860,168 @@ TEST_F(BSplineInterpolation, errorParamsNotResized)
     
     StoreResult("TestData/analysis/BSplineFit-errorParamsNotResized.brep", fit.Curve(), pnts);
 }
+
+namespace
+{
+    // densely sampled, closed airfoil-like profile
+    TColgp_Array1OfPnt densePointListProfile(int nPoints)
+    {
+        TColgp_Array1OfPnt profile(1, nPoints);
+        for (int i = 0; i < nPoints; ++i) {
+            double phi = 2. * M_PI * i / static_cast<double>(nPoints - 1);
+            double x = 0.5 * (1. + cos(phi));
+            double z = 0.6 * (0.2969*sqrt(x) - 0.126*x - 0.3516*x*x + 0.2843*x*x*x - 0.1036*x*x*x*x);
+            profile.SetValue(i + 1, gp_Pnt(x, 0., sin(phi) >= 0. ? z : -z));
+        }
+        return profile;
+    }
+
+    double maxPoleDistance(const Handle(Geom_BSplineCurve)& c1, const Handle(Geom_BSplineCurve)& c2)
+    {
+        EXPECT_EQ(c1->NbPoles(), c2->NbPoles());
+        double maxDist = 0.;
+        for (int i = 1; i <= std::min(c1->NbPoles(), c2->NbPoles()); ++i) {
+            maxDist = std::max(maxDist, c1->Pole(i).Distance(c2->Pole(i)));
+        }
+        return maxDist;
+    }
+}
+
+TEST_F(BSplineInterpolation, bandedSolverMatchesDense)
+{
+    tigl::CTiglBSplineApproxInterp app(pnts, 30, 3);
+    app.InterpolatePoint(0);
+    app.InterpolatePoint(50);
+    app.InterpolatePoint(100);
+    tigl::CTiglApproxResult banded = app.FitCurve(parms);
+
+    app.SetUseDenseSolver(true);
+    tigl::CTiglApproxResult dense = app.FitCurve(parms);
+
+    EXPECT_NEAR(0., maxPoleDistance(banded.curve, dense.curve), 1e-10);
+    EXPECT_NEAR(dense.error, banded.error, 1e-10);
+}
+
+TEST(BSplines, bandedSolverMatchesDenseClosedProfile)
+{
+    TColgp_Array1OfPnt profile = densePointListProfile(501);
+
+    // closed and C2 continuous with an interpolated trailing edge
+    tigl::CTiglBSplineApproxInterp app(profile, 80, 3, true);
+    app.InterpolatePoint(0);
+    app.InterpolatePoint(250);
+    app.InterpolatePoint(500);
+    tigl::CTiglApproxResult banded = app.FitCurveOptimal();
+
+    app.SetUseDenseSolver(true);
+    tigl::CTiglApproxResult dense = app.FitCurveOptimal();
+
+    EXPECT_NEAR(0., maxPoleDistance(banded.curve, dense.curve), 1e-8);
+    EXPECT_NEAR(dense.error, banded.error, 1e-8);
+    EXPECT_LT(banded.error, 1e-3);
+
+    // the fit without constraints
+    BSplineFit fit(3, 80);
+    ASSERT_EQ(BSplineFit::NoError, fit.Fit(profile, 0.5));
+    Handle(Geom_BSplineCurve) bandedFit = fit.Curve();
+
+    fit.SetUseDenseSolver(true);
+    ASSERT_EQ(BSplineFit::NoError, fit.Fit(profile, 0.5));
+    EXPECT_NEAR(0., maxPoleDistance(bandedFit, fit.Curve()), 1e-10);
+}
+
+TEST(BSplines, bSplineFitDenseFallback)
+{
+    // The parameters are clustered at both ends, such that the knot spans
+    // in the middle contain no parameters. The band factorization fails
+    // and the fit falls back to the dense solver.
+    std::vector<double> params;
+    TColgp_Array1OfPnt pnts(1, 20);
+    for (int i = 0; i < 10; ++i) {
+        double t = 0.01 * i;
+        params.push_back(t);
+        pnts.SetValue(i + 1, gp_Pnt(t, sin(t), 0.));
+    }
+    for (int i = 0; i < 10; ++i) {
+        double t = 0.91 + 0.01 * i;
+        params.push_back(t);
+        pnts.SetValue(i + 11, gp_Pnt(t, sin(t), 0.));
+    }
+
+    // 12 control points, i.e. 9 uniform knot spans of width 1/9
+    BSplineFit fit(3, 12);
+    BSplineFit::error bandedError = fit.Fit(pnts, params);
+
+    fit.SetUseDenseSolver(true);
+    BSplineFit::error denseError = fit.Fit(pnts, params);
+
+    // the fallback must solve the original system and not the partially factorized one
+    EXPECT_EQ(denseError, bandedError);
+    EXPECT_EQ(BSplineFit::MatrixSingular, bandedError);
+
+    // with evenly distributed parameters, the same fit succeeds again
+    for (int i = 0; i < 20; ++i) {
+        params[i] = i / 19.;
+        pnts.SetValue(i + 1, gp_Pnt(params[i], sin(params[i]), 0.));
+    }
+    fit.SetUseDenseSolver(false);
+    ASSERT_EQ(BSplineFit::NoError, fit.Fit(pnts, params));
+    Handle(Geom_BSplineCurve) bandedFit = fit.Curve();
+    fit.SetUseDenseSolver(true);
+    ASSERT_EQ(BSplineFit::NoError, fit.Fit(pnts, params));
+    EXPECT_NEAR(0., maxPoleDistance(bandedFit, fit.Curve()), 1e-10);
+    EXPECT_LT(fit.GetMaxError(), 1e-4);
+}
+
+TEST(BSplines, bSplineMatSparse)
+{
+    TColgp_Array1OfPnt profile = densePointListProfile(101);
+    std::vector<double> params;
+    for (int i = 0; i < profile.Length(); ++i) {
+        params.push_back(static_cast<double>(i) / (profile.Length() - 1));
+    }
+    std::vector<double> flatKnots = tigl::CTiglBSplineAlgorithms::knotsFromCurveParameters(params, 3, false);
+
+    for (unsigned int derivOrder = 0; derivOrder <= 2; ++derivOrder) {
+        tigl::CTiglSparseMatrix sparse = tigl::CTiglBSplineAlgorithms::bsplineBasisMatSparse(3, OccFArray(flatKnots)->Array1(), OccFArray(params)->Array1(), derivOrder);
+        math_Matrix dense = sparse.ToDense();
+        EXPECT_EQ(4 * profile.Length(), sparse.NonZeros());
+        EXPECT_EQ(3, sparse.RowSpread());
+
+        // each row evaluates the basis functions at one parameter
+        for (int iParam = 1; iParam <= profile.Length(); ++iParam) {
+            double sum = 0.;
+            for (int icp = 1; icp <= dense.ColNumber(); ++icp) {
+                sum += dense(iParam, icp);
+            }
+            EXPECT_NEAR(derivOrder == 0 ? 1. : 0., sum, 1e-8);
+        }
+    }
+}
+
+TEST(BSplines, interpolateManyPointsClosed)
+{
+    // closed curves wrap the first control points, which are outside of the band of the collocation matrix
+    const int nPoints = 1001;
+    std::vector<gp_Pnt> points;
+    std::vector<double> params;
+    for (int i = 0; i < nPoints; ++i) {
+        double t = static_cast<double>(i) / (nPoints - 1);
+        points.push_back(gp_Pnt(cos(2. * M_PI * t), 0.3 * sin(4. * M_PI * t), sin(2. * M_PI * t)));
+        params.push_back(t);
+    }
+
+    tigl::CTiglPointsToBSplineInterpolation interpolation(points, params, 3, true);
+    Handle(Geom_BSplineCurve) curve = interpolation.Curve();
+    for (int i = 0; i < nPoints; ++i) {
+        EXPECT_NEAR(0., curve->Value(params[i]).Distance(points[i]), 1e-10);
+    }
+
+    // C2 continuous closing
+    gp_Pnt p1, p2;
+    gp_Vec d11, d12, d21, d22;
+    curve->D2(curve->FirstParameter(), p1, d11, d12);
+    curve->D2(curve->LastParameter(), p2, d21, d22);
+    EXPECT_TRUE(d11.IsEqual(d21, 1e-8, 1e-8));
+    EXPECT_TRUE(d12.IsEqual(d22, 1e-6, 1e-6));
+}
@@ -0,0 +1,96 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "CTiglBoundingVolumeHierarchy.h"
+#include "test.h"
+
+#include <vector>
+
+namespace
+{
+    // unit cubes along the x axis, with a gap of 1 between them
+    std::vector<Bnd_Box> makeBoxes(int n)
+    {
+        std::vector<Bnd_Box> boxes(n);
+        for (int i = 0; i < n; ++i) {
+            boxes[i].Update(2.*i, 0., 0., 2.*i + 1., 1., 1.);
+        }
+        return boxes;
+    }
+}
+
+TEST(BoundingVolumeHierarchy, FindNear)
+{
+    tigl::CTiglBoundingVolumeHierarchy bvh(makeBoxes(100));
+    ASSERT_EQ(100, bvh.Size());
+
+    // inside box 10
+    std::vector<size_t> result = bvh.FindNear(gp_Pnt(20.5, 0.5, 0.5));
+    ASSERT_EQ(1, result.size());
+    EXPECT_EQ(10, result[0]);
+
+    // in the gap between box 10 and 11, closer to 11
+    result = bvh.FindNear(gp_Pnt(21.6, 0.5, 0.5), 0.7);
+    ASSERT_EQ(2, result.size());
+    EXPECT_EQ(11, result[0]);
+    EXPECT_EQ(10, result[1]);
+
+    // far away
+    EXPECT_TRUE(bvh.FindNear(gp_Pnt(20.5, 10., 0.5), 1.).empty());
+}
+
+TEST(BoundingVolumeHierarchy, FindIntersecting)
+{
+    tigl::CTiglBoundingVolumeHierarchy bvh(makeBoxes(100));
+
+    Bnd_Box query;
+    query.Update(9.5, 0.5, 0.5, 14.5, 0.6, 0.6);
+    std::vector<size_t> result = bvh.FindIntersecting(query);
+    ASSERT_EQ(3, result.size());
+    EXPECT_EQ(5, result[0]);
+    EXPECT_EQ(6, result[1]);
+    EXPECT_EQ(7, result[2]);
+
+    EXPECT_TRUE(bvh.FindIntersecting(Bnd_Box()).empty());
+}
+
+TEST(BoundingVolumeHierarchy, FindAlongRay)
+{
+    tigl::CTiglBoundingVolumeHierarchy bvh(makeBoxes(100));
+
+    // ray in negative x direction, starting inside box 3
+    std::vector<size_t> result = bvh.FindAlongRay(gp_Pnt(6.5, 0.5, 0.5), gp_Dir(-1., 0., 0.));
+    ASSERT_EQ(4, result.size());
+    for (size_t i = 0; i < result.size(); ++i) {
+        EXPECT_EQ(i, result[i]);
+    }
+
+    // ray pointing away from the boxes
+    EXPECT_TRUE(bvh.FindAlongRay(gp_Pnt(6.5, 2., 0.5), gp_Dir(0., 1., 0.)).empty());
+
+    // oblique ray crossing box 50 only
+    result = bvh.FindAlongRay(gp_Pnt(100.5, -1., 0.5), gp_Dir(0., 1., 0.1));
+    ASSERT_EQ(1, result.size());
+    EXPECT_EQ(50, result[0]);
+}
+
+TEST(BoundingVolumeHierarchy, Empty)
+{
+    tigl::CTiglBoundingVolumeHierarchy bvh;
+    EXPECT_EQ(0, bvh.Size());
+    EXPECT_TRUE(bvh.FindNear(gp_Pnt(0., 0., 0.), 1.).empty());
+    EXPECT_TRUE(bvh.GetBoundingBox().IsVoid());
+}
@@ -27,6 +27,8 @@
 
 #include <gp_Pln.hxx>
 #include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakePrism.hxx>
+#include <BRepBuilderAPI_MakePolygon.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
 #include <BRepBuilderAPI_MakeEdge.hxx>
 #include <BRepBuilderAPI_MakeFace.hxx>
@@ -145,6 +147,34 @@ TEST(TiglCommonFunctions, tiglCheckPointInside_api)
 
 }
 
+TEST(TiglCommonFunctions, tiglCheckPointsInside_api)
+{
+    TiglHandleWrapper tiglSimpleWingHandle("TestData/simpletest.cpacs.xml", "Cpacs2Test");
+
+    const char* uid = "segmentD150_Fuselage_1Segment2ID";
+    double px[4] = {0., 0., 0.1, 0.};
+    double py[4] = {0., 0., 0.1, 0.};
+    double pz[4] = {0., 2., 0.1, -3.};
+    TiglBoolean isInside[4];
+
+    ASSERT_EQ(TIGL_SUCCESS, tiglCheckPointsInside(tiglSimpleWingHandle, uid, 4, px, py, pz, isInside));
+    for (int i = 0; i < 4; ++i) {
+        TiglBoolean expected = TIGL_FALSE;
+        ASSERT_EQ(TIGL_SUCCESS, tiglCheckPointInside(tiglSimpleWingHandle, px[i], py[i], pz[i], uid, &expected));
+        EXPECT_EQ(expected, isInside[i]);
+    }
+    EXPECT_EQ(TIGL_TRUE, isInside[0]);
+    EXPECT_EQ(TIGL_FALSE, isInside[1]);
+
+    // test errors
+    EXPECT_EQ(TIGL_UID_ERROR, tiglCheckPointsInside(tiglSimpleWingHandle, "wrongUID", 4, px, py, pz, isInside));
+    EXPECT_EQ(TIGL_NOT_FOUND, tiglCheckPointsInside(-1, uid, 4, px, py, pz, isInside));
+    EXPECT_EQ(TIGL_NULL_POINTER, tiglCheckPointsInside(tiglSimpleWingHandle, nullptr, 4, px, py, pz, isInside));
+    EXPECT_EQ(TIGL_NULL_POINTER, tiglCheckPointsInside(tiglSimpleWingHandle, uid, 4, px, nullptr, pz, isInside));
+    EXPECT_EQ(TIGL_NULL_POINTER, tiglCheckPointsInside(tiglSimpleWingHandle, uid, 4, px, py, pz, nullptr));
+    EXPECT_EQ(TIGL_ERROR, tiglCheckPointsInside(tiglSimpleWingHandle, uid, -1, px, py, pz, isInside));
+}
+
 TEST(TiglCommonFuctions, ApproximateArcOfCircleToRationalBSpline)
 {
     //test valid curves
@@ -390,6 +420,24 @@ TEST(TiglCommonFunctions, IsPointAbovePlane)
     EXPECT_FALSE(IsPointAbovePlane(xy, gp_Pnt(0., 0.,  0.)));
 }
 
+TEST(TiglCommonFunctions, IsSymmetricToXZPlane)
+{
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(gp_Pnt(0., -1., 0.), gp_Pnt(2., 1., 1.)).Shape();
+    EXPECT_TRUE(IsSymmetricToXZPlane(box, 1e-6));
+
+    TopoDS_Shape shiftedBox = BRepPrimAPI_MakeBox(gp_Pnt(0., -1., 0.), gp_Pnt(2., 1.1, 1.)).Shape();
+    EXPECT_FALSE(IsSymmetricToXZPlane(shiftedBox, 1e-6));
+
+    // the prism of a parallelogram has a symmetric bounding box and its center
+    // at y = 0, but it is not mirror symmetric
+    TopoDS_Wire parallelogram = BRepBuilderAPI_MakePolygon(gp_Pnt(-1., -1., 0.), gp_Pnt(0., -1., 0.),
+                                                           gp_Pnt(1., 1., 0.), gp_Pnt(0., 1., 0.), Standard_True).Wire();
+    TopoDS_Shape prism = BRepPrimAPI_MakePrism(BRepBuilderAPI_MakeFace(parallelogram).Face(), gp_Vec(0., 0., 1.)).Shape();
+    EXPECT_FALSE(IsSymmetricToXZPlane(prism, 1e-6));
+
+    EXPECT_FALSE(IsSymmetricToXZPlane(TopoDS_Shape(), 1e-6));
+}
+
 TEST(TiglCommonFunctions, projectPointOnPlane)
 {
     gp_Pnt p(0,0,1);
@@ -32,10 +32,29 @@
 #include "CTiglExporterFactory.h"
 #include "CGlobalExporterConfigs.h"
 #include "CTiglExportIges.h"
+#include "CTiglExportGltf.h"
+#include "CTiglExportStl.h"
 
+#include "CTiglUIDManager.h"
+#include "CTiglFusePlane.h"
+
+#include "BRepAlgoAPI_Cut.hxx"
+#include "BRepAlgoAPI_Section.hxx"
+#include "BRepGProp.hxx"
+#include "GProp_GProps.hxx"
 #include "TopExp.hxx"
 #include "TopTools_IndexedMapOfShape.hxx"
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
 
 /******************************************************************************/
 
@@ -278,6 +297,56 @@ TEST_F(tiglExport, export_wing_collada_success)
     ASSERT_EQ(TIGL_SUCCESS, tiglExportComponent(tiglHandle, "D150_VAMP_W1",  "TestData/export/D150modelID_wing1_new.dae", 0.001));
 }
 
+TEST_F(tiglExport, fused_intersections_match_serial_sections)
+{
+    tigl::CCPACSConfiguration& config = tigl::CCPACSConfigurationManager::GetInstance().GetConfiguration(tiglHandle);
+    tigl::PTiglFusePlane fuser = config.AircraftFusingAlgo();
+    fuser->SetResultMode(tigl::HALF_PLANE);
+    const ListPNamedShape& intersections = fuser->Intersections();
+
+    // reference: section every pair and cut the result with every other component
+    ListPNamedShape components;
+    const tigl::RelativeComponentContainerType& relComps = config.GetUIDManager().GetRelativeComponents();
+    for (tigl::RelativeComponentContainerType::const_iterator it = relComps.begin(); it != relComps.end(); ++it) {
+        TiglGeometricComponentType type = it->second->GetComponentType();
+        if (type != TIGL_COMPONENT_DUCT && type != TIGL_COMPONENT_DECK && type != TIGL_COMPONENT_DECK_COMPONENT) {
+            PNamedShape loft = it->second->GetLoft();
+            if (loft) {
+                components.push_back(loft);
+            }
+        }
+    }
+
+    size_t iIntersection = 0;
+    for (size_t i = 0; i < components.size(); ++i) {
+        for (size_t j = i + 1; j < components.size(); ++j) {
+            BRepAlgoAPI_Section section(components[i]->Shape(), components[j]->Shape());
+            ASSERT_TRUE(section.IsDone());
+            TopoDS_Shape reference = section.Shape();
+            for (size_t k = 0; k < components.size(); ++k) {
+                if (k != i && k != j) {
+                    reference = BRepAlgoAPI_Cut(reference, components[k]->Shape());
+                }
+            }
+
+            ASSERT_LT(iIntersection, intersections.size());
+            const PNamedShape& intersection = intersections[iIntersection++];
+            EXPECT_EQ("INT" + components[i]->Name() + components[j]->Name(), intersection->Name());
+
+            TopTools_IndexedMapOfShape referenceEdges, edges;
+            TopExp::MapShapes(reference, TopAbs_EDGE, referenceEdges);
+            TopExp::MapShapes(intersection->Shape(), TopAbs_EDGE, edges);
+            EXPECT_EQ(referenceEdges.Extent(), edges.Extent()) << intersection->Name();
+
+            GProp_GProps referenceProps, props;
+            BRepGProp::LinearProperties(reference, referenceProps);
+            BRepGProp::LinearProperties(intersection->Shape(), props);
+            EXPECT_NEAR(referenceProps.Mass(), props.Mass(), 1e-6 * (1. + referenceProps.Mass())) << intersection->Name();
+        }
+    }
+    EXPECT_EQ(iIntersection, intersections.size());
+}
+
 TEST_F(tiglExportSimple, export_wing_collada)
 {
     tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
@@ -317,6 +386,23 @@ TEST_F(tiglExportSimple, export_wing_vtk_newapi_meta)
     ASSERT_EQ(true, ret);
 }
 
+TEST_F(tiglExportSimple, export_wing_vtk_newapi_binary)
+{
+    tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
+    tigl::CCPACSConfiguration & config = manager.GetConfiguration(tiglSimpleHandle);
+    tigl::CCPACSWing& wing = config.GetWing(1);
+
+    tigl::VtkOptions options;
+    options.Set("DataFormat", tigl::VtkAppendedBase64);
+    options.Set("Compression", true);
+
+    tigl::CTiglExportVtk vtkWriter(options);
+    vtkWriter.AddShape(wing.GetLoft(), &config, tigl::TriangulatedExportOptions(0.001));
+    bool ret = vtkWriter.Write("TestData/export/simpletest_wing_meta_binary.vtp");
+
+    ASSERT_EQ(true, ret);
+}
+
 TEST_F(tiglExportSimple, export_fusedplane_vtk_newapi_meta)
 {
     tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
@@ -356,6 +442,379 @@ TEST_F(tiglExportSimple, export_generic_stl)
     ASSERT_EQ(true, ret);
 }
 
+namespace
+{
+    uint32_t readUInt(const std::string& data, size_t pos)
+    {
+        uint32_t value = 0;
+        for (int i = 3; i >= 0; --i) {
+            value = (value << 8) | static_cast<unsigned char>(data[pos + i]);
+        }
+        return value;
+    }
+
+    size_t countOccurences(const std::string& text, const std::string& pattern)
+    {
+        size_t count = 0;
+        for (size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1)) {
+            count++;
+        }
+        return count;
+    }
+}
+
+TEST_F(tiglExportSimple, export_gltf)
+{
+    tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
+    tigl::CCPACSConfiguration & config = manager.GetConfiguration(tiglSimpleHandle);
+
+    tigl::PTiglCADExporter gltfExporter = tigl::CTiglExporterFactory::Instance().Create("glb");
+    ASSERT_TRUE(gltfExporter != nullptr);
+    ASSERT_TRUE(gltfExporter->AddConfiguration(config, tigl::TriangulatedExportOptions(0.01)));
+    ASSERT_TRUE(gltfExporter->Write("TestData/export/simpletest_export.glb"));
+
+    std::ifstream file("TestData/export/simpletest_export.glb", std::ios::binary);
+    std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    ASSERT_GT(data.size(), 20u);
+
+    // header
+    EXPECT_EQ(0, std::memcmp(data.data(), "glTF", 4));
+    EXPECT_EQ(2u, readUInt(data, 4));
+    EXPECT_EQ(data.size(), readUInt(data, 8));
+
+    // json chunk, followed by the binary chunk
+    uint32_t jsonLength = readUInt(data, 12);
+    EXPECT_EQ(0, std::memcmp(data.data() + 16, "JSON", 4));
+    EXPECT_EQ(0u, jsonLength % 4);
+    ASSERT_LT(20u + jsonLength + 8u, data.size());
+    EXPECT_EQ(0, std::memcmp(data.data() + 20 + jsonLength + 4, "BIN\0", 4));
+    EXPECT_EQ(data.size() - 28 - jsonLength, readUInt(data, 20 + jsonLength));
+
+    std::string json = data.substr(20, jsonLength);
+    EXPECT_NE(std::string::npos, json.find("\"name\":\"Wing\""));
+    EXPECT_NE(std::string::npos, json.find("\"name\":\"Wing:mirrored\""));
+    EXPECT_NE(std::string::npos, json.find("\"componentUID\":\"Wing\""));
+
+    // the mirrored wing reuses the mesh of the wing
+    size_t nMeshes = countOccurences(json, "\"primitives\"");
+    size_t nNodes = countOccurences(json, "\"extras\"");
+    EXPECT_EQ(gltfExporter->NShapes(), nNodes);
+    EXPECT_EQ(nNodes - 1, nMeshes);
+}
+
+TEST_F(tiglExportSimple, export_gltf_no_instancing)
+{
+    tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
+    tigl::CCPACSConfiguration & config = manager.GetConfiguration(tiglSimpleHandle);
+
+    tigl::GltfOptions options;
+    options.Set("Instancing", false);
+
+    tigl::CTiglExportGltf gltfExporter(options);
+    ASSERT_TRUE(gltfExporter.AddConfiguration(config, tigl::TriangulatedExportOptions(0.01)));
+
+    std::ostringstream stream;
+    ASSERT_TRUE(gltfExporter.Write(stream));
+    std::string json = stream.str().substr(20, readUInt(stream.str(), 12));
+    EXPECT_EQ(gltfExporter.NShapes(), countOccurences(json, "\"primitives\""));
+}
+
+TEST_F(tiglExportSimple, export_stl_binary)
+{
+    tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
+    tigl::CCPACSConfiguration & config = manager.GetConfiguration(tiglSimpleHandle);
+
+    tigl::StlOptions options;
+    options.Set("Binary", true);
+
+    tigl::CTiglExportStl stlExporter(options);
+    stlExporter.AddConfiguration(config, tigl::TriangulatedExportOptions(0.01));
+    ASSERT_TRUE(stlExporter.Write("TestData/export/simpletest_export_binary.stl"));
+
+    std::ifstream file("TestData/export/simpletest_export_binary.stl", std::ios::binary);
+    std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    ASSERT_GT(data.size(), 84u);
+
+    // 80 bytes header, triangle count and 50 bytes per triangle
+    EXPECT_NE(0, std::memcmp(data.data(), "solid", 5));
+    uint32_t nTriangles = readUInt(data, 80);
+    EXPECT_GT(nTriangles, 0u);
+    EXPECT_EQ(84u + 50u * nTriangles, data.size());
+}
+
+TEST_F(tiglExportSimple, export_stl_solid_per_component)
+{
+    tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
+    tigl::CCPACSConfiguration & config = manager.GetConfiguration(tiglSimpleHandle);
+
+    tigl::StlOptions options;
+    options.Set("SolidPerComponent", true);
+
+    tigl::CTiglExportStl stlExporter(options);
+    stlExporter.AddConfiguration(config, tigl::TriangulatedExportOptions(0.01));
+    ASSERT_TRUE(stlExporter.Write("TestData/export/simpletest_export_components.stl"));
+
+    std::ifstream file("TestData/export/simpletest_export_components.stl");
+    std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    EXPECT_EQ(stlExporter.NShapes(), countOccurences(data, "endsolid "));
+    EXPECT_NE(std::string::npos, data.find("solid SimpleFuselage\n"));
+    EXPECT_NE(std::string::npos, data.find("solid Wing\n"));
+    EXPECT_NE(std::string::npos, data.find("solid Wing:mirrored\n"));
+}
+
+TEST_F(tiglExportSimple, export_stl_file_per_component)
+{
+    tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
+    tigl::CCPACSConfiguration & config = manager.GetConfiguration(tiglSimpleHandle);
+
+    tigl::StlOptions options;
+    options.Set("Binary", true);
+    options.Set("FilePerComponent", true);
+
+    tigl::CTiglExportStl stlExporter(options);
+    stlExporter.AddFusedConfiguration(config, tigl::TriangulatedExportOptions(0.01));
+    ASSERT_TRUE(stlExporter.Write("TestData/export/simpletest_fused.stl"));
+
+    // the mirrored wing has the same component uid as the wing
+    const char* files[] = {
+        "TestData/export/simpletest_fused_SimpleFuselage.stl",
+        "TestData/export/simpletest_fused_Wing.stl"
+    };
+    for (const char* filename : files) {
+        std::ifstream file(filename, std::ios::binary);
+        std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        ASSERT_GT(data.size(), 84u) << filename;
+        EXPECT_EQ(84u + 50u * readUInt(data, 80), data.size()) << filename;
+    }
+}
+
+TEST_F(tiglExportSimple, export_stl_levels_of_detail)
+{
+    tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
+    tigl::CCPACSConfiguration & config = manager.GetConfiguration(tiglSimpleHandle);
+
+    tigl::StlOptions options;
+    options.Set("Binary", true);
+    options.Set("LevelsOfDetail", std::string("0.1; 0.01"));
+
+    tigl::CTiglExportStl stlExporter(options);
+    stlExporter.AddConfiguration(config, tigl::TriangulatedExportOptions(0.001));
+    ASSERT_TRUE(stlExporter.Write("TestData/export/simpletest_lod.stl"));
+
+    // the levels are sorted from fine to coarse
+    const char* files[] = {
+        "TestData/export/simpletest_lod.stl",
+        "TestData/export/simpletest_lod_lod1.stl",
+        "TestData/export/simpletest_lod_lod2.stl"
+    };
+    uint32_t nPreviousTriangles = 0;
+    for (const char* filename : files) {
+        std::ifstream file(filename, std::ios::binary);
+        std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        ASSERT_GT(data.size(), 84u) << filename;
+
+        uint32_t nTriangles = readUInt(data, 80);
+        EXPECT_GT(nTriangles, 0u) << filename;
+        EXPECT_EQ(84u + 50u * nTriangles, data.size()) << filename;
+        if (nPreviousTriangles > 0) {
+            EXPECT_LT(nTriangles, nPreviousTriangles) << filename;
+        }
+        nPreviousTriangles = nTriangles;
+    }
+}
+
+TEST_F(tiglExportSimple, export_wing_vtk_levels_of_detail)
+{
+    tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
+    tigl::CCPACSConfiguration & config = manager.GetConfiguration(tiglSimpleHandle);
+    tigl::CCPACSWing& wing = config.GetWing(1);
+
+    tigl::VtkOptions options;
+    options.Set("LevelsOfDetail", std::string("0.01;0.1"));
+
+    // all levels as pieces of one file
+    tigl::CTiglExportVtk vtkWriter(options);
+    vtkWriter.AddShape(wing.GetLoft(), &config, tigl::TriangulatedExportOptions(0.001));
+    ASSERT_TRUE(vtkWriter.Write("TestData/export/simpletest_wing_lod.vtp"));
+
+    std::ifstream file("TestData/export/simpletest_wing_lod.vtp");
+    std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    EXPECT_EQ(3u, countOccurences(data, "<Piece "));
+
+    // one file per level
+    options.Set("LevelsOfDetailAsFiles", true);
+    tigl::CTiglExportVtk vtkFileWriter(options);
+    vtkFileWriter.AddShape(wing.GetLoft(), &config, tigl::TriangulatedExportOptions(0.001));
+    ASSERT_TRUE(vtkFileWriter.Write("TestData/export/simpletest_wing_lodfiles.vtp"));
+    EXPECT_TRUE(std::ifstream("TestData/export/simpletest_wing_lodfiles_lod1.vtp").good());
+    EXPECT_TRUE(std::ifstream("TestData/export/simpletest_wing_lodfiles_lod2.vtp").good());
+}
+
+TEST_F(tiglExportSimple, export_wing_collada_levels_of_detail)
+{
+    tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
+    tigl::CCPACSConfiguration & config = manager.GetConfiguration(tiglSimpleHandle);
+    tigl::CCPACSWing& wing = config.GetWing(1);
+
+    tigl::ColladaOptions options;
+    options.Set("LevelsOfDetail", std::string("0.01;0.1"));
+
+    tigl::CTiglExportCollada colladaWriter(options);
+    colladaWriter.AddShape(wing.GetLoft(), tigl::TriangulatedExportOptions(0.001));
+    ASSERT_TRUE(colladaWriter.Write("TestData/export/simpletest_wing_lod.dae"));
+
+    // the levels are sorted from fine to coarse
+    const char* files[] = {
+        "TestData/export/simpletest_wing_lod.dae",
+        "TestData/export/simpletest_wing_lod_lod1.dae",
+        "TestData/export/simpletest_wing_lod_lod2.dae"
+    };
+    long nPreviousTriangles = 0;
+    for (const char* filename : files) {
+        std::ifstream file(filename);
+        std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        const std::string countTag = "<triangles count=\"";
+        size_t pos = data.find(countTag);
+        ASSERT_NE(std::string::npos, pos) << filename;
+
+        long nTriangles = std::stol(data.substr(pos + countTag.size()));
+        EXPECT_GT(nTriangles, 0) << filename;
+        if (nPreviousTriangles > 0) {
+            EXPECT_LT(nTriangles, nPreviousTriangles) << filename;
+        }
+        nPreviousTriangles = nTriangles;
+    }
+}
+
+TEST_F(tiglExportSimple, export_gltf_levels_of_detail)
+{
+    tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
+    tigl::CCPACSConfiguration & config = manager.GetConfiguration(tiglSimpleHandle);
+
+    tigl::GltfOptions options;
+    options.Set("LevelsOfDetail", std::string("0.01;0.1"));
+
+    tigl::CTiglExportGltf gltfExporter(options);
+    ASSERT_TRUE(gltfExporter.AddConfiguration(config, tigl::TriangulatedExportOptions(0.001)));
+
+    std::ostringstream stream;
+    ASSERT_TRUE(gltfExporter.Write(stream));
+    std::string json = stream.str().substr(20, readUInt(stream.str(), 12));
+    EXPECT_NE(std::string::npos, json.find("\"extensionsUsed\":[\"MSFT_lod\"]"));
+    EXPECT_NE(std::string::npos, json.find("\"name\":\"Wing (LOD 2)\""));
+
+    // each scene node references two coarser nodes, the mirrored wing reuses the meshes of the wing
+    size_t nSceneNodes = gltfExporter.NShapes();
+    EXPECT_EQ(nSceneNodes, countOccurences(json, "\"MSFT_lod\":{\"ids\":["));
+    EXPECT_EQ(3 * nSceneNodes, countOccurences(json, "\"extras\""));
+    EXPECT_EQ(3 * (nSceneNodes - 1), countOccurences(json, "\"primitives\""));
+}
+
+namespace
+{
+    struct FuseProgress
+    {
+        std::vector<double> values;
+        double cancelAt = 2.;
+        std::thread::id thread = std::this_thread::get_id();
+        bool otherThread = false;
+    };
+
+    TiglBoolean recordFuseProgress(double progress, void* userData)
+    {
+        FuseProgress* record = static_cast<FuseProgress*>(userData);
+        if (std::this_thread::get_id() != record->thread) {
+            record->otherThread = true;
+            return TIGL_TRUE;
+        }
+        record->values.push_back(progress);
+        return progress < record->cancelAt ? TIGL_TRUE : TIGL_FALSE;
+    }
+}
+
+TEST_F(tiglExportSimple, fuse_options_api)
+{
+    EXPECT_EQ(TIGL_INVALID_VALUE, tiglConfigurationSetFuseOptions(tiglSimpleHandle, TIGL_TRUE, -1., TIGL_GLUE_OFF));
+    EXPECT_EQ(TIGL_INVALID_VALUE, tiglConfigurationSetFuseOptions(tiglSimpleHandle, TIGL_TRUE, 0., static_cast<TiglFuseGlueMode>(5)));
+    EXPECT_EQ(TIGL_NOT_FOUND, tiglConfigurationSetFuseOptions(-1, TIGL_TRUE, 0., TIGL_GLUE_OFF));
+    EXPECT_EQ(TIGL_NOT_FOUND, tiglConfigurationSetFuseProgressCallback(-1, NULL, NULL));
+
+    // changing the fuzzy value discards the fused aircraft of previous tests
+    FuseProgress progress;
+    ASSERT_EQ(TIGL_SUCCESS, tiglConfigurationSetFuseOptions(tiglSimpleHandle, TIGL_TRUE, 1e-5, TIGL_GLUE_OFF));
+    ASSERT_EQ(TIGL_SUCCESS, tiglConfigurationSetFuseProgressCallback(tiglSimpleHandle, recordFuseProgress, &progress));
+    EXPECT_EQ(TIGL_SUCCESS, tiglExportFusedBREP(tiglSimpleHandle, "TestData/export/simpletest_fuzzy.brep"));
+
+    ASSERT_GE(progress.values.size(), 2u);
+    EXPECT_DOUBLE_EQ(0., progress.values.front());
+    EXPECT_DOUBLE_EQ(1., progress.values.back());
+    EXPECT_TRUE(std::is_sorted(progress.values.begin(), progress.values.end()));
+
+    // the parallel fuse reports the progress on the calling thread only
+    EXPECT_FALSE(progress.otherThread);
+
+    // cancel the fuse
+    FuseProgress cancelled;
+    cancelled.cancelAt = 0.;
+    ASSERT_EQ(TIGL_SUCCESS, tiglConfigurationSetFuseOptions(tiglSimpleHandle, TIGL_FALSE, 0., TIGL_GLUE_OFF));
+    ASSERT_EQ(TIGL_SUCCESS, tiglConfigurationSetFuseProgressCallback(tiglSimpleHandle, recordFuseProgress, &cancelled));
+    EXPECT_EQ(TIGL_ERROR, tiglExportFusedBREP(tiglSimpleHandle, "TestData/export/simpletest_cancelled.brep"));
+    EXPECT_EQ(1u, cancelled.values.size());
+
+    // the cancelled fuse is repeated on the next request
+    ASSERT_EQ(TIGL_SUCCESS, tiglConfigurationSetFuseProgressCallback(tiglSimpleHandle, NULL, NULL));
+    EXPECT_EQ(TIGL_SUCCESS, tiglExportFusedBREP(tiglSimpleHandle, "TestData/export/simpletest_cancelled.brep"));
+    ASSERT_EQ(TIGL_SUCCESS, tiglConfigurationSetFuseOptions(tiglSimpleHandle, TIGL_TRUE, 0., TIGL_GLUE_OFF));
+}
+
+TEST_F(tiglExportSimple, fuse_symmetric_half_model)
+{
+    tigl::CCPACSConfiguration& config = tigl::CCPACSConfigurationManager::GetInstance().GetConfiguration(tiglSimpleHandle);
+    tigl::PTiglFusePlane fuser = config.AircraftFusingAlgo();
+    fuser->SetResultMode(tigl::FULL_PLANE);
+
+    // reference: fuse the full configuration
+    fuser->SetUseSymmetry(false);
+    PNamedShape reference = fuser->FusedPlane();
+    ASSERT_TRUE(reference != NULL);
+
+    fuser->SetUseSymmetry(true);
+    PNamedShape fused = fuser->FusedPlane();
+    ASSERT_TRUE(fused != NULL);
+    EXPECT_EQ(TopAbs_SOLID, fused->Shape().ShapeType());
+
+    GProp_GProps referenceProps, props;
+    BRepGProp::VolumeProperties(reference->Shape(), referenceProps);
+    BRepGProp::VolumeProperties(fused->Shape(), props);
+    EXPECT_NEAR(referenceProps.Mass(), props.Mass(), 1e-4 * referenceProps.Mass());
+    EXPECT_NEAR(0., props.CentreOfMass().Y(), 1e-6);
+
+    BRepGProp::SurfaceProperties(reference->Shape(), referenceProps);
+    BRepGProp::SurfaceProperties(fused->Shape(), props);
+    EXPECT_NEAR(referenceProps.Mass(), props.Mass(), 1e-4 * referenceProps.Mass());
+
+    // the faces of the mirrored half refer to the mirrored wing
+    std::vector<std::string> referenceOrigins, origins;
+    for (unsigned int iFace = 0; iFace < reference->GetFaceCount(); ++iFace) {
+        PNamedShape origin = reference->GetFaceTraits(iFace).Origin();
+        ASSERT_TRUE(origin != NULL);
+        referenceOrigins.push_back(origin->Name());
+    }
+    for (unsigned int iFace = 0; iFace < fused->GetFaceCount(); ++iFace) {
+        PNamedShape origin = fused->GetFaceTraits(iFace).Origin();
+        ASSERT_TRUE(origin != NULL);
+        origins.push_back(origin->Name());
+    }
+    std::sort(referenceOrigins.begin(), referenceOrigins.end());
+    referenceOrigins.erase(std::unique(referenceOrigins.begin(), referenceOrigins.end()), referenceOrigins.end());
+    std::sort(origins.begin(), origins.end());
+    origins.erase(std::unique(origins.begin(), origins.end()), origins.end());
+    EXPECT_EQ(referenceOrigins, origins);
+    EXPECT_TRUE(std::find(origins.begin(), origins.end(), "Wing:mirrored") != origins.end());
+
+    fuser->SetResultMode(tigl::HALF_PLANE);
+}
+
 TEST_F(tiglExportSimple, export_iges_layers)
 {
     tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
@@ -401,6 +860,9 @@ TEST_F(tiglExportSimple, set_export_options_api)
     EXPECT_EQ(TIGL_SUCCESS, tiglSetExportOptions("vtk", "WriteNormals", "true"));
     EXPECT_EQ(TIGL_SUCCESS, tiglSetExportOptions("vtk", "WriteNormals", "yes"));
     EXPECT_EQ(TIGL_ERROR, tiglSetExportOptions("vtk", "WriteNormals", "yyeeesss"));
+    EXPECT_EQ(TIGL_SUCCESS, tiglSetExportOptions("vtk", "DataFormat", "base64"));
+    EXPECT_EQ(TIGL_SUCCESS, tiglSetExportOptions("vtk", "DataFormat", "ascii"));
+    EXPECT_EQ(TIGL_ERROR, tiglSetExportOptions("vtk", "DataFormat", "binary"));
 
     EXPECT_EQ(TIGL_NULL_POINTER, tiglSetExportOptions(0, "ApplySymmetries", "false"));
     EXPECT_EQ(TIGL_NULL_POINTER, tiglSetExportOptions("vtk", 0, "false"));
@@ -22,6 +22,9 @@
 #include "test.h" // Brings in the GTest framework
 #include "tigl.h"
 
+#include <algorithm>
+#include <cmath>
+
 
 /******************************************************************************/
 
@@ -206,3 +209,101 @@ TEST(TiglFuselageGetPointBugs, getPointAngleTranslated)
     ASSERT_NEAR(0.088661, y, 1e-5);
 }
 
+
+TEST_F(TiglFuselageGetPoint, getPointsAngle)
+{
+    const int nAngles = 36;
+    double alpha[nAngles];
+    for (int i = 0; i < nAngles; ++i) {
+        alpha[i] = 10. * i;
+    }
+    double x[nAngles], y[nAngles], z[nAngles];
+
+    ASSERT_EQ(TIGL_SUCCESS, tiglFuselageGetPointsAngle(tiglHandle, 1, 1, 0.5, nAngles, alpha, x, y, z));
+    for (int i = 0; i < nAngles; ++i) {
+        double px, py, pz;
+        ASSERT_EQ(TIGL_SUCCESS, tiglFuselageGetPointAngle(tiglHandle, 1, 1, 0.5, alpha[i], &px, &py, &pz));
+        EXPECT_NEAR(px, x[i], 1e-10);
+        EXPECT_NEAR(py, y[i], 1e-10);
+        EXPECT_NEAR(pz, z[i], 1e-10);
+    }
+
+    // alpha = 0 is on top, alpha = 90 on the left (negative y)
+    EXPECT_GT(z[0], z[18]);
+    EXPECT_LT(y[9], y[27]);
+    EXPECT_NEAR(y[0], y[18], 1e-6);
+    EXPECT_NEAR(z[9], z[27], 1e-6);
+
+    // errors
+    EXPECT_EQ(TIGL_NOT_FOUND, tiglFuselageGetPointsAngle(-1, 1, 1, 0.5, nAngles, alpha, x, y, z));
+    EXPECT_EQ(TIGL_INDEX_ERROR, tiglFuselageGetPointsAngle(tiglHandle, 1, 100, 0.5, nAngles, alpha, x, y, z));
+    EXPECT_EQ(TIGL_NULL_POINTER, tiglFuselageGetPointsAngle(tiglHandle, 1, 1, 0.5, nAngles, NULL, x, y, z));
+    EXPECT_EQ(TIGL_NULL_POINTER, tiglFuselageGetPointsAngle(tiglHandle, 1, 1, 0.5, nAngles, alpha, x, NULL, z));
+    EXPECT_EQ(TIGL_ERROR, tiglFuselageGetPointsAngle(tiglHandle, 1, 1, 0.5, -1, alpha, x, y, z));
+    EXPECT_EQ(TIGL_SUCCESS, tiglFuselageGetPointsAngle(tiglHandle, 1, 1, 0.5, 0, NULL, NULL, NULL, NULL));
+}
+
+TEST_F(TiglFuselageGetPoint, getPointsOnYPlanes)
+{
+    const int nPlanes = 4;
+    double ypos[nPlanes] = {0., 0.2, -0.3, 10.};
+    int numPoints[nPlanes];
+
+    ASSERT_EQ(TIGL_SUCCESS, tiglFuselageGetNumPointsOnYPlanes(tiglHandle, 1, 1, 0.5, nPlanes, ypos, numPoints));
+    EXPECT_EQ(2, numPoints[0]);
+    EXPECT_EQ(2, numPoints[1]);
+    EXPECT_EQ(2, numPoints[2]);
+    EXPECT_EQ(0, numPoints[3]);
+
+    // same number of points as the single plane function
+    for (int i = 0; i < 3; ++i) {
+        int num = 0;
+        ASSERT_EQ(TIGL_SUCCESS, tiglFuselageGetNumPointsOnYPlane(tiglHandle, 1, 1, 0.5, ypos[i], &num));
+        EXPECT_EQ(num, numPoints[i]);
+    }
+
+    const int nPoints = 6;
+    double x[nPoints], y[nPoints], z[nPoints];
+    ASSERT_EQ(TIGL_SUCCESS, tiglFuselageGetPointsOnYPlanes(tiglHandle, 1, 1, 0.5, nPlanes, ypos, nPoints, x, y, z));
+    int index = 0;
+    for (int iplane = 0; iplane < nPlanes; ++iplane) {
+        for (int ipoint = 0; ipoint < numPoints[iplane]; ++ipoint, ++index) {
+            EXPECT_NEAR(ypos[iplane], y[index], 1e-8);
+        }
+    }
+    // one point above, one below
+    EXPECT_LT(z[0] * z[1], 0.);
+
+    // errors
+    EXPECT_EQ(TIGL_ERROR, tiglFuselageGetPointsOnYPlanes(tiglHandle, 1, 1, 0.5, nPlanes, ypos, nPoints - 1, x, y, z));
+    EXPECT_EQ(TIGL_ERROR, tiglFuselageGetNumPointsOnYPlanes(tiglHandle, 1, 1, 0.5, -1, ypos, numPoints));
+    EXPECT_EQ(TIGL_NULL_POINTER, tiglFuselageGetNumPointsOnYPlanes(tiglHandle, 1, 1, 0.5, nPlanes, NULL, numPoints));
+    EXPECT_EQ(TIGL_NULL_POINTER, tiglFuselageGetPointsOnYPlanes(tiglHandle, 1, 1, 0.5, nPlanes, ypos, nPoints, x, NULL, z));
+    EXPECT_EQ(TIGL_NOT_FOUND, tiglFuselageGetNumPointsOnYPlanes(-1, 1, 1, 0.5, nPlanes, ypos, numPoints));
+    EXPECT_EQ(TIGL_INDEX_ERROR, tiglFuselageGetPointsOnYPlanes(tiglHandle, 100000, 1, 0.5, nPlanes, ypos, nPoints, x, y, z));
+}
+
+TEST_F(TiglFuselageGetPoint, getPointsOnXPlanes)
+{
+    const int nPlanes = 2;
+    double xpos[nPlanes] = {0.1, 10.};
+    int numPoints[nPlanes];
+
+    ASSERT_EQ(TIGL_SUCCESS, tiglFuselageGetNumPointsOnXPlanes(tiglHandle, 1, 1, 0.5, nPlanes, xpos, numPoints));
+    EXPECT_EQ(2, numPoints[0]);
+    EXPECT_EQ(0, numPoints[1]);
+
+    double x[2], y[2], z[2];
+    ASSERT_EQ(TIGL_SUCCESS, tiglFuselageGetPointsOnXPlanes(tiglHandle, 1, 1, 0.5, nPlanes, xpos, 2, x, y, z));
+    for (int i = 0; i < 2; ++i) {
+        EXPECT_NEAR(xpos[0], z[i], 1e-8);
+
+        // the points of the single plane function may have a different order
+        double px, py, pz;
+        ASSERT_EQ(TIGL_SUCCESS, tiglFuselageGetPointOnXPlane(tiglHandle, 1, 1, 0.5, xpos[0], i + 1, &px, &py, &pz));
+        double dist = std::min(std::hypot(px - x[0], py - y[0]), std::hypot(px - x[1], py - y[1]));
+        EXPECT_NEAR(0., dist, 1e-5);
+    }
+    // one point left, one right
+    EXPECT_LT(y[0] * y[1], 0.);
+}
@@ -121,6 +121,51 @@ TEST_F(TiglIntersectionCalculation, tiglIntersectWithPlane)
     ASSERT_EQ(TIGL_MATH_ERROR,   tiglIntersectWithPlane(tiglHandle, "SimpleFuselage", 0., 0., 0., 0., 0., 0., &id));
 }
 
+TEST_F(TiglIntersectionCalculation, tiglIntersectWithPlane_evictedID)
+{
+    tigl::CCPACSConfiguration& config = tigl::CCPACSConfigurationManager::GetInstance().GetConfiguration(tiglHandle);
+    tigl::CTiglShapeCache& cache = config.GetShapeCache();
+    EXPECT_EQ(size_t(512) * 1024 * 1024, cache.GetMemoryBudget());
+
+    char* id = NULL;
+    int count = 0;
+    ASSERT_EQ(TIGL_SUCCESS, tiglIntersectWithPlane(tiglHandle, "SimpleFuselage", 0., 0., 0., 0., 0., 1., &id));
+    const std::string id1 = id;
+    ASSERT_EQ(TIGL_SUCCESS, tiglIntersectWithPlane(tiglHandle, "SimpleFuselage", 0., 0., 0., 0., 1., 0., &id));
+    const std::string id2 = id;
+
+    // only the most recently used result fits into the budget
+    cache.SetMemoryBudget(1);
+    EXPECT_EQ(1u, cache.GetEvictionCount());
+
+    // the id of the evicted result has expired
+    EXPECT_EQ(TIGL_NOT_FOUND, tiglIntersectGetLineCount(tiglHandle, id1.c_str(), &count));
+    double px, py, pz;
+    EXPECT_EQ(TIGL_NOT_FOUND, tiglIntersectGetPoint(tiglHandle, id1.c_str(), 1, 0.5, &px, &py, &pz));
+    EXPECT_EQ(TIGL_SUCCESS, tiglIntersectGetLineCount(tiglHandle, id2.c_str(), &count));
+    EXPECT_EQ(1, count);
+
+    // recomputing the intersection yields the same id again
+    ASSERT_EQ(TIGL_SUCCESS, tiglIntersectWithPlane(tiglHandle, "SimpleFuselage", 0., 0., 0., 0., 0., 1., &id));
+    EXPECT_EQ(id1, std::string(id));
+    EXPECT_EQ(TIGL_SUCCESS, tiglIntersectGetLineCount(tiglHandle, id1.c_str(), &count));
+    EXPECT_EQ(1, count);
+    EXPECT_EQ(TIGL_NOT_FOUND, tiglIntersectGetLineCount(tiglHandle, id2.c_str(), &count));
+}
+
+TEST_F(TiglIntersectionCalculation, tiglIntersectSetCacheMemoryBudget)
+{
+    tigl::CTiglShapeCache& cache = tigl::CCPACSConfigurationManager::GetInstance().GetConfiguration(tiglHandle).GetShapeCache();
+
+    ASSERT_EQ(TIGL_SUCCESS, tiglIntersectSetCacheMemoryBudget(tiglHandle, 64));
+    EXPECT_EQ(size_t(64) * 1024 * 1024, cache.GetMemoryBudget());
+    ASSERT_EQ(TIGL_SUCCESS, tiglIntersectSetCacheMemoryBudget(tiglHandle, 0));
+    EXPECT_EQ(0u, cache.GetMemoryBudget());
+
+    EXPECT_EQ(TIGL_INVALID_VALUE, tiglIntersectSetCacheMemoryBudget(tiglHandle, -1));
+    EXPECT_EQ(TIGL_NOT_FOUND, tiglIntersectSetCacheMemoryBudget(-1, 64));
+}
+
 TEST_F(TiglIntersectionCalculation, tiglIntersectWithPlaneSegment)
 {
     char* id1 = NULL;
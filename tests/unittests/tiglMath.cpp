@@ -26,7 +26,11 @@
 #include "CTiglUIDManager.h"
 #include "CCPACSTransformation.h"
 #include "tiglMatrix.h"
+#include "CTiglSymmetricBandMatrix.h"
+#include "CTiglSparseMatrix.h"
+#include "CTiglError.h"
 
+#include <cmath>
 #include <cstdlib>
 
 TEST(TiglMath, factorial)
@@ -158,6 +162,58 @@ TEST(TiglMath, CSTCurve)
     ASSERT_NEAR(0.0, tigl::cstcurve_deriv(N1, N2, Br, 0., 1, 0.322954559162619), 1e-7);
 }
 
+TEST(TiglMath, CSTCurveVectorized)
+{
+    std::vector<double> B = {0.4, 1.0, 0.8, 10.2, -0.3};
+    double N1 = 0.5;
+    double N2 = 1.0;
+
+    std::vector<double> x;
+    for (int i = 0; i <= 20; ++i) {
+        x.push_back(i / 20.);
+    }
+
+    std::vector<double> shape = tigl::shape_function(B, x);
+    std::vector<double> cst = tigl::cstcurve(N1, N2, B, 0.01, x);
+    ASSERT_EQ(x.size(), shape.size());
+    ASSERT_EQ(x.size(), cst.size());
+    for (size_t i = 0; i < x.size(); ++i) {
+        EXPECT_NEAR(tigl::shape_function(B, x[i]), shape[i], 1e-13);
+        EXPECT_NEAR(tigl::cstcurve(N1, N2, B, 0.01, x[i]), cst[i], 1e-13);
+    }
+
+    EXPECT_TRUE(tigl::cstcurve(N1, N2, B, 0., std::vector<double>()).empty());
+}
+
+TEST(TiglMath, ChebycheffCoefficients)
+{
+    const int N = 8;
+    const double a = -0.5, b = 2.;
+    std::vector<double> nodes = tigl::cheb_nodes(N, a, b);
+    ASSERT_EQ(N, static_cast<int>(nodes.size()));
+
+    std::vector<double> fx;
+    for (double x : nodes) {
+        EXPECT_TRUE(x > a && x < b);
+        fx.push_back(exp(x));
+    }
+
+    // compare with the direct evaluation of the cosine sums
+    math_Vector c = tigl::cheb_coefficients(fx);
+    for (int j = 0; j < N; ++j) {
+        double cj = 0.;
+        for (int k = 1; k <= N; ++k) {
+            cj += 2. / N * fx[k-1] * cos(M_PI * j * (k - 0.5) / N);
+        }
+        if (j == 0) {
+            cj *= 0.5;
+        }
+        EXPECT_NEAR(cj, c(j), 1e-13);
+    }
+
+    EXPECT_THROW(tigl::cheb_coefficients(std::vector<double>()), tigl::CTiglError);
+}
+
 TEST(TiglMath, Tchebycheff2Bezier_N3)
 {
     math_Matrix Mmt = tigl::cheb_to_monomial(3);
@@ -1382,3 +1438,115 @@ TEST(TiglMath, PointRounding)
     EXPECT_EQ(translation.y, 0);
     EXPECT_EQ(translation.z, 0.2);
 }
+
+TEST(TiglMath, SymmetricBandMatrix)
+{
+    // tridiagonal matrix of the 1D Laplacian
+    const int n = 10;
+    tigl::CTiglSymmetricBandMatrix A(n, 1);
+    for (int i = 0; i < n; ++i) {
+        A.Add(i, i, 2.);
+        if (i > 0) {
+            A.Add(i, i - 1, -1.);
+        }
+    }
+    EXPECT_EQ(-1., A.Value(3, 4));
+    EXPECT_EQ(0., A.Value(3, 5));
+    EXPECT_THROW(A.Add(3, 5, 1.), tigl::CTiglError);
+
+    tigl::tiglMatrix dense = A.ToDense();
+    tigl::tiglMatrix rhs(1, n, 1, 2);
+    for (int i = 1; i <= n; ++i) {
+        rhs(i, 1) = 1.;
+        rhs(i, 2) = i;
+    }
+    tigl::tiglMatrix x = rhs;
+
+    ASSERT_TRUE(A.Factorize());
+    A.Solve(x);
+    tigl::tiglMatrix residual = dense.Multiplied(x) - rhs;
+    for (int i = 1; i <= n; ++i) {
+        EXPECT_NEAR(0., residual(i, 1), 1e-12);
+        EXPECT_NEAR(0., residual(i, 2), 1e-12);
+    }
+
+    tigl::tiglVector b(1, n, 1.);
+    A.Solve(b);
+    for (int i = 1; i <= n; ++i) {
+        EXPECT_NEAR(x(i, 1), b(i), 1e-12);
+    }
+
+    // not positive definite
+    tigl::CTiglSymmetricBandMatrix singular(3, 1);
+    singular.Add(0, 0, 1.);
+    singular.Add(1, 0, 1.);
+    singular.Add(1, 1, 1.);
+    singular.Add(2, 2, 1.);
+    EXPECT_FALSE(singular.Factorize());
+}
+
+TEST(TiglMath, SparseMatrix)
+{
+    tigl::CTiglSparseMatrix A(3, 4);
+    A.Add(0, 1, 2.);
+    A.Add(0, 0, 1.);
+    A.Add(0, 1, 1.);
+    A.Add(2, 3, 4.);
+    EXPECT_EQ(3, A.NonZeros());
+    EXPECT_EQ(1, A.RowSpread());
+    EXPECT_EQ(3., A.Value(0, 1));
+    EXPECT_EQ(0., A.Value(1, 1));
+    EXPECT_THROW(A.Add(1, 0, 1.), tigl::CTiglError);
+    EXPECT_THROW(A.Add(2, 4, 1.), tigl::CTiglError);
+
+    tigl::tiglMatrix dense = A.ToDense();
+    tigl::tiglMatrix b(1, 3, 1, 2);
+    b(1, 1) = 1.; b(2, 1) = 2.; b(3, 1) = 3.;
+    b(1, 2) = -1.; b(2, 2) = 0.; b(3, 2) = 0.5;
+    tigl::tiglMatrix Atb = A.TransposeMultiplied(b);
+    tigl::tiglMatrix expected = dense.Transposed().Multiplied(b);
+    tigl::CTiglSymmetricBandMatrix AtA = A.TransposeMultipliedSelf();
+    tigl::tiglMatrix expectedAtA = dense.Transposed().Multiplied(dense);
+    for (int i = 1; i <= 4; ++i) {
+        EXPECT_NEAR(expected(i, 1), Atb(i, 1), 1e-14);
+        EXPECT_NEAR(expected(i, 2), Atb(i, 2), 1e-14);
+        for (int j = 1; j <= 4; ++j) {
+            EXPECT_NEAR(expectedAtA(i, j), AtA.Value(i - 1, j - 1), 1e-14);
+        }
+    }
+}
+
+TEST(TiglMath, SparseMatrixSolveBanded)
+{
+    // periodic tridiagonal matrix, the corner entries are outside of the band
+    const int n = 20;
+    tigl::CTiglSparseMatrix A(n, n);
+    for (int i = 0; i < n; ++i) {
+        A.Add(i, (i + n - 1) % n, 1.);
+        A.Add(i, i, 4.);
+        A.Add(i, (i + 1) % n, 1.);
+    }
+
+    tigl::tiglMatrix b(1, n, 1, 3);
+    for (int i = 1; i <= n; ++i) {
+        b(i, 1) = 1.;
+        b(i, 2) = i;
+        b(i, 3) = sin(static_cast<double>(i));
+    }
+
+    tigl::tiglMatrix x = b;
+    ASSERT_TRUE(A.SolveBanded(1, x));
+    tigl::tiglMatrix residual = A.Multiplied(x) - b;
+    for (int i = 1; i <= n; ++i) {
+        for (int j = 1; j <= 3; ++j) {
+            EXPECT_NEAR(0., residual(i, j), 1e-13);
+        }
+    }
+
+    // singular banded part
+    tigl::CTiglSparseMatrix singular(2, 2);
+    singular.Add(0, 1, 1.);
+    singular.Add(1, 0, 1.);
+    tigl::tiglMatrix y(1, 2, 1, 1, 1.);
+    EXPECT_FALSE(singular.SolveBanded(1, y));
+}
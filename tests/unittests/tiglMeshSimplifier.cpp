@@ -0,0 +1,171 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "test.h"
+
+#include "CTiglError.h"
+#include "CTiglPolyData.h"
+#include "CTiglMeshSimplifier.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+    // Triangulates the unit square in the x-y plane. The left and the right half
+    // of the square are different groups, the group is also stored as polygon data.
+    void createGrid(int n, tigl::CTiglPolyObject& mesh, std::vector<unsigned int>& groups, double bulge = 0.)
+    {
+        mesh.enableNormals(true);
+        std::vector<unsigned long> index((n+1)*(n+1));
+        for (int j = 0; j <= n; ++j) {
+            for (int i = 0; i <= n; ++i) {
+                double x = double(i)/n, y = double(j)/n;
+                index[j*(n+1) + i] = mesh.addPointNormal(tigl::CTiglPoint(x, y, bulge*x*(1.-x)), tigl::CTiglPoint(0., 0., 1.));
+            }
+        }
+
+        for (int j = 0; j < n; ++j) {
+            for (int i = 0; i < n; ++i) {
+                unsigned long v00 = index[j*(n+1) + i],     v10 = index[j*(n+1) + i + 1];
+                unsigned long v01 = index[(j+1)*(n+1) + i], v11 = index[(j+1)*(n+1) + i + 1];
+                unsigned int group = 2*i < n ? 0 : 1;
+
+                unsigned long iPoly = mesh.addTriangleByVertexIndex(v00, v10, v11);
+                mesh.setPolyDataReal(iPoly, "group", group);
+                groups.push_back(group);
+
+                iPoly = mesh.addTriangleByVertexIndex(v00, v11, v01);
+                mesh.setPolyDataReal(iPoly, "group", group);
+                groups.push_back(group);
+            }
+        }
+    }
+
+    tigl::CTiglPoint vertex(const tigl::CTiglPolyObject& mesh, unsigned long iPoly, unsigned long k)
+    {
+        return mesh.getVertexPoint(mesh.getVertexIndexOfPolygon(k, iPoly));
+    }
+
+    double distanceToSegment(const tigl::CTiglPoint& p, const tigl::CTiglPoint& a, const tigl::CTiglPoint& b)
+    {
+        tigl::CTiglPoint ab = b - a;
+        double t = std::max(0., std::min(1., tigl::CTiglPoint::inner_prod(p - a, ab) / ab.norm2Sqr()));
+        return (p - (a + ab * t)).norm2();
+    }
+
+    // distance of the point to the nearest triangle of the mesh
+    double distanceToMesh(const tigl::CTiglPoint& p, const tigl::CTiglPolyObject& mesh)
+    {
+        double minDistance = 1e30;
+        for (unsigned long iPoly = 0; iPoly < mesh.getNPolygons(); ++iPoly) {
+            tigl::CTiglPoint a = vertex(mesh, iPoly, 0), b = vertex(mesh, iPoly, 1), c = vertex(mesh, iPoly, 2);
+            tigl::CTiglPoint ab = b - a, ac = c - a, ap = p - a;
+
+            // barycentric coordinates of the projection onto the triangle plane
+            double d00 = ab.norm2Sqr(), d01 = tigl::CTiglPoint::inner_prod(ab, ac), d11 = ac.norm2Sqr();
+            double d20 = tigl::CTiglPoint::inner_prod(ap, ab), d21 = tigl::CTiglPoint::inner_prod(ap, ac);
+            double denom = d00*d11 - d01*d01;
+            double v = (d11*d20 - d01*d21) / denom, w = (d00*d21 - d01*d20) / denom;
+            if (v >= 0. && w >= 0. && v + w <= 1.) {
+                minDistance = std::min(minDistance, (p - (a + ab*v + ac*w)).norm2());
+            }
+            else {
+                minDistance = std::min(minDistance, distanceToSegment(p, a, b));
+                minDistance = std::min(minDistance, distanceToSegment(p, b, c));
+                minDistance = std::min(minDistance, distanceToSegment(p, c, a));
+            }
+        }
+        return minDistance;
+    }
+}
+
+TEST(TiglMeshSimplifier, planarGroups)
+{
+    tigl::CTiglPolyData input;
+    std::vector<unsigned int> groups;
+    createGrid(10, input.currentObject(), groups);
+    ASSERT_EQ(200, input.currentObject().getNPolygons());
+
+    tigl::CTiglMeshSimplifier simplifier(input.currentObject(), groups);
+    simplifier.Simplify(1e-6);
+    EXPECT_LT(simplifier.GetNTriangles(), 20u);
+
+    tigl::CTiglPolyData output;
+    tigl::CTiglPolyObject& mesh = output.currentObject();
+    simplifier.GetMesh(mesh);
+    ASSERT_EQ(simplifier.GetNTriangles(), mesh.getNPolygons());
+    EXPECT_TRUE(mesh.hasNormals());
+
+    // the triangles still cover both halves of the square and keep their group data
+    double area[2] = {0., 0.};
+    for (unsigned long iPoly = 0; iPoly < mesh.getNPolygons(); ++iPoly) {
+        tigl::CTiglPoint p0 = vertex(mesh, iPoly, 0), p1 = vertex(mesh, iPoly, 1), p2 = vertex(mesh, iPoly, 2);
+        double triangleArea = 0.5 * ((p1.x - p0.x)*(p2.y - p0.y) - (p1.y - p0.y)*(p2.x - p0.x));
+        EXPECT_GT(triangleArea, 0.);
+
+        int group = static_cast<int>(mesh.getPolyDataReal(iPoly, "group"));
+        double centerX = (p0.x + p1.x + p2.x) / 3.;
+        EXPECT_EQ(group, centerX < 0.5 ? 0 : 1);
+        area[group] += triangleArea;
+    }
+    EXPECT_NEAR(0.5, area[0], 1e-10);
+    EXPECT_NEAR(0.5, area[1], 1e-10);
+}
+
+TEST(TiglMeshSimplifier, curvedLevels)
+{
+    tigl::CTiglPolyData input;
+    std::vector<unsigned int> groups;
+    createGrid(20, input.currentObject(), groups, 0.5);
+
+    tigl::CTiglMeshSimplifier simplifier(input.currentObject());
+
+    simplifier.Simplify(1e-3);
+    unsigned long nFine = simplifier.GetNTriangles();
+    EXPECT_LT(nFine, 800u);
+
+    simplifier.Simplify(1e-2);
+    unsigned long nCoarse = simplifier.GetNTriangles();
+    EXPECT_LT(nCoarse, nFine);
+    EXPECT_GT(nCoarse, 0u);
+
+    // the coarse mesh is still close to the surface
+    tigl::CTiglPolyData output;
+    simplifier.GetMesh(output.currentObject());
+    const tigl::CTiglPolyObject& mesh = output.currentObject();
+    for (unsigned long iPoly = 0; iPoly < mesh.getNPolygons(); ++iPoly) {
+        tigl::CTiglPoint center = (vertex(mesh, iPoly, 0) + vertex(mesh, iPoly, 1) + vertex(mesh, iPoly, 2)) * (1./3.);
+        EXPECT_NEAR(0.5*center.x*(1.-center.x), center.z, 1e-2);
+    }
+
+    // the original vertices do not deviate more than requested
+    const tigl::CTiglPolyObject& original = input.currentObject();
+    for (unsigned long iVertex = 0; iVertex < original.getNVertices(); ++iVertex) {
+        EXPECT_LE(distanceToMesh(original.getVertexPoint(iVertex), mesh), 1e-2);
+    }
+}
+
+TEST(TiglMeshSimplifier, invalidGroups)
+{
+    tigl::CTiglPolyData input;
+    std::vector<unsigned int> groups;
+    createGrid(2, input.currentObject(), groups);
+    groups.pop_back();
+
+    EXPECT_THROW(tigl::CTiglMeshSimplifier(input.currentObject(), groups), tigl::CTiglError);
+}
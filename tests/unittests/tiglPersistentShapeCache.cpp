@@ -0,0 +1,133 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+/**
+* @file
+* @brief Tests for the persistent on-disk loft cache.
+*/
+
+#include "test.h"
+#include "tigl.h"
+
+#include "CTiglPersistentShapeCache.h"
+#include "CCPACSConfiguration.h"
+#include "CCPACSConfigurationManager.h"
+#include "CCPACSWing.h"
+#include "CCPACSFuselage.h"
+#include "CNamedShape.h"
+
+#include <boost/filesystem.hpp>
+
+class TiglPersistentShapeCache : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        boost::filesystem::remove_all(cacheDir);
+        ASSERT_EQ(TIGL_SUCCESS, tiglSetGeometryCacheDirectory(cacheDir));
+        Open();
+    }
+
+    void TearDown() override
+    {
+        Close();
+        ASSERT_EQ(TIGL_SUCCESS, tiglSetGeometryCacheDirectory(""));
+        boost::filesystem::remove_all(cacheDir);
+    }
+
+    void Open()
+    {
+        ASSERT_EQ(SUCCESS, tixiOpenDocument("TestData/simpletest.cpacs.xml", &tixiHandle));
+        ASSERT_EQ(TIGL_SUCCESS, tiglOpenCPACSConfiguration(tixiHandle, "Cpacs2Test", &tiglHandle));
+    }
+
+    void Close()
+    {
+        ASSERT_EQ(TIGL_SUCCESS, tiglCloseCPACSConfiguration(tiglHandle));
+        ASSERT_EQ(SUCCESS, tixiCloseDocument(tixiHandle));
+        tiglHandle = -1;
+        tixiHandle = -1;
+    }
+
+    tigl::CCPACSConfiguration& Config()
+    {
+        return tigl::CCPACSConfigurationManager::GetInstance().GetConfiguration(tiglHandle);
+    }
+
+    size_t NumberOfCacheFiles() const
+    {
+        size_t count = 0;
+        for (boost::filesystem::directory_iterator it(cacheDir), end; it != end; ++it) {
+            if (it->path().extension() == ".tiglshape") {
+                count++;
+            }
+        }
+        return count;
+    }
+
+    const char* cacheDir = "TestData/export/geometrycache";
+    TixiDocumentHandle           tixiHandle = -1;
+    TiglCPACSConfigurationHandle tiglHandle = -1;
+};
+
+TEST_F(TiglPersistentShapeCache, storeAndLoad)
+{
+    PNamedShape built = Config().GetWing(1).GetLoft();
+    ASSERT_TRUE(built != nullptr);
+    EXPECT_EQ(1, NumberOfCacheFiles());
+
+    // reopen the configuration, the loft must now be read from the cache
+    Close();
+    Open();
+
+    PNamedShape loaded = Config().GetWing(1).GetLoft();
+    ASSERT_TRUE(loaded != nullptr);
+    EXPECT_EQ(1, NumberOfCacheFiles());
+
+    EXPECT_EQ(built->Name(), loaded->Name());
+    EXPECT_EQ(built->ShortName(), loaded->ShortName());
+    ASSERT_EQ(built->GetFaceCount(), loaded->GetFaceCount());
+    for (unsigned int iFace = 0; iFace < built->GetFaceCount(); ++iFace) {
+        EXPECT_EQ(built->GetFaceTraits(iFace).Name(), loaded->GetFaceTraits(iFace).Name());
+        EXPECT_EQ(built->GetFaceTraits(iFace).ComponentUID(), loaded->GetFaceTraits(iFace).ComponentUID());
+    }
+}
+
+TEST_F(TiglPersistentShapeCache, keyDependsOnContent)
+{
+    const std::string wingKey = tigl::CTiglPersistentShapeCache::ComputeKey(tixiHandle, "Wing", "CCPACSWing");
+    const std::string fuselageKey = tigl::CTiglPersistentShapeCache::ComputeKey(tixiHandle, "SimpleFuselage", "CCPACSFuselage");
+    EXPECT_FALSE(wingKey.empty());
+    EXPECT_FALSE(fuselageKey.empty());
+    EXPECT_NE(wingKey, fuselageKey);
+
+    // 128 bit hash as hex string
+    EXPECT_EQ(32u, wingKey.size());
+    EXPECT_EQ(std::string::npos, wingKey.find_first_not_of("0123456789abcdef"));
+
+    // the key is reproducible
+    EXPECT_EQ(wingKey, tigl::CTiglPersistentShapeCache::ComputeKey(tixiHandle, "Wing", "CCPACSWing"));
+
+    // changing a referenced profile must change the key
+    ASSERT_EQ(SUCCESS, tixiUpdateTextElement(tixiHandle, "/cpacs/vehicles/profiles/wingAirfoils/wingAirfoil[1]/name", "Changed"));
+    EXPECT_NE(wingKey, tigl::CTiglPersistentShapeCache::ComputeKey(tixiHandle, "Wing", "CCPACSWing"));
+
+    EXPECT_TRUE(tigl::CTiglPersistentShapeCache::ComputeKey(tixiHandle, "NotExistingUID").empty());
+}
+
+TEST(TiglPersistentShapeCacheApi, nullPointer)
+{
+    EXPECT_EQ(TIGL_NULL_POINTER, tiglSetGeometryCacheDirectory(nullptr));
+}
@@ -0,0 +1,149 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "test.h"
+#include "CTiglPointInSolidClassifier.h"
+#include "CTiglAbstractGeometricComponent.h"
+#include "CNamedShape.h"
+#include "CTiglError.h"
+#include "tiglcommonfunctions.h"
+
+#include <BRepBuilderAPI_MakeVertex.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeSphere.hxx>
+#include <TopoDS_Vertex.hxx>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // a box, whose length grows by one with each call of Grow
+    class GrowingBox : public tigl::CTiglAbstractGeometricComponent
+    {
+    public:
+        std::string GetDefaultedUID() const override
+        {
+            return "GrowingBox";
+        }
+
+        TiglGeometricComponentType GetComponentType() const override
+        {
+            return TIGL_COMPONENT_PLANE;
+        }
+
+        TiglGeometricComponentIntent GetComponentIntent() const override
+        {
+            return TIGL_INTENT_PHYSICAL;
+        }
+
+        // resets the loft only, like components that do not reset the other caches
+        void Grow()
+        {
+            length = length + 1.;
+            loft.clear();
+        }
+
+    protected:
+        PNamedShape BuildLoft() const override
+        {
+            return PNamedShape(new CNamedShape(BRepPrimAPI_MakeBox(length, 1., 1.).Solid(), "GrowingBox"));
+        }
+
+    private:
+        std::atomic<double> length{1.};
+    };
+}
+
+TEST(PointInSolidClassifier, Box)
+{
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(1., 1., 1).Solid();
+
+    for (const TopoDS_Shape& shape : {box, box.Reversed()}) {
+        tigl::CTiglPointInSolidClassifier classifier(shape);
+        EXPECT_GT(classifier.GetTriangleCount(), 0);
+
+        EXPECT_TRUE(classifier.Classify(gp_Pnt(0.5, 0.5, 0.5)));
+        EXPECT_TRUE(classifier.Classify(gp_Pnt(1.0, 0.5, 0.5)));
+        EXPECT_FALSE(classifier.Classify(gp_Pnt(1.5, 0.5, 0.5)));
+
+        // check tolerance of 1e-3
+        EXPECT_TRUE(classifier.Classify(gp_Pnt(1.0009, 0.5, 0.5)));
+        EXPECT_FALSE(classifier.Classify(gp_Pnt(1.0011, 0.5, 0.5)));
+    }
+}
+
+TEST(PointInSolidClassifier, NoSolid)
+{
+    TopoDS_Vertex v = BRepBuilderAPI_MakeVertex(gp_Pnt(10., 10., 10.));
+    EXPECT_THROW(tigl::CTiglPointInSolidClassifier classifier(v), tigl::CTiglError);
+}
+
+TEST(PointInSolidClassifier, SphereMatchesExact)
+{
+    TopoDS_Shape sphere = BRepPrimAPI_MakeSphere(gp_Pnt(0.3, -0.2, 0.1), 1.).Solid();
+    tigl::CTiglPointInSolidClassifier classifier(sphere);
+
+    std::vector<gp_Pnt> points;
+    for (double x = -1.; x <= 1.6; x += 0.13) {
+        for (double y = -1.5; y <= 1.1; y += 0.17) {
+            for (double z = -1.2; z <= 1.4; z += 0.19) {
+                points.push_back(gp_Pnt(x, y, z));
+            }
+        }
+    }
+
+    std::vector<bool> inside = classifier.Classify(points);
+    ASSERT_EQ(points.size(), inside.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+        EXPECT_EQ(IsPointInsideShape(sphere, points[i]), inside[i]);
+        EXPECT_EQ(classifier.Classify(points[i]), inside[i]);
+    }
+}
+
+TEST(PointInSolidClassifier, ComponentLoftChangesConcurrently)
+{
+    GrowingBox box;
+    EXPECT_TRUE(box.IsPointInside(gp_Pnt(0.5, 0.5, 0.5)));
+    EXPECT_FALSE(box.IsPointInside(gp_Pnt(1.5, 0.5, 0.5)));
+
+    // After each change of the loft, the threads concurrently find the outdated
+    // classifier. It is replaced, while other threads might still use it.
+    std::atomic<bool> wrongResult(false);
+    for (int i = 0; i < 10; ++i) {
+        box.Grow();
+
+        std::vector<std::thread> threads;
+        for (int j = 0; j < 4; ++j) {
+            threads.emplace_back([&box, &wrongResult]() {
+                for (int k = 0; k < 20; ++k) {
+                    if (!box.IsPointInside(gp_Pnt(0.5, 0.5, 0.5)) || box.IsPointInside(gp_Pnt(0.5, 1.5, 0.5))) {
+                        wrongResult = true;
+                    }
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    }
+    EXPECT_FALSE(wrongResult);
+
+    // the classifier matches the final loft
+    EXPECT_TRUE(box.IsPointInside(gp_Pnt(10.5, 0.5, 0.5)));
+    EXPECT_FALSE(box.IsPointInside(gp_Pnt(11.5, 0.5, 0.5)));
+}
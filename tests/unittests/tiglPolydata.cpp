@@ -20,6 +20,7 @@
 
 #include "test.h"
 
+#include "tigl_config.h"
 #include "tigl.h"
 #include "tixi.h"
 
@@ -30,14 +31,152 @@
 #include "CCPACSWingSegment.h"
 #include "CTiglTriangularizer.h"
 #include "CTiglExportVtk.h"
+#include "CTiglVtkStreamWriter.h"
 #include "CNamedShape.h"
 
 #include <TopoDS_CompSolid.hxx>
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <ctime>
+#include <fstream>
+#include <sstream>
+
+#ifdef ZLIB_FOUND
+#include <zlib.h>
+#endif
 
 using namespace tigl;
 
+namespace
+{
+    std::vector<unsigned char> decodeBase64(const std::string& text)
+    {
+        const std::string chars = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        std::vector<unsigned char> result;
+        for (size_t i = 0; i + 3 < text.size(); i += 4) {
+            uint32_t quad = 0;
+            int nPadding = 0;
+            for (size_t j = 0; j < 4; ++j) {
+                quad <<= 6;
+                if (text[i + j] == '=') {
+                    nPadding++;
+                }
+                else {
+                    quad |= static_cast<uint32_t>(chars.find(text[i + j]));
+                }
+            }
+            result.push_back(static_cast<unsigned char>(quad >> 16));
+            if (nPadding < 2) {
+                result.push_back(static_cast<unsigned char>(quad >> 8));
+            }
+            if (nPadding < 1) {
+                result.push_back(static_cast<unsigned char>(quad));
+            }
+        }
+        return result;
+    }
+
+    // Reads the header and the data of an appended array, which are encoded separately in base64 files
+    void readAppended(const std::string& file, size_t& pos, size_t nBytes, bool base64, std::vector<unsigned char>& bytes)
+    {
+        if (base64) {
+            const size_t nChars = 4 * ((nBytes + 2) / 3);
+            ASSERT_LE(pos + nChars, file.size());
+            bytes = decodeBase64(file.substr(pos, nChars));
+            pos += nChars;
+        }
+        else {
+            ASSERT_LE(pos + nBytes, file.size());
+            bytes.assign(file.begin() + pos, file.begin() + pos + nBytes);
+            pos += nBytes;
+        }
+        ASSERT_EQ(nBytes, bytes.size());
+    }
+
+    uint64_t headerValue(const std::vector<unsigned char>& header, size_t index)
+    {
+        uint64_t value = 0;
+        std::memcpy(&value, header.data() + index * sizeof(uint64_t), sizeof(value));
+        return value;
+    }
+
+    // Decodes a data array of a vtk file written by the CTiglVtkStreamWriter and checks its header
+    void decodeVtkArray(const std::string& file, const std::string& name, std::vector<unsigned char>& data)
+    {
+        const bool base64 = file.find("<AppendedData encoding=\"base64\">") != std::string::npos;
+        const bool compressed = file.find("compressor=\"vtkZLibDataCompressor\"") != std::string::npos;
+
+        size_t pos = file.find("Name=\"" + name + "\"");
+        ASSERT_NE(std::string::npos, pos);
+        pos = file.find("offset=\"", pos) + 8;
+        const size_t offset = std::stoul(file.substr(pos));
+        pos = file.find("   _", file.find("<AppendedData")) + 4 + offset;
+
+        std::vector<unsigned char> header;
+        if (!compressed) {
+            ASSERT_NO_FATAL_FAILURE(readAppended(file, pos, sizeof(uint64_t), base64, header));
+            ASSERT_NO_FATAL_FAILURE(readAppended(file, pos, headerValue(header, 0), base64, data));
+            return;
+        }
+
+#ifdef ZLIB_FOUND
+        // the block count is needed to get the size of the header
+        std::vector<unsigned char> blockCount;
+        size_t countPos = pos;
+        ASSERT_NO_FATAL_FAILURE(readAppended(file, countPos, base64 ? 9 : sizeof(uint64_t), base64, blockCount));
+        const uint64_t nBlocks = headerValue(blockCount, 0);
+        ASSERT_GT(nBlocks, 0u);
+
+        ASSERT_NO_FATAL_FAILURE(readAppended(file, pos, (3 + nBlocks) * sizeof(uint64_t), base64, header));
+        const uint64_t blockSize = headerValue(header, 1);
+        const uint64_t lastBlockSize = headerValue(header, 2);
+        EXPECT_EQ(32768u, blockSize);
+
+        uint64_t compressedSize = 0;
+        for (uint64_t iBlock = 0; iBlock < nBlocks; ++iBlock) {
+            compressedSize += headerValue(header, 3 + iBlock);
+        }
+        std::vector<unsigned char> compressedData;
+        ASSERT_NO_FATAL_FAILURE(readAppended(file, pos, compressedSize, base64, compressedData));
+
+        data.clear();
+        size_t blockStart = 0;
+        for (uint64_t iBlock = 0; iBlock < nBlocks; ++iBlock) {
+            const uint64_t expectedSize = iBlock + 1 == nBlocks && lastBlockSize > 0 ? lastBlockSize : blockSize;
+            std::vector<unsigned char> block(blockSize);
+            uLongf blockBytes = static_cast<uLongf>(block.size());
+            ASSERT_EQ(Z_OK, uncompress(block.data(), &blockBytes, compressedData.data() + blockStart, static_cast<uLong>(headerValue(header, 3 + iBlock))));
+            ASSERT_EQ(expectedSize, blockBytes);
+            data.insert(data.end(), block.begin(), block.begin() + blockBytes);
+            blockStart += headerValue(header, 3 + iBlock);
+        }
+#else
+        FAIL() << "Cannot decompress the vtk file without zlib";
+#endif
+    }
+
+    std::string readFile(const std::string& filename)
+    {
+        std::ifstream in(filename.c_str(), std::ios::in | std::ios::binary);
+        std::ostringstream content;
+        content << in.rdbuf();
+        return content.str();
+    }
+
+    template <typename T>
+    void expectArray(const std::string& file, const std::string& name, const T* expected, size_t size)
+    {
+        std::vector<unsigned char> data;
+        ASSERT_NO_FATAL_FAILURE(decodeVtkArray(file, name, data));
+        ASSERT_EQ(size * sizeof(T), data.size()) << name;
+        std::vector<T> values(size);
+        std::memcpy(values.data(), data.data(), data.size());
+        EXPECT_TRUE(std::equal(values.begin(), values.end(), expected)) << name;
+    }
+}
+
 
 class TriangularizeShape : public ::testing::Test
 {
@@ -367,6 +506,251 @@ TEST(TiglPolyData, cube_export_vtk_withpieces)
     CTiglExportVtk::WritePolys(poly, "vtk_cube+pieces.vtp");
 }
 
+TEST(TiglPolyData, vertexWelding)
+{
+    CTiglPolyData poly;
+    CTiglPolyObject& co = poly.currentObject();
+
+    // quads of a 100x100 grid share their corner points
+    const int n = 100;
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) {
+            CTiglPolygon quad;
+            quad.addPoint(CTiglPoint(i, j, 0.));
+            quad.addPoint(CTiglPoint(i + 1, j, 0.));
+            // slightly perturbed, within the weld tolerance
+            quad.addPoint(CTiglPoint(i + 1 + 1e-7, j + 1, 0.));
+            quad.addPoint(CTiglPoint(i, j + 1 - 1e-7, 0.));
+            co.addPolygon(quad);
+        }
+    }
+    EXPECT_EQ(n*n, co.getNPolygons());
+    EXPECT_EQ((n+1)*(n+1), co.getNVertices());
+
+    // points outside the weld tolerance are distinct
+    unsigned long i1 = co.addPointNormal(CTiglPoint(0.5, 0.5, 0.), CTiglPoint(0., 0., 1.));
+    unsigned long i2 = co.addPointNormal(CTiglPoint(0.5, 0.5, 1e-4), CTiglPoint(0., 0., 1.));
+    EXPECT_NE(i1, i2);
+
+    // same point, different normals
+    unsigned long i3 = co.addPointNormal(CTiglPoint(0.5, 0.5, 0.), CTiglPoint(0., 0., -1.));
+    EXPECT_NE(i1, i3);
+    EXPECT_EQ(i1, co.addPointNormal(CTiglPoint(0.5, 0.5, 1e-7), CTiglPoint(0., 0., 1.)));
+
+    // points at cell borders and negative coordinates
+    unsigned long i4 = co.addPointNormal(CTiglPoint(-1e-6, 0., 0.), CTiglPoint(1., 0., 0.));
+    EXPECT_EQ(i4, co.addPointNormal(CTiglPoint(1e-6, 0., 0.), CTiglPoint(1., 0., 0.)));
+}
+
+TEST(TiglPolyData, rawBuffers)
+{
+    CTiglPolyData poly;
+    CTiglPolyObject& co = poly.currentObject();
+    co.enableNormals(true);
+
+    unsigned long v0 = co.addPointNormal(CTiglPoint(0., 0., 0.), CTiglPoint(0., 0., 1.));
+    unsigned long v1 = co.addPointNormal(CTiglPoint(1., 0., 0.), CTiglPoint(0., 0., 1.));
+    unsigned long v2 = co.addPointNormal(CTiglPoint(1., 1., 0.), CTiglPoint(0., 0., 1.));
+    unsigned long v3 = co.addPointNormal(CTiglPoint(0., 1., 0.), CTiglPoint(0., 0., 1.));
+
+    EXPECT_EQ(0, co.addTriangleByVertexIndex(v0, v1, v2));
+    EXPECT_EQ(ULONG_MAX, co.addTriangleByVertexIndex(v0, v0, v2));
+    EXPECT_EQ(1, co.addTriangleByVertexIndex(v0, v2, v3));
+
+    CTiglConstSpan<double> points = co.getPointData();
+    ASSERT_EQ(12, points.size());
+    EXPECT_EQ(1., points[3*v2]);
+    EXPECT_EQ(1., points[3*v2 + 1]);
+    EXPECT_EQ(0., points[3*v2 + 2]);
+
+    CTiglConstSpan<double> normals = co.getNormalData();
+    ASSERT_EQ(12, normals.size());
+    EXPECT_EQ(1., normals[3*v3 + 2]);
+
+    CTiglConstSpan<unsigned int> offsets = co.getPolygonOffsets();
+    CTiglConstSpan<unsigned int> connectivity = co.getConnectivity();
+    ASSERT_EQ(3, offsets.size());
+    ASSERT_EQ(6, connectivity.size());
+    for (unsigned long iPoly = 0; iPoly < co.getNPolygons(); ++iPoly) {
+        ASSERT_EQ(co.getNPointsOfPolygon(iPoly), offsets[iPoly + 1] - offsets[iPoly]);
+        for (unsigned long j = 0; j < co.getNPointsOfPolygon(iPoly); ++j) {
+            EXPECT_EQ(co.getVertexIndexOfPolygon(j, iPoly), connectivity[offsets[iPoly] + j]);
+        }
+    }
+}
+
+TEST(TiglPolyData, dataColumns)
+{
+    CTiglPolyData poly;
+    CTiglPolyObject& co = poly.currentObject();
+
+    for (int i = 0; i < 3; ++i) {
+        co.addTriangleByVertexIndex(
+            co.addPointNormal(CTiglPoint(i, 0., 0.), CTiglPoint(1., 0., 0.)),
+            co.addPointNormal(CTiglPoint(i, 1., 0.), CTiglPoint(1., 0., 0.)),
+            co.addPointNormal(CTiglPoint(i, 1., 1.), CTiglPoint(1., 0., 0.)));
+    }
+
+    EXPECT_TRUE(co.getPolyDataColumn("xsi").empty());
+    co.setPolyDataReal(1, "xsi", 0.5);
+    co.setPolyDataReal(2, "eta", 0.25);
+
+    // fields are sorted by name
+    ASSERT_EQ(2, co.getNumberOfPolyRealData());
+    EXPECT_STREQ("eta", co.getPolyDataFieldName(0));
+    EXPECT_STREQ("xsi", co.getPolyDataFieldName(1));
+
+    CTiglConstSpan<double> xsi = co.getPolyDataColumn("xsi");
+    ASSERT_EQ(3, xsi.size());
+    EXPECT_EQ(UNDEFINED_REAL, xsi[0]);
+    EXPECT_EQ(0.5, xsi[1]);
+    EXPECT_EQ(UNDEFINED_REAL, xsi[2]);
+    EXPECT_EQ(0.25, co.getPolyDataReal(2, "eta"));
+    EXPECT_EQ(UNDEFINED_REAL, co.getPolyDataReal(2, "unknown"));
+
+    // columns grow with new polygons
+    co.addTriangleByVertexIndex(0, 1, 3);
+    EXPECT_EQ(4, co.getPolyDataColumn("eta").size());
+
+    co.setVertexDataReal(4, "thickness", 2.);
+    CTiglConstSpan<double> thickness = co.getVertexDataColumn("thickness");
+    ASSERT_EQ(co.getNVertices(), thickness.size());
+    EXPECT_EQ(2., thickness[4]);
+    EXPECT_EQ(UNDEFINED_REAL, co.getVertexDataReal(3, "thickness"));
+
+    // metadata is optional per polygon
+    EXPECT_FALSE(co.hasMetadata());
+    co.setPolyMetadata(1, "segment 1");
+    EXPECT_TRUE(co.hasMetadata());
+    EXPECT_STREQ("segment 1", co.getPolyMetadata(1));
+    EXPECT_STREQ("", co.getPolyMetadata(3));
+    EXPECT_THROW(co.getPolyMetadata(4), tigl::CTiglError);
+}
+
+TEST(TiglPolyData, append)
+{
+    CTiglPolyData poly;
+    CTiglPolyObject& co1 = poly.currentObject();
+    co1.addTriangleByVertexIndex(
+        co1.addPointNormal(CTiglPoint(0., 0., 0.), CTiglPoint(0., 0., 1.)),
+        co1.addPointNormal(CTiglPoint(1., 0., 0.), CTiglPoint(0., 0., 1.)),
+        co1.addPointNormal(CTiglPoint(1., 1., 0.), CTiglPoint(0., 0., 1.)));
+    co1.setPolyDataReal(0, "eta", 0.5);
+
+    CTiglPolyObject& co2 = poly.createNewObject();
+    unsigned long i1 = co2.addPointNormal(CTiglPoint(0., 0., 0.), CTiglPoint(0., 0., 1.));
+    unsigned long i2 = co2.addPointNormal(CTiglPoint(1., 1., 0.), CTiglPoint(0., 0., 1.));
+    unsigned long i3 = co2.addPointNormal(CTiglPoint(0., 1., 0.), CTiglPoint(0., 0., 1.));
+    co2.addTriangleByVertexIndex(i1, i2, i3);
+    co2.setPolyDataReal(0, "xsi", 0.25);
+    co2.setPolyMetadata(0, "second");
+
+    CTiglPolyData merged;
+    CTiglPolyObject& co = merged.currentObject();
+    co.append(co1);
+    co.append(co2);
+
+    // the shared edge is welded
+    ASSERT_EQ(2, co.getNPolygons());
+    EXPECT_EQ(4, co.getNVertices());
+    EXPECT_NEAR(0., co.getVertexPoint(co.getVertexIndexOfPolygon(0, 1)).distance2(CTiglPoint(0., 0., 0.)), 1e-10);
+    EXPECT_NEAR(0., co.getVertexPoint(co.getVertexIndexOfPolygon(1, 1)).distance2(CTiglPoint(1., 1., 0.)), 1e-10);
+    EXPECT_EQ(3, co.getVertexIndexOfPolygon(2, 1));
+
+    EXPECT_EQ(0.5, co.getPolyDataReal(0, "eta"));
+    EXPECT_EQ(UNDEFINED_REAL, co.getPolyDataReal(1, "eta"));
+    EXPECT_EQ(UNDEFINED_REAL, co.getPolyDataReal(0, "xsi"));
+    EXPECT_EQ(0.25, co.getPolyDataReal(1, "xsi"));
+
+    EXPECT_TRUE(co.hasMetadata());
+    EXPECT_STREQ("", co.getPolyMetadata(0));
+    EXPECT_STREQ("second", co.getPolyMetadata(1));
+
+    EXPECT_THROW(co.append(co), tigl::CTiglError);
+}
+
+TEST(TiglPolyData, streamWriterRaw)
+{
+    CTiglPolyData poly;
+    CTiglPolyObject& co = poly.currentObject();
+    co.enableNormals(true);
+    for (int i = 0; i < 3; ++i) {
+        co.addTriangleByVertexIndex(
+            co.addPointNormal(CTiglPoint(i, 0., 0.), CTiglPoint(1., 0., 0.)),
+            co.addPointNormal(CTiglPoint(i, 1., 0.), CTiglPoint(1., 0., 0.)),
+            co.addPointNormal(CTiglPoint(i, 1., 1.), CTiglPoint(1., 0., 0.)));
+    }
+    co.setPolyDataReal(1, "xsi", 0.5);
+
+    std::ostringstream stream;
+    CTiglVtkStreamWriter(VtkAppendedRaw).Write(std::vector<const CTiglPolyObject*>(1, &co), stream);
+    const std::string file = stream.str();
+
+    // read the point coordinates back from the appended data
+    size_t pos = file.find("Name=\"Points\"");
+    ASSERT_NE(std::string::npos, pos);
+    pos = file.find("offset=\"", pos) + 8;
+    const size_t offset = std::stoul(file.substr(pos));
+    const size_t dataStart = file.find("encoding=\"raw\">\n   _") + 20;
+
+    uint64_t nBytes = 0;
+    std::memcpy(&nBytes, file.data() + dataStart + offset, sizeof(nBytes));
+    ASSERT_EQ(co.getPointData().size() * sizeof(double), nBytes);
+
+    std::vector<double> points(co.getPointData().size());
+    std::memcpy(points.data(), file.data() + dataStart + offset + sizeof(nBytes), nBytes);
+    EXPECT_TRUE(std::equal(points.begin(), points.end(), co.getPointData().begin()));
+
+    EXPECT_NE(std::string::npos, file.find("<PointData Normals=\"surf_normals\">"));
+    EXPECT_NE(std::string::npos, file.find("Name=\"xsi\""));
+}
+
+TEST(TiglPolyData, streamWriterFormats)
+{
+    CTiglPolyData poly;
+    CTiglPolyObject& co = poly.currentObject();
+    // large enough for several compressed blocks
+    for (int i = 0; i < 2000; ++i) {
+        co.addTriangleByVertexIndex(
+            co.addPointNormal(CTiglPoint(i, 0., 0.), CTiglPoint(0., 0., 1.)),
+            co.addPointNormal(CTiglPoint(i, 1., 0.), CTiglPoint(0., 0., 1.)),
+            co.addPointNormal(CTiglPoint(i + 1, 1., 0.), CTiglPoint(0., 0., 1.)));
+    }
+
+    ASSERT_NO_THROW(CTiglExportVtk::WritePolys(poly, "TestData/export/polydata_raw.vtp", VtkAppendedRaw));
+    ASSERT_NO_THROW(CTiglExportVtk::WritePolys(poly, "TestData/export/polydata_base64.vtp", VtkAppendedBase64));
+    ASSERT_NO_THROW(CTiglExportVtk::WritePolys(poly, "TestData/export/polydata_raw_zlib.vtp", VtkAppendedRaw, true));
+    ASSERT_NO_THROW(CTiglExportVtk::WritePolys(poly, "TestData/export/polydata_base64_zlib.vtp", VtkAppendedBase64, true));
+
+    // decode all formats again, the zlib files are only compressed if zlib is available
+    const char* files[] = {
+        "TestData/export/polydata_raw.vtp",
+        "TestData/export/polydata_base64.vtp",
+        "TestData/export/polydata_raw_zlib.vtp",
+        "TestData/export/polydata_base64_zlib.vtp"
+    };
+    for (int iFile = 0; iFile < 4; ++iFile) {
+        SCOPED_TRACE(files[iFile]);
+        const std::string file = readFile(files[iFile]);
+        ASSERT_FALSE(file.empty());
+
+        EXPECT_NE(std::string::npos, file.find("header_type=\"UInt64\""));
+        EXPECT_EQ(iFile % 2 == 1, file.find("encoding=\"base64\"") != std::string::npos);
+        EXPECT_EQ(iFile >= 2 && CTiglVtkStreamWriter::IsCompressionAvailable(),
+                  file.find("compressor=\"vtkZLibDataCompressor\"") != std::string::npos);
+
+        CTiglConstSpan<double> points = co.getPointData();
+        CTiglConstSpan<unsigned int> connectivity = co.getConnectivity();
+        CTiglConstSpan<unsigned int> offsets = co.getPolygonOffsets();
+        expectArray(file, "Points", points.data(), points.size());
+        expectArray(file, "connectivity", connectivity.data(), connectivity.size());
+        expectArray(file, "offsets", offsets.data() + 1, offsets.size() - 1);
+    }
+
+    std::vector<const CTiglPolyObject*> pieces(1, &co);
+    EXPECT_THROW(CTiglVtkStreamWriter().Write(pieces, "TestData/notexisting/polydata.vtp"), tigl::CTiglError);
+}
+
 TEST_F(TriangularizeShape, exportVTK_FusedWing)
 {
     tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
@@ -439,6 +823,42 @@ TEST_F(TriangularizeShape, exportVTK_WingSegmentInfo)
     ASSERT_NO_THROW(CTiglExportVtk::WritePolys(polys, vtkWingFilename));
 }
 
+TEST_F(TriangularizeShape, parallelMatchesSerial)
+{
+    tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
+    tigl::CCPACSConfiguration & config = manager.GetConfiguration(tiglHandle);
+    tigl::CCPACSWing& wing = config.GetWing(1);
+
+    tigl::CTiglTriangularizer serialMesher(&config.GetUIDManager(), wing.GetLoft(), 0.001, SEGMENT_INFO, true, false);
+    tigl::CTiglTriangularizer parallelMesher(&config.GetUIDManager(), wing.GetLoft(), 0.001, SEGMENT_INFO, true, true);
+
+    const CTiglPolyObject& serial = serialMesher.getTriangulation().currentObject();
+    const CTiglPolyObject& parallel = parallelMesher.getTriangulation().currentObject();
+    ASSERT_GT(serial.getNPolygons(), 0);
+
+    // the results must be bitwise identical
+    auto expectSame = [](const CTiglConstSpan<double>& a, const CTiglConstSpan<double>& b) {
+        ASSERT_EQ(a.size(), b.size());
+        EXPECT_TRUE(std::equal(a.begin(), a.end(), b.begin()));
+    };
+    expectSame(serial.getPointData(), parallel.getPointData());
+    expectSame(serial.getNormalData(), parallel.getNormalData());
+
+    ASSERT_EQ(serial.getConnectivity().size(), parallel.getConnectivity().size());
+    EXPECT_TRUE(std::equal(serial.getConnectivity().begin(), serial.getConnectivity().end(), parallel.getConnectivity().begin()));
+
+    ASSERT_EQ(4, serial.getNumberOfPolyRealData());
+    ASSERT_EQ(serial.getNumberOfPolyRealData(), parallel.getNumberOfPolyRealData());
+    for (unsigned int iField = 0; iField < serial.getNumberOfPolyRealData(); ++iField) {
+        const char* name = serial.getPolyDataFieldName(iField);
+        expectSame(serial.getPolyDataColumn(name), parallel.getPolyDataColumn(name));
+    }
+
+    for (unsigned long iPoly = 0; iPoly < serial.getNPolygons(); ++iPoly) {
+        ASSERT_STREQ(serial.getPolyMetadata(iPoly), parallel.getPolyMetadata(iPoly));
+    }
+}
+
 TEST_F(TriangularizeShape, exportVTK_FullPlane_long)
 {
     const char* vtkWingFilename = "TestData/export/simplewing_fusedplane.vtp";
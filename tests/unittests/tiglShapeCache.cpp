@@ -128,3 +128,77 @@ TEST(ShapeCache, Get)
     shape = cache.GetShape("3");
     ASSERT_TRUE(shape.IsNull());
 }
+
+TEST(ShapeCache, LRUEviction)
+{
+    tigl::CTiglShapeCache cache;
+
+    BRepBuilderAPI_MakeWire wireBuilder(BRepBuilderAPI_MakeEdge(gp_Pnt(1,0,0), gp_Pnt(1,1,0)));
+    TopoDS_Shape shape = wireBuilder.Wire();
+    const size_t shapeSize = tigl::CTiglShapeCache::EstimateShapeSize(shape);
+    ASSERT_GT(shapeSize, 0u);
+
+    cache.Insert(shape, "1");
+    cache.Insert(shape, "2");
+    cache.Insert(shape, "3");
+    EXPECT_EQ(3 * shapeSize, cache.GetMemoryUsage());
+
+    // "1" is now the most recently used shape, "2" the least recently used one
+    ASSERT_FALSE(cache.GetShape("1").IsNull());
+
+    cache.SetMemoryBudget(2 * shapeSize);
+    EXPECT_EQ(2, cache.GetNShape());
+    EXPECT_TRUE(cache.HasShape("1"));
+    EXPECT_FALSE(cache.HasShape("2"));
+    EXPECT_TRUE(cache.HasShape("3"));
+    EXPECT_EQ(1u, cache.GetEvictionCount());
+
+    cache.Insert(shape, "4");
+    EXPECT_EQ(2, cache.GetNShape());
+    EXPECT_TRUE(cache.HasShape("1"));
+    EXPECT_FALSE(cache.HasShape("3"));
+    EXPECT_TRUE(cache.HasShape("4"));
+    EXPECT_EQ(2u, cache.GetEvictionCount());
+    EXPECT_LE(cache.GetMemoryUsage(), cache.GetMemoryBudget());
+
+    cache.Clear();
+    EXPECT_EQ(0u, cache.GetMemoryUsage());
+}
+
+TEST(ShapeCache, Statistics)
+{
+    tigl::CTiglShapeCache cache;
+    TopoDS_Shape shape;
+
+    cache.Insert(shape, "1");
+    EXPECT_TRUE(cache.Find("1") != nullptr);
+    EXPECT_TRUE(cache.Find("2") == nullptr);
+    cache.GetShape("1");
+    cache.GetShape("3");
+
+    EXPECT_EQ(2u, cache.GetHitCount());
+    EXPECT_EQ(2u, cache.GetMissCount());
+    EXPECT_EQ(0u, cache.GetEvictionCount());
+
+    cache.ResetStatistics();
+    EXPECT_EQ(0u, cache.GetHitCount());
+    EXPECT_EQ(0u, cache.GetMissCount());
+}
+
+TEST(ShapeCache, DirectContainerAccess)
+{
+    tigl::CTiglShapeCache cache;
+
+    BRepBuilderAPI_MakeWire wireBuilder(BRepBuilderAPI_MakeEdge(gp_Pnt(1,0,0), gp_Pnt(1,1,0)));
+    TopoDS_Shape shape = wireBuilder.Wire();
+    const size_t shapeSize = tigl::CTiglShapeCache::EstimateShapeSize(shape);
+
+    cache.Insert(shape, "1");
+    cache.GetContainer()["2"] = shape;
+    EXPECT_EQ(2 * shapeSize, cache.GetMemoryUsage());
+
+    // shapes added directly are treated as least recently used
+    cache.SetMemoryBudget(shapeSize);
+    EXPECT_TRUE(cache.HasShape("1"));
+    EXPECT_FALSE(cache.HasShape("2"));
+}
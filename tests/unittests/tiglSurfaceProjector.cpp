@@ -0,0 +1,122 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "test.h"
+#include "CTiglSurfaceProjector.h"
+#include "CTiglError.h"
+
+#include <GeomAPI_ProjectPointOnSurf.hxx>
+#include <Geom_Plane.hxx>
+#include <Geom_RectangularTrimmedSurface.hxx>
+#include <Geom_SphericalSurface.hxx>
+#include <gp_Ax3.hxx>
+
+#include <cmath>
+#include <thread>
+#include <vector>
+
+TEST(SurfaceProjector, matchesGeomAPI)
+{
+    // a quarter of a sphere
+    Handle(Geom_Surface) sphere = new Geom_SphericalSurface(gp_Ax3(gp_Pnt(1., 2., 3.), gp_Dir(0., 0., 1.)), 2.);
+    Handle(Geom_Surface) surface = new Geom_RectangularTrimmedSurface(sphere, 0., M_PI, -M_PI/4., M_PI/4.);
+
+    tigl::CTiglSurfaceProjector projector(surface);
+
+    for (double x = -2.; x <= 4.; x += 0.75) {
+        for (double y = 0.; y <= 5.; y += 0.9) {
+            for (double z = 1.; z <= 5.; z += 0.7) {
+                gp_Pnt p(x, y, z);
+
+                GeomAPI_ProjectPointOnSurf proj(p, surface);
+
+                double u, v, dist;
+                if (proj.NbPoints() == 0) {
+                    // no orthogonal projection, the projector must not clamp onto the boundary
+                    EXPECT_FALSE(projector.Project(p, u, v, dist));
+                    continue;
+                }
+
+                ASSERT_TRUE(projector.Project(p, u, v, dist));
+                EXPECT_NEAR(surface->Value(u, v).Distance(p), dist, 1e-10);
+                EXPECT_LE(dist, proj.LowerDistance() + 1e-8);
+            }
+        }
+    }
+}
+
+TEST(SurfaceProjector, pointOnSurface)
+{
+    Handle(Geom_Surface) sphere = new Geom_SphericalSurface(gp_Ax3(gp_Pnt(0., 0., 0.), gp_Dir(0., 0., 1.)), 1.);
+    Handle(Geom_Surface) surface = new Geom_RectangularTrimmedSurface(sphere, 0., M_PI, -M_PI/4., M_PI/4.);
+
+    tigl::CTiglSurfaceProjector projector(surface);
+
+    double u, v, dist;
+    ASSERT_TRUE(projector.Project(surface->Value(1.234, 0.321), u, v, dist));
+    EXPECT_NEAR(1.234, u, 1e-8);
+    EXPECT_NEAR(0.321, v, 1e-8);
+    EXPECT_NEAR(0., dist, 1e-10);
+
+    // outside of the trimmed surface, there is no orthogonal projection.
+    // As GeomAPI_ProjectPointOnSurf, the point is not projected onto the boundary.
+    EXPECT_FALSE(projector.Project(gp_Pnt(0., 0., 2.), u, v, dist));
+    EXPECT_EQ(0, GeomAPI_ProjectPointOnSurf(gp_Pnt(0., 0., 2.), surface).NbPoints());
+}
+
+TEST(SurfaceProjector, infiniteSurface)
+{
+    Handle(Geom_Surface) plane = new Geom_Plane(gp_Pnt(0., 0., 1.), gp_Dir(0., 0., 1.));
+    tigl::CTiglSurfaceProjector projector(plane);
+
+    double u, v, dist;
+    ASSERT_TRUE(projector.Project(gp_Pnt(3., 4., 5.), u, v, dist));
+    EXPECT_NEAR(4., dist, 1e-10);
+}
+
+TEST(SurfaceProjector, concurrentExactProjections)
+{
+    // infinite surfaces are always projected with GeomAPI_ProjectPointOnSurf
+    Handle(Geom_Surface) plane = new Geom_Plane(gp_Pnt(0., 0., 1.), gp_Dir(0., 0., 1.));
+    const tigl::CTiglSurfaceProjector projector(plane);
+
+    std::vector<char> success(8, 0);
+    std::vector<std::thread> threads;
+    for (size_t ithread = 0; ithread < success.size(); ++ithread) {
+        threads.emplace_back([&projector, &success, ithread]() {
+            bool ok = true;
+            for (int i = 0; i < 100; ++i) {
+                double z = 2. + 0.01 * static_cast<double>(i) + static_cast<double>(ithread);
+                double u, v, dist;
+                ok = projector.Project(gp_Pnt(3., 4., z), u, v, dist) && std::abs(dist - (z - 1.)) < 1e-10
+                     && std::abs(u - 3.) < 1e-10 && std::abs(v - 4.) < 1e-10 && ok;
+            }
+            success[ithread] = ok ? 1 : 0;
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(std::vector<char>(success.size(), 1), success);
+}
+
+TEST(SurfaceProjector, notInitialized)
+{
+    tigl::CTiglSurfaceProjector projector;
+    double u, v, dist;
+    EXPECT_THROW(projector.Project(gp_Pnt(0., 0., 0.), u, v, dist), tigl::CTiglError);
+    EXPECT_THROW(projector.Init(Handle(Geom_Surface)()), tigl::CTiglError);
+}
@@ -0,0 +1,189 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+/**
+* @file
+* @brief Tests for the tessellation cache shared by the triangulated exporters.
+*/
+
+#include "test.h"
+#include "tigl.h"
+
+#include "CTiglTessellationCache.h"
+#include "CTiglMultiFormatExport.h"
+#include "CTiglExporterFactory.h"
+#include "CCPACSConfiguration.h"
+#include "CCPACSConfigurationManager.h"
+#include "CCPACSWing.h"
+#include "CNamedShape.h"
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+class TiglTessellationCache : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ASSERT_EQ(SUCCESS, tixiOpenDocument("TestData/simpletest.cpacs.xml", &tixiHandle));
+        ASSERT_EQ(TIGL_SUCCESS, tiglOpenCPACSConfiguration(tixiHandle, "Cpacs2Test", &tiglHandle));
+        tigl::CTiglTessellationCache::GetInstance().Clear();
+    }
+
+    void TearDown() override
+    {
+        tigl::CTiglTessellationCache::GetInstance().Clear();
+        ASSERT_EQ(TIGL_SUCCESS, tiglCloseCPACSConfiguration(tiglHandle));
+        ASSERT_EQ(SUCCESS, tixiCloseDocument(tixiHandle));
+        tiglHandle = -1;
+        tixiHandle = -1;
+    }
+
+    tigl::CCPACSConfiguration& Config()
+    {
+        return tigl::CCPACSConfigurationManager::GetInstance().GetConfiguration(tiglHandle);
+    }
+
+    TixiDocumentHandle           tixiHandle = -1;
+    TiglCPACSConfigurationHandle tiglHandle = -1;
+};
+
+TEST_F(TiglTessellationCache, reuseTriangulation)
+{
+    tigl::CTiglTessellationCache& cache = tigl::CTiglTessellationCache::GetInstance();
+    PNamedShape loft = Config().GetWing(1).GetLoft();
+
+    std::shared_ptr<const tigl::CTiglPolyData> mesh1 = cache.Triangulate(NULL, loft, 0.01);
+    ASSERT_TRUE(mesh1);
+    EXPECT_GT(mesh1->getTotalPolygonCount(), 0);
+    EXPECT_EQ(1, cache.Size());
+
+    // same shape and deflection
+    EXPECT_EQ(mesh1, cache.Triangulate(NULL, loft, 0.01));
+
+    // the mesh with normals also serves requests without normals
+    EXPECT_EQ(mesh1, cache.Triangulate(NULL, loft, 0.01, tigl::NO_INFO, false));
+
+    // a different deflection requires a new mesh
+    std::shared_ptr<const tigl::CTiglPolyData> mesh2 = cache.Triangulate(NULL, loft, 0.05);
+    EXPECT_NE(mesh1, mesh2);
+    EXPECT_LT(mesh2->getTotalPolygonCount(), mesh1->getTotalPolygonCount());
+    EXPECT_EQ(2, cache.Size());
+
+    // the mesh with segment info replaces the mesh without
+    std::shared_ptr<const tigl::CTiglPolyData> meshWithInfo = cache.Triangulate(&Config().GetUIDManager(), loft, 0.01, tigl::SEGMENT_INFO);
+    EXPECT_NE(mesh1, meshWithInfo);
+    EXPECT_TRUE(meshWithInfo->currentObject().hasMetadata());
+    EXPECT_EQ(mesh1->getTotalPolygonCount(), meshWithInfo->getTotalPolygonCount());
+    EXPECT_EQ(2, cache.Size());
+    EXPECT_EQ(meshWithInfo, cache.Triangulate(NULL, loft, 0.01));
+
+    // the returned meshes stay valid after clearing the cache
+    cache.Clear();
+    EXPECT_EQ(0, cache.Size());
+    EXPECT_GT(mesh1->getTotalPolygonCount(), 0);
+}
+
+TEST_F(TiglTessellationCache, capacity)
+{
+    tigl::CTiglTessellationCache& cache = tigl::CTiglTessellationCache::GetInstance();
+    const size_t oldCapacity = cache.GetCapacity();
+    PNamedShape loft = Config().GetWing(1).GetLoft();
+
+    cache.SetCapacity(1);
+    std::shared_ptr<const tigl::CTiglPolyData> mesh1 = cache.Triangulate(NULL, loft, 0.01);
+    cache.Triangulate(NULL, loft, 0.05);
+    EXPECT_EQ(1, cache.Size());
+    EXPECT_NE(mesh1, cache.Triangulate(NULL, loft, 0.01));
+
+    cache.SetCapacity(0);
+    EXPECT_EQ(0, cache.Size());
+    cache.Triangulate(NULL, loft, 0.01);
+    EXPECT_EQ(0, cache.Size());
+
+    cache.SetCapacity(oldCapacity);
+}
+
+TEST_F(TiglTessellationCache, memoryBudget)
+{
+    tigl::CTiglTessellationCache& cache = tigl::CTiglTessellationCache::GetInstance();
+    const size_t oldBudget = cache.GetMemoryBudget();
+    EXPECT_GT(oldBudget, 0);
+    PNamedShape loft = Config().GetWing(1).GetLoft();
+
+    std::shared_ptr<const tigl::CTiglPolyData> mesh1 = cache.Triangulate(NULL, loft, 0.01);
+    const size_t size1 = tigl::CTiglTessellationCache::EstimateSize(*mesh1);
+    EXPECT_GT(size1, 0);
+    EXPECT_EQ(size1, cache.GetMemoryUsage());
+
+    // the second mesh exceeds the budget, hence the least recently used one is removed
+    cache.SetMemoryBudget(size1 + 1);
+    std::shared_ptr<const tigl::CTiglPolyData> mesh2 = cache.Triangulate(NULL, loft, 0.05);
+    EXPECT_EQ(1, cache.Size());
+    EXPECT_EQ(tigl::CTiglTessellationCache::EstimateSize(*mesh2), cache.GetMemoryUsage());
+    EXPECT_EQ(mesh2, cache.Triangulate(NULL, loft, 0.05));
+
+    // the most recently used mesh is kept, even if it exceeds the budget
+    cache.SetMemoryBudget(1);
+    EXPECT_EQ(1, cache.Size());
+
+    cache.Clear();
+    EXPECT_EQ(0, cache.GetMemoryUsage());
+    cache.SetMemoryBudget(oldBudget);
+}
+
+TEST_F(TiglTessellationCache, clearOnClose)
+{
+    tigl::CTiglTessellationCache& cache = tigl::CTiglTessellationCache::GetInstance();
+
+    TiglCPACSConfigurationHandle otherHandle = -1;
+    ASSERT_EQ(TIGL_SUCCESS, tiglOpenCPACSConfiguration(tixiHandle, "Cpacs2Test", &otherHandle));
+    tigl::CCPACSConfiguration& other = tigl::CCPACSConfigurationManager::GetInstance().GetConfiguration(otherHandle);
+    cache.Triangulate(NULL, other.GetWing(1).GetLoft(), 0.05);
+    EXPECT_EQ(1, cache.Size());
+
+    ASSERT_EQ(TIGL_SUCCESS, tiglCloseCPACSConfiguration(otherHandle));
+    EXPECT_EQ(0, cache.Size());
+    EXPECT_EQ(0, cache.GetMemoryUsage());
+}
+
+TEST_F(TiglTessellationCache, exportToFiles)
+{
+    tigl::CTiglTessellationCache& cache = tigl::CTiglTessellationCache::GetInstance();
+
+    const char* files[] = {
+        "TestData/export/simpletest_multiformat.stl",
+        "TestData/export/simpletest_multiformat.vtp",
+        "TestData/export/simpletest_multiformat.dae"
+    };
+    ASSERT_EQ(TIGL_SUCCESS, tiglExportConfigurationToFiles(tiglHandle, files, 3, TIGL_FALSE, 0.01));
+
+    for (const char* file : files) {
+        std::ifstream stream(file);
+        EXPECT_TRUE(stream.good()) << file;
+    }
+
+    // each shape was meshed only once for all three formats
+    tigl::PTiglCADExporter exporter = tigl::createExporter("vtp");
+    ASSERT_TRUE(exporter->AddConfiguration(Config()));
+    EXPECT_EQ(exporter->NShapes(), cache.Size());
+
+    EXPECT_EQ(TIGL_NULL_POINTER, tiglExportConfigurationToFiles(tiglHandle, NULL, 1, TIGL_FALSE, 0.01));
+    EXPECT_EQ(TIGL_INDEX_ERROR, tiglExportConfigurationToFiles(tiglHandle, files, 0, TIGL_FALSE, 0.01));
+
+    const char* unknownFiles[] = {"TestData/export/simpletest_multiformat.unknown"};
+    EXPECT_EQ(TIGL_NOT_FOUND, tiglExportConfigurationToFiles(tiglHandle, unknownFiles, 1, TIGL_FALSE, 0.01));
+}
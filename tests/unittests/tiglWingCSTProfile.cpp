@@ -33,6 +33,7 @@
 #include "Geom_Curve.hxx"
 #include "gp_Pnt.hxx"
 #include "gp_Pnt.hxx"
+#include "gp_Vec.hxx"
 #include "GeomAPI_ProjectPointOnCurve.hxx"
 #include "Geom_BSplineCurve.hxx"
 #include "CCSTCurveBuilder.h"
@@ -301,6 +302,38 @@ TEST_P(CSTApprox, hypersonicAirfoil)
     }
 }
 
+TEST(CSTCurveBuilder, cache)
+{
+    tigl::CCSTCurveBuilder::ClearCache();
+    EXPECT_EQ(0u, tigl::CCSTCurveBuilder::CacheSize());
+
+    std::vector<double> B = {0.2, 0.3, 0.25};
+    Handle(Geom_BSplineCurve) curve1 = tigl::CCSTCurveBuilder(0.5, 1.0, B, 0.001).Curve();
+    EXPECT_EQ(1u, tigl::CCSTCurveBuilder::CacheSize());
+
+    // the same coefficients are taken from the cache
+    Handle(Geom_BSplineCurve) curve2 = tigl::CCSTCurveBuilder(0.5, 1.0, B, 0.001).Curve();
+    EXPECT_EQ(1u, tigl::CCSTCurveBuilder::CacheSize());
+    ASSERT_EQ(curve1->NbPoles(), curve2->NbPoles());
+    for (int i = 1; i <= curve1->NbPoles(); ++i) {
+        EXPECT_EQ(0., curve1->Pole(i).Distance(curve2->Pole(i)));
+    }
+
+    // the cached curve is not affected by modifications of the returned curve
+    EXPECT_NE(curve1.get(), curve2.get());
+    curve1->Translate(gp_Vec(1., 0., 0.));
+    Handle(Geom_BSplineCurve) curve3 = tigl::CCSTCurveBuilder(0.5, 1.0, B, 0.001).Curve();
+    EXPECT_EQ(0., curve2->Pole(1).Distance(curve3->Pole(1)));
+
+    // different coefficients or algorithms are different entries
+    tigl::CCSTCurveBuilder(0.5, 1.0, B, 0.).Curve();
+    tigl::CCSTCurveBuilder(0.5, 1.0, B, 0.001, tigl::CCSTCurveBuilder::Algorithm::GeomAPI_PointsToBSpline).Curve();
+    EXPECT_EQ(3u, tigl::CCSTCurveBuilder::CacheSize());
+
+    tigl::CCSTCurveBuilder::ClearCache();
+    EXPECT_EQ(0u, tigl::CCSTCurveBuilder::CacheSize());
+}
+
 INSTANTIATE_TEST_SUITE_P(
     CSTApprox_DifferentAlgos,
     CSTApprox,
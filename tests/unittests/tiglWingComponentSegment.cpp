@@ -30,6 +30,7 @@
 #include "CTiglWingChordface.h"
 #include "tigletaxsifunctions.h"
 #include "EtaXsi.h"
+#include <vector>
 
 /******************************************************************************/
 
@@ -609,6 +610,49 @@ TEST_F(WingComponentSegmentSimple, determine_segments)
     ASSERT_STREQ("Cpacs2Test_Wing_Seg_2_3", list.at(1)->GetUID().c_str());
 }
 
+TEST_F(WingComponentSegmentSimple, findSegments)
+{
+    const tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
+    const tigl::CCPACSConfiguration & config = manager.GetConfiguration(tiglHandle);
+    const tigl::CCPACSWing& wing = config.GetWing(1);
+    const tigl::CCPACSWingComponentSegment& cs = wing.GetComponentSegment(1);
+    const tigl::SegmentList& segments = cs.GetSegmentList();
+
+    // points on both segments and one point far away from the wing
+    std::vector<gp_Pnt> points;
+    std::vector<const tigl::CCPACSWingSegment*> expected;
+    for (const tigl::CCPACSWingSegment* segment : segments) {
+        for (double eta = 0.1; eta < 1.; eta += 0.2) {
+            points.push_back(segment->GetChordPoint(eta, 0.4));
+            expected.push_back(segment);
+            points.push_back(segment->GetUpperPoint(eta, 0.7, asParameterOnSurface));
+            expected.push_back(segment);
+        }
+    }
+    points.push_back(gp_Pnt(0., 100., 0.));
+    expected.push_back(nullptr);
+
+    std::vector<gp_Pnt> nearestPoints;
+    std::vector<double> deviations;
+    std::vector<const tigl::CCPACSWingSegment*> found = cs.findSegments(points, nearestPoints, deviations);
+    ASSERT_EQ(points.size(), found.size());
+    ASSERT_EQ(points.size(), nearestPoints.size());
+    ASSERT_EQ(points.size(), deviations.size());
+
+    for (size_t i = 0; i < points.size(); ++i) {
+        EXPECT_EQ(expected[i], found[i]);
+
+        gp_Pnt nearestPoint;
+        double deviation = 0.;
+        const tigl::CCPACSWingSegment* single = cs.findSegment(points[i].X(), points[i].Y(), points[i].Z(), nearestPoint, deviation);
+        EXPECT_EQ(single, found[i]);
+        EXPECT_NEAR(deviation, deviations[i], 1e-12);
+        if (found[i]) {
+            EXPECT_LT(nearestPoint.Distance(nearestPoints[i]), 1e-12);
+        }
+    }
+}
+
 TEST_F(WingComponentSegmentSimple, GetSegments)
 {
     int nsegments = 0;
@@ -22,6 +22,8 @@
 #include "test.h" // Brings in the GTest framework
 #include "tigl.h"
 
+#include <vector>
+
 /******************************************************************************/
 
 class WingGetPoint : public ::testing::Test 
@@ -467,3 +469,62 @@ TEST(WingGetPointWithGuides, fourGuideCurves)
         }
     }
 }
+
+/**
+* Tests, that tiglWingGetUpperPoints and tiglWingGetLowerPoints return
+* the same points as the single point functions.
+*/
+TEST_F(WingGetPoint, tiglWingGetPoints_matchSinglePoints)
+{
+    std::vector<double> etas, xsis;
+    for (double eta = 0; eta <= 1.0; eta += 0.125) {
+        for (double xsi = 0; xsi <= 1.0; xsi += 0.125) {
+            etas.push_back(eta);
+            xsis.push_back(xsi);
+        }
+    }
+    const int n = static_cast<int>(etas.size());
+    std::vector<double> x(n), y(n), z(n);
+
+    for (TiglGetPointBehavior behavior : {asParameterOnSurface, onLinearLoft}) {
+        ASSERT_EQ(TIGL_SUCCESS, tiglWingSetGetPointBehavior(tiglHandle, behavior));
+
+        ASSERT_EQ(TIGL_SUCCESS, tiglWingGetUpperPoints(tiglHandle, 1, 2, n, etas.data(), xsis.data(), x.data(), y.data(), z.data()));
+        for (int i = 0; i < n; ++i) {
+            double px, py, pz;
+            ASSERT_EQ(TIGL_SUCCESS, tiglWingGetUpperPoint(tiglHandle, 1, 2, etas[i], xsis[i], &px, &py, &pz));
+            EXPECT_NEAR(px, x[i], 1e-10);
+            EXPECT_NEAR(py, y[i], 1e-10);
+            EXPECT_NEAR(pz, z[i], 1e-10);
+        }
+
+        ASSERT_EQ(TIGL_SUCCESS, tiglWingGetLowerPoints(tiglHandle, 1, 2, n, etas.data(), xsis.data(), x.data(), y.data(), z.data()));
+        for (int i = 0; i < n; ++i) {
+            double px, py, pz;
+            ASSERT_EQ(TIGL_SUCCESS, tiglWingGetLowerPoint(tiglHandle, 1, 2, etas[i], xsis[i], &px, &py, &pz));
+            EXPECT_NEAR(px, x[i], 1e-10);
+            EXPECT_NEAR(py, y[i], 1e-10);
+            EXPECT_NEAR(pz, z[i], 1e-10);
+        }
+    }
+    ASSERT_EQ(TIGL_SUCCESS, tiglWingSetGetPointBehavior(tiglHandle, asParameterOnSurface));
+}
+
+/**
+* Tests invalid arguments of tiglWingGetUpperPoints and tiglWingGetLowerPoints.
+*/
+TEST_F(WingGetPoint, tiglWingGetPoints_invalidArguments)
+{
+    double eta[2] = {0.0, 0.5};
+    double xsi[2] = {0.0, 1.5};
+    double x[2], y[2], z[2];
+
+    EXPECT_EQ(TIGL_NOT_FOUND, tiglWingGetUpperPoints(-1, 1, 1, 1, eta, xsi, x, y, z));
+    EXPECT_EQ(TIGL_INDEX_ERROR, tiglWingGetUpperPoints(tiglHandle, 1, 0, 1, eta, xsi, x, y, z));
+    EXPECT_EQ(TIGL_NULL_POINTER, tiglWingGetUpperPoints(tiglHandle, 1, 1, 1, NULL, xsi, x, y, z));
+    EXPECT_EQ(TIGL_NULL_POINTER, tiglWingGetLowerPoints(tiglHandle, 1, 1, 1, eta, xsi, x, y, NULL));
+    EXPECT_EQ(TIGL_ERROR, tiglWingGetLowerPoints(tiglHandle, 1, 1, -1, eta, xsi, x, y, z));
+    // xsi out of range
+    EXPECT_EQ(TIGL_ERROR, tiglWingGetUpperPoints(tiglHandle, 1, 1, 2, eta, xsi, x, y, z));
+    EXPECT_EQ(TIGL_SUCCESS, tiglWingGetUpperPoints(tiglHandle, 1, 1, 0, eta, xsi, x, y, z));
+}
@@ -60,6 +60,37 @@ TEST(WingProfileBugs, Bug2)
     ASSERT_NEAR(0.0, p.Y(), 1e-7);
 }
 
+TEST(WingProfileGetPoint, chordCoordinate)
+{
+    TiglHandleWrapper tiglHandle("TestData/simpletest.cpacs.xml", "Cpacs2Test");
+
+    tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
+    tigl::CCPACSConfiguration & config = manager.GetConfiguration(tiglHandle);
+    tigl::CCPACSWingProfile& profile = config.GetWingProfile("NACA0012");
+
+    gp_Pnt le = profile.GetLEPoint();
+    gp_Pnt te = profile.GetTEPoint();
+    gp_Vec chord(le, te);
+
+    for (double xsi = 0.; xsi <= 1.0; xsi += 0.01) {
+        gp_Pnt pu = profile.GetUpperPoint(xsi);
+        gp_Pnt pl = profile.GetLowerPoint(xsi);
+
+        // the points must lie on the chord normal at xsi
+        EXPECT_NEAR(xsi, gp_Vec(le, pu).Dot(chord) / chord.SquareMagnitude(), 1e-10);
+        EXPECT_NEAR(xsi, gp_Vec(le, pl).Dot(chord) / chord.SquareMagnitude(), 1e-10);
+
+        // symmetric profile
+        EXPECT_NEAR(0., pu.Z() + pl.Z(), 1e-6);
+        EXPECT_GE(pu.Z(), pl.Z());
+    }
+
+    // repeated queries give the same result
+    gp_Pnt p1 = profile.GetUpperPoint(0.3);
+    gp_Pnt p2 = profile.GetUpperPoint(0.3);
+    EXPECT_EQ(0., p1.Distance(p2));
+}
+
 TEST(WingProfileParams, GetKinksVector)
 {
     TixiHandleWrapper tixiHandle("TestData/wingprofilewithparams.xml");
@@ -991,6 +991,53 @@ TEST_F(WingSegmentSimple, trafo_Consistency)
     }
 }
 
+TEST_F(WingSegmentSimple, getEtaXsi_roundtripGrid)
+{
+    tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
+    tigl::CCPACSConfiguration & config = manager.GetConfiguration(tiglSimpleHandle);
+    tigl::CCPACSWing& wing = config.GetWing(1);
+
+    for (int segIndex = 1; segIndex <= wing.GetSegmentCount(); ++segIndex) {
+        tigl::CCPACSWingSegment& segment = (tigl::CCPACSWingSegment&) wing.GetSegment(segIndex);
+        for (double eta = 0.05; eta < 1.; eta += 0.15) {
+            for (double xsi = 0.05; xsi < 1.; xsi += 0.15) {
+                for (bool fromUpper : {true, false}) {
+                    gp_Pnt point = segment.GetPoint(eta, xsi, fromUpper, GLOBAL_COORDINATE_SYSTEM, asParameterOnSurface);
+
+                    gp_Pnt pproj;
+                    double eta_end = 0., xsi_end = 0.;
+                    segment.GetEtaXsi(point, eta_end, xsi_end, pproj, asParameterOnSurface);
+                    EXPECT_NEAR(eta, eta_end, 1e-7);
+                    EXPECT_NEAR(xsi, xsi_end, 1e-7);
+                    EXPECT_NEAR(0., point.Distance(pproj), 1e-7);
+
+                    if (fromUpper) {
+                        EXPECT_TRUE(segment.GetIsOnTop(point));
+                    }
+                    EXPECT_TRUE(segment.GetIsOn(point));
+                }
+            }
+        }
+    }
+}
+
+TEST_F(WingSegmentSimple, getIsOnTop_beyondTip)
+{
+    tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
+    tigl::CCPACSConfiguration & config = manager.GetConfiguration(tiglSimpleHandle);
+    tigl::CCPACSWing& wing = config.GetWing(1);
+    tigl::CCPACSWingSegment& segment = (tigl::CCPACSWingSegment&) wing.GetSegment(wing.GetSegmentCount());
+
+    // extend the upper surface by 1 cm beyond the tip, i.e. within the tolerance of GetIsOnTop
+    gp_Pnt tip = segment.GetPoint(1., 0.5, true, GLOBAL_COORDINATE_SYSTEM, asParameterOnSurface);
+    gp_Vec spanwise(segment.GetPoint(0.99, 0.5, true, GLOBAL_COORDINATE_SYSTEM, asParameterOnSurface), tip);
+    gp_Pnt beyondTip = tip.Translated(spanwise.Normalized() * 0.01);
+
+    EXPECT_TRUE(segment.GetIsOnTop(tip));
+    // the point has no orthogonal projection onto the upper surface
+    EXPECT_FALSE(segment.GetIsOnTop(beyondTip));
+}
+
 TEST_F(WingSegmentSimple, getEtaXsi_Performance)
 {
     // we transform eta, xsi to x,y,z and perform the back transform